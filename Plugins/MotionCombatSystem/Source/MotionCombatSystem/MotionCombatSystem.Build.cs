@@ -41,6 +41,8 @@ public class MotionCombatSystem : ModuleRules
 				"Engine",
 				"Slate",
 				"SlateCore",
+				"NavigationSystem",
+				"AIModule",
 				// ... add private dependencies that you statically link with here ...	
 			}
 			);
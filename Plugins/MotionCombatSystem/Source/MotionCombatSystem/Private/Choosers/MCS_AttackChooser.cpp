@@ -15,9 +15,106 @@
  */
 
 #include <Choosers/MCS_AttackChooser.h>
+#include <SubSystems/MCS_CombatBudgetSubsystem.h>
+#include <Stats/MCS_Stats.h>
 #include "GameFramework/Actor.h"
+#include "Engine/World.h"
 #include "Kismet/KismetMathLibrary.h"
 #include "Math/UnrealMathUtility.h"
+#include <SubSystems/MCS_ResourceSubsystem.h>
+
+namespace MCS_AttackIndex
+{
+    /** Concrete situations the current state satisfies, as 1 << EMCS_AttackSituations */
+    static uint32 GetActiveSituations(const FMCS_AttackSituation& Situation)
+    {
+        const auto Bit = [](bool bActive, EMCS_AttackSituations Value) { return bActive ? 1u << static_cast<uint32>(Value) : 0u; };
+
+        return Bit(Situation.bIsGrounded, EMCS_AttackSituations::Grounded)
+            | Bit(Situation.bIsInAir, EMCS_AttackSituations::Airborne)
+            | Bit(Situation.bIsRunning, EMCS_AttackSituations::Running)
+            | Bit(Situation.bIsCrouching, EMCS_AttackSituations::Crouching)
+            | Bit(Situation.bIsCountering, EMCS_AttackSituations::Counter)
+            | Bit(Situation.bIsParrying, EMCS_AttackSituations::Parry)
+            | Bit(Situation.bIsRiposting, EMCS_AttackSituations::Riposte)
+            | Bit(Situation.bIsFinishing, EMCS_AttackSituations::Finisher);
+    }
+
+    /** Distance to the closest valid target (what ComputeDistanceScore measures), or -1 without one */
+    static float GetClosestTargetDistance(const AActor* Instigator, const TArray<AActor*>& Targets)
+    {
+        if (!IsValid(Instigator))
+        {
+            return -1.f;
+        }
+
+        const FVector InstigatorLoc = Instigator->GetActorLocation();
+        float ClosestDistSq = TNumericLimits<float>::Max();
+        bool bFound = false;
+
+        for (const AActor* Target : Targets)
+        {
+            if (IsValid(Target))
+            {
+                ClosestDistSq = FMath::Min(ClosestDistSq, static_cast<float>(FVector::DistSquared(InstigatorLoc, Target->GetActorLocation())));
+                bFound = true;
+            }
+        }
+
+        return bFound ? FMath::Sqrt(ClosestDistSq) : -1.f;
+    }
+
+    /** Which rows of a compiled set a query scores */
+    enum class EQueryMode : uint8
+    {
+        AllEntries,     // no type filter (name-filtered combo queries, Blueprint ChooseAttack)
+        Type,           // every row of the requested type
+        Partition       // only the (type, direction, active situations) buckets
+    };
+
+    /** Entry indices of Set a query has to score; rows that cannot reach Distance (when >= 0) are left out */
+    static TConstArrayView<int32> GatherCandidates(const FMCS_CompiledAttackSet& Set, EMCS_AttackType Type,
+        EMCS_AttackDirection Direction, uint32 SituationBits, float Distance, EQueryMode Mode, TArray<int32>& CandidateScratch)
+    {
+        if (Mode == EQueryMode::AllEntries)
+        {
+            return Set.ClipToReach(Set.GetReachOrder(), Distance);
+        }
+
+        if (Mode == EQueryMode::Type)
+        {
+            return Set.ClipToReach(Set.GetTypeBucket(Type), Distance);
+        }
+
+        // One active situation (the common case) is a single bucket, no copy
+        if (FMath::IsPowerOfTwo(SituationBits))
+        {
+            const EMCS_AttackSituations Situation = static_cast<EMCS_AttackSituations>(FMath::CountTrailingZeros(SituationBits));
+            return Set.ClipToReach(Set.GetBucket(Type, Direction, Situation), Distance);
+        }
+
+        // Several (e.g. grounded and running): merge their buckets; Any rows appear in each, so drop duplicates
+        CandidateScratch.Reset();
+        for (uint32 Bits = SituationBits; Bits != 0; Bits &= Bits - 1)
+        {
+            const EMCS_AttackSituations Situation = static_cast<EMCS_AttackSituations>(FMath::CountTrailingZeros(Bits));
+            CandidateScratch.Append(Set.ClipToReach(Set.GetBucket(Type, Direction, Situation), Distance));
+        }
+
+        CandidateScratch.Sort();
+        int32 Unique = 0;
+        for (int32 i = 0; i < CandidateScratch.Num(); ++i)
+        {
+            if (Unique == 0 || CandidateScratch[Unique - 1] != CandidateScratch[i])
+            {
+                CandidateScratch[Unique++] = CandidateScratch[i];
+            }
+        }
+        CandidateScratch.SetNum(Unique, EAllowShrinking::No);
+
+        return CandidateScratch;
+    }
+}
 
 UMCS_AttackChooser::UMCS_AttackChooser(const FObjectInitializer& ObjectInitializer)
     : Super(ObjectInitializer)
@@ -42,56 +139,195 @@ bool UMCS_AttackChooser::ChooseAttack(
     const FMCS_AttackSituation& CurrentSituation,
     FMCS_AttackEntry& OutAttack) const
 {
-    if (AttackEntries.IsEmpty())
+    const int32 ChosenIndex = ChooseAttackIndex(Instigator, Targets, DesiredDirection, CurrentSituation, FMCS_AttackQueryFilter());
+    const FMCS_AttackEntry* Chosen = GetEntry(ChosenIndex);
+    if (!Chosen)
     {
         return false;
     }
 
+    OutAttack = *Chosen;
+    return true;
+}
+
+/*
+ * Native attack selection over the merged view of the active layers
+ */
+int32 UMCS_AttackChooser::ChooseAttackIndex(
+    AActor* Instigator,
+    const TArray<AActor*>& Targets,
+    EMCS_AttackDirection DesiredDirection,
+    const FMCS_AttackSituation& CurrentSituation,
+    const FMCS_AttackQueryFilter& Filter) const
+{
+    if (NumEntries() == 0)
+    {
+        return INDEX_NONE;
+    }
+
+    FMCS_BudgetScope BudgetScope(Instigator, EMCS_BudgetCategory::Chooser);
+
 #if WITH_EDITORONLY_DATA || UE_BUILD_DEVELOPMENT
     ClearDebugScores();
 #endif
 
     float BestScore = -TNumericLimits<float>::Max();
-    TArray<int32> BestIndices;
+    TArray<int32, TInlineAllocator<8>> BestIndices;
 
-    for (int32 i = 0; i < AttackEntries.Num(); ++i)
-    {
-        const FMCS_AttackEntry& Entry = AttackEntries[i];
-        if (!IsEntryAllowedByBasicFilters(Entry, Instigator, Targets))
-            continue;
+    // Read once from the resource store; instigators without resources are unlimited
+    const float AvailableStamina = UMCS_ResourceSubsystem::GetAvailableStamina(Instigator);
 
-        // Pass CurrentSituation into the scoring function
-        const float Score = ScoreAttack(Entry, Instigator, Targets, DesiredDirection, CurrentSituation);
-        if (!FMath::IsFinite(Score))
-            continue;
+    const UWorld* World = Instigator ? Instigator->GetWorld() : nullptr;
+    const float Now = World ? World->GetTimeSeconds() : 0.f;
+
+    SyncMemory();
+
+    const uint32 SituationBits = MCS_AttackIndex::GetActiveSituations(CurrentSituation);
+    const bool bCustomScoring = UsesCustomScoring();
+
+    // Generated scorers reproduce ScoreAttack_Implementation without a tag score
+    const bool bNativeScoring = bUseNativeScorers && !bCustomScoring && !RequiredAttackTag.IsValid();
+
+    const float ClosestDistance = !bCustomScoring && (bCullOutOfRange || bNativeScoring)
+        ? MCS_AttackIndex::GetClosestTargetDistance(Instigator, Targets)
+        : -1.f;
+
+    // Native scoring disqualifies rows whose range the closest target is beyond; those are never scored
+    const float TargetDistance = bCullOutOfRange ? ClosestDistance : -1.f;
+
+    FMCS_NativeScoreQuery NativeQuery;
+    NativeQuery.Distance = ClosestDistance;
+    NativeQuery.Direction = DesiredDirection;
+    NativeQuery.Situation = &CurrentSituation;
+    NativeQuery.Stamina = AvailableStamina < MAX_flt ? AvailableStamina : CurrentSituation.Stamina;
+
+    // Scores one entry of a range (a layer, or AttackEntries); PenaltyScratch holds that range's penalties
+    auto EvaluateEntry = [ & ] (TConstArrayView<FMCS_AttackEntry> Entries, const TBitArray<>* Shadowed, int32 FirstIndex, FMCS_NativeScoreFunc NativeScore, int32 i)
+        {
+            const float Penalty = PenaltyScratch[i];
+            if (Penalty == MAX_flt)
+                return; // on cooldown
+
+            if (Shadowed && (*Shadowed)[i])
+                return; // overridden by a higher-priority layer
+
+            const FMCS_AttackEntry& Entry = Entries[i];
+            if (Filter.bFilterType && Entry.AttackType != Filter.Type)
+                return;
+
+            if (!Filter.AllowedNames.IsEmpty() && !Filter.AllowedNames.Contains(Entry.AttackName))
+                return;
+
+            if (Entry.StaminaCost > AvailableStamina)
+                return;
+
+            if (!IsEntryAllowedByBasicFilters(Entry, Instigator, Targets))
+                return;
+
+            // Pass CurrentSituation into the scoring function
+            const float Score = (NativeScore
+                ? NativeScore(i, NativeQuery)
+                : ScoreAttack(Entry, Instigator, Targets, DesiredDirection, CurrentSituation)) - Penalty;
+            if (!FMath::IsFinite(Score))
+                return;
 
 #if WITH_EDITORONLY_DATA || UE_BUILD_DEVELOPMENT
-        FMCS_DebugAttackScore DebugEntry;
-        DebugEntry.AttackName = Entry.AttackName;
-        DebugEntry.BaseScore = Entry.SelectionWeight;
-        DebugEntry.TagScore = ComputeTagScore(Entry);
-        DebugEntry.DistanceScore = ComputeDistanceScore(Entry, Instigator, Targets);
-        DebugEntry.DirectionScore = ComputeDirectionalScore(Entry, DesiredDirection);
-        DebugEntry.SituationScore = ComputeSituationScore(Entry, CurrentSituation);
-        DebugEntry.TotalScore = DebugEntry.BaseScore + DebugEntry.TagScore + DebugEntry.DistanceScore + DebugEntry.DirectionScore + DebugEntry.SituationScore;
-        DebugEntry.Notes = FString::Printf(TEXT("Tag:%+.1f Dist:%+.1f Dir:%+.1f Sit:%+.1f"),
-        DebugEntry.TagScore, DebugEntry.DistanceScore, DebugEntry.DirectionScore, DebugEntry.SituationScore);
-        DebugScores.Add(DebugEntry);
+            FMCS_DebugAttackScore DebugEntry;
+            DebugEntry.AttackName = Entry.AttackName;
+            DebugEntry.BaseScore = Entry.SelectionWeight;
+            DebugEntry.TagScore = ComputeTagScore(Entry);
+            DebugEntry.DistanceScore = ComputeDistanceScore(Entry, Instigator, Targets);
+            DebugEntry.DirectionScore = ComputeDirectionalScore(Entry, DesiredDirection);
+            DebugEntry.SituationScore = ComputeSituationScore(Entry, CurrentSituation, Instigator);
+            DebugEntry.TotalScore = DebugEntry.BaseScore + DebugEntry.TagScore + DebugEntry.DistanceScore + DebugEntry.DirectionScore + DebugEntry.SituationScore - Penalty;
+            DebugEntry.Notes = FString::Printf(TEXT("Tag:%+.1f Dist:%+.1f Dir:%+.1f Sit:%+.1f Rec:%+.1f"),
+            DebugEntry.TagScore, DebugEntry.DistanceScore, DebugEntry.DirectionScore, DebugEntry.SituationScore, -Penalty);
+            DebugScores.Add(DebugEntry);
 #endif
 
-        if (Score > BestScore)
+            if (Score > BestScore)
+            {
+                BestScore = Score;
+                BestIndices = { FirstIndex + i };
+            }
+            else if (FMath::IsNearlyEqual(Score, BestScore))
+            {
+                BestIndices.Add(FirstIndex + i);
+            }
+        };
+
+    // Scores a range: every entry, or only the candidates its compiled set's partitions give for the query
+    auto EvaluateRange = [ & ] (TConstArrayView<FMCS_AttackEntry> Entries, const FMCS_AttackMemory& RangeMemory, const TBitArray<>* Shadowed, int32 FirstIndex,
+        const FMCS_CompiledAttackSet* Set, const FMCS_NativeScorer& NativeScorer, MCS_AttackIndex::EQueryMode Mode)
         {
-            BestScore = Score;
-            BestIndices = { i };
-        }
-        else if (FMath::IsNearlyEqual(Score, BestScore))
+            const FMCS_NativeScoreFunc NativeScore = bNativeScoring ? NativeScorer.Score : nullptr;
+
+            // Cooldown filter and recency penalty for every entry of the range in one pass
+            RangeMemory.ComputePenalties(Now, RecencyPenalty, RecencyWindow, PenaltyScratch);
+
+            if (!Set)
+            {
+                // Uncompiled rows (AttackEntries) have no index; check the reach inline
+                for (int32 i = 0; i < Entries.Num(); ++i)
+                {
+                    if (TargetDistance < 0.f || TargetDistance <= Entries[i].RangeEnd * FMCS_CompiledAttackSet::RangeSlack)
+                    {
+                        EvaluateEntry(Entries, Shadowed, FirstIndex, NativeScore, i);
+                    }
+                }
+                return;
+            }
+
+            for (const int32 i : MCS_AttackIndex::GatherCandidates(*Set, Filter.Type, DesiredDirection, SituationBits, TargetDistance, Mode, CandidateScratch))
+            {
+                EvaluateEntry(Entries, Shadowed, FirstIndex, NativeScore, i);
+            }
+        };
+
+    auto EvaluateLayers = [ & ] (MCS_AttackIndex::EQueryMode Mode)
         {
-            BestIndices.Add(i);
-        }
+            if (Layers.IsEmpty())
+            {
+                EvaluateRange(AttackEntries, Memory, nullptr, 0, nullptr, FMCS_NativeScorer(), Mode);
+                return;
+            }
+
+            for (const FMCS_AttackLayer& Layer : Layers)
+            {
+                if (Layer.bActive)
+                {
+                    EvaluateRange(Layer.Set->Entries, Layer.Memory, &Layer.Shadowed, Layer.FirstIndex, Layer.Set.Get(), Layer.NativeScorer, Mode);
+                }
+            }
+        };
+
+    //----------------------------------------
+    // Pick the narrowest candidate set the query allows
+    //----------------------------------------
+    MCS_AttackIndex::EQueryMode Mode = MCS_AttackIndex::EQueryMode::AllEntries;
+
+    if (Filter.bFilterType && Filter.AllowedNames.IsEmpty())
+    {
+        // Blueprint scoring may rank rows the partitions leave out, so it only gets the type bucket
+        const bool bPartition = bUsePartitionedIndex && !bCustomScoring
+            && DesiredDirection != EMCS_AttackDirection::Omni && SituationBits != 0;
+
+        Mode = bPartition ? MCS_AttackIndex::EQueryMode::Partition : MCS_AttackIndex::EQueryMode::Type;
+    }
+
+    EvaluateLayers(Mode);
+
+    // Nothing in the matching buckets survived the filters; the rest of the type can still win
+    if (BestIndices.IsEmpty() && Mode == MCS_AttackIndex::EQueryMode::Partition)
+    {
+        EvaluateLayers(MCS_AttackIndex::EQueryMode::Type);
     }
 
     if (BestIndices.IsEmpty())
-        return false;
+        return INDEX_NONE;
+
+    // Candidates arrive farthest reach first; ties still resolve in entry order
+    BestIndices.Sort();
 
     int32 ChosenIndex = BestIndices[0];
     if (BestIndices.Num() > 1 && bRandomTieBreak)
@@ -99,14 +335,363 @@ bool UMCS_AttackChooser::ChooseAttack(
 
 #if WITH_EDITORONLY_DATA || UE_BUILD_DEVELOPMENT
     // Mark the winning entry
+    const FName ChosenName = GetEntry(ChosenIndex)->AttackName;
     for (FMCS_DebugAttackScore& Info : DebugScores)
     {
-        Info.bWasChosen = (Info.AttackName == AttackEntries[ChosenIndex].AttackName);
+        Info.bWasChosen = (Info.AttackName == ChosenName);
     }
 #endif
 
-    OutAttack = AttackEntries[ChosenIndex];
-    return true;
+    return ChosenIndex;
+}
+
+bool UMCS_AttackChooser::UsesCustomScoring() const
+{
+    const UClass* Class = GetClass();
+    if (Class->IsFunctionImplementedInScript(GET_FUNCTION_NAME_CHECKED(UMCS_AttackChooser, ScoreAttack)))
+    {
+        return true;
+    }
+
+    // Any native class below this one may override ScoreAttack_Implementation
+    while (Class && !Class->HasAnyClassFlags(CLASS_Native))
+    {
+        Class = Class->GetSuperClass();
+    }
+    return Class != UMCS_AttackChooser::StaticClass();
+}
+
+/* ==========================================================
+ * Layers & Attack Memory
+ * ========================================================== */
+
+void UMCS_AttackChooser::AddLayer(const FGameplayTag& LayerTag, TSharedPtr<const FMCS_CompiledAttackSet> InCompiledSet, int32 Priority)
+{
+    if (!InCompiledSet.IsValid())
+    {
+        return;
+    }
+
+    LLM_SCOPE_BYTAG(MotionCombat_Choosers);
+
+    FMCS_AttackLayer* Layer = Layers.FindByPredicate([ &LayerTag ] (const FMCS_AttackLayer& Existing) { return Existing.Tag == LayerTag; });
+    bool bLayoutChanged = false;
+
+    if (!Layer)
+    {
+        Layer = &Layers.AddDefaulted_GetRef();
+        Layer->Tag = LayerTag;
+        bLayoutChanged = true;
+    }
+
+    if (Layer->Set != InCompiledSet)
+    {
+        Layer->Set = MoveTemp(InCompiledSet);
+
+        // Rows that survive a recompile keep their cooldowns, and a row shared with another set
+        // (same AttackName) keeps the cooldown it picked up there
+        Layer->Memory.Rebuild(Layer->Set->Entries);
+        for (const FMCS_AttackLayer& Other : Layers)
+        {
+            if (&Other != Layer)
+            {
+                Layer->Memory.InheritFrom(Other.Memory);
+            }
+        }
+
+        Layer->NativeScorer = FMCS_NativeScorerRegistry::Find(*Layer->Set);
+        bLayoutChanged = true;
+    }
+
+    if (Layer->Priority != Priority)
+    {
+        Layer->Priority = Priority;
+        bLayoutChanged = true;
+    }
+
+    const bool bActivated = !Layer->bActive;
+    Layer->bActive = true;
+
+    // Registration changes are rare; activating an already registered layer only recombines masks
+    if (bLayoutChanged)
+    {
+        SortLayers();
+        BuildShadowMasks();
+    }
+
+    if (bLayoutChanged || bActivated)
+    {
+        RefreshShadowing();
+    }
+}
+
+bool UMCS_AttackChooser::SetLayerActive(const FGameplayTag& LayerTag, bool bActive)
+{
+    for (FMCS_AttackLayer& Layer : Layers)
+    {
+        if (Layer.Tag == LayerTag)
+        {
+            if (Layer.bActive != bActive)
+            {
+                Layer.bActive = bActive;
+                RefreshShadowing();
+            }
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool UMCS_AttackChooser::IsLayerActive(const FGameplayTag& LayerTag) const
+{
+    const FMCS_AttackLayer* Layer = Layers.FindByPredicate([ &LayerTag ] (const FMCS_AttackLayer& Existing) { return Existing.Tag == LayerTag; });
+    return Layer && Layer->bActive;
+}
+
+void UMCS_AttackChooser::ResetLayers()
+{
+    Layers.Reset();
+}
+
+void UMCS_AttackChooser::SortLayers()
+{
+    // Stable so layers of equal priority keep registration order
+    Layers.StableSort([ ] (const FMCS_AttackLayer& A, const FMCS_AttackLayer& B) { return A.Priority > B.Priority; });
+
+    int32 FirstIndex = 0;
+    for (FMCS_AttackLayer& Layer : Layers)
+    {
+        Layer.FirstIndex = FirstIndex;
+        FirstIndex += Layer.Set->Num();
+    }
+}
+
+void UMCS_AttackChooser::BuildShadowMasks()
+{
+    LLM_SCOPE_BYTAG(MotionCombat_Choosers);
+
+    for (int32 Upper = 0; Upper < Layers.Num(); ++Upper)
+    {
+        // Names of one layer only, so duplicate names within a layer don't hide each other
+        TSet<FName> Provided;
+        for (const FMCS_AttackEntry& Entry : Layers[Upper].Set->Entries)
+        {
+            if (!Entry.AttackName.IsNone())
+            {
+                Provided.Add(Entry.AttackName);
+            }
+        }
+
+        for (int32 Lower = Upper + 1; Lower < Layers.Num(); ++Lower)
+        {
+            const TArray<FMCS_AttackEntry>& Entries = Layers[Lower].Set->Entries;
+            TArray<TBitArray<>>& Masks = Layers[Lower].ShadowMasks;
+            Masks.SetNum(Lower);
+
+            TBitArray<>& Mask = Masks[Upper];
+            Mask.Init(false, Entries.Num());
+            for (int32 i = 0; i < Entries.Num(); ++i)
+            {
+                if (Provided.Contains(Entries[i].AttackName))
+                {
+                    Mask[i] = true;
+                }
+            }
+        }
+    }
+
+    if (Layers.Num() > 0)
+    {
+        Layers[0].ShadowMasks.Reset();
+    }
+}
+
+void UMCS_AttackChooser::RefreshShadowing()
+{
+    for (int32 Lower = 0; Lower < Layers.Num(); ++Lower)
+    {
+        FMCS_AttackLayer& Layer = Layers[Lower];
+        Layer.Shadowed.Init(false, Layer.Set->Num());
+
+        if (!Layer.bActive)
+        {
+            continue;
+        }
+
+        for (int32 Upper = 0; Upper < Lower; ++Upper)
+        {
+            if (Layers[Upper].bActive)
+            {
+                Layer.Shadowed.CombineWithBitwiseOR(Layer.ShadowMasks[Upper], EBitwiseOperatorFlags::MaintainSize);
+            }
+        }
+    }
+}
+
+int32 UMCS_AttackChooser::NumEntries() const
+{
+    if (Layers.IsEmpty())
+    {
+        return AttackEntries.Num();
+    }
+
+    const FMCS_AttackLayer& Last = Layers.Last();
+    return Last.FirstIndex + Last.Set->Num();
+}
+
+int32 UMCS_AttackChooser::FindLayerForIndex(int32 EntryIndex, int32& OutLocalIndex) const
+{
+    for (int32 LayerIndex = 0; LayerIndex < Layers.Num(); ++LayerIndex)
+    {
+        const FMCS_AttackLayer& Layer = Layers[LayerIndex];
+        if (EntryIndex >= Layer.FirstIndex && EntryIndex < Layer.FirstIndex + Layer.Set->Num())
+        {
+            OutLocalIndex = EntryIndex - Layer.FirstIndex;
+            return LayerIndex;
+        }
+    }
+
+    OutLocalIndex = INDEX_NONE;
+    return INDEX_NONE;
+}
+
+const FMCS_AttackEntry* UMCS_AttackChooser::GetEntry(int32 EntryIndex) const
+{
+    if (Layers.IsEmpty())
+    {
+        return AttackEntries.IsValidIndex(EntryIndex) ? &AttackEntries[EntryIndex] : nullptr;
+    }
+
+    int32 LocalIndex;
+    const int32 LayerIndex = FindLayerForIndex(EntryIndex, LocalIndex);
+    return LayerIndex != INDEX_NONE ? &Layers[LayerIndex].Set->Entries[LocalIndex] : nullptr;
+}
+
+int32 UMCS_AttackChooser::FindEntryIndex(FName AttackName) const
+{
+    if (Layers.IsEmpty())
+    {
+        return AttackEntries.IndexOfByPredicate([ AttackName ] (const FMCS_AttackEntry& Entry) { return Entry.AttackName == AttackName; });
+    }
+
+    // Highest priority first, so the first hit is the one that shadows the others
+    for (const FMCS_AttackLayer& Layer : Layers)
+    {
+        if (!Layer.bActive)
+        {
+            continue;
+        }
+
+        const int32 LocalIndex = Layer.Set->FindIndex(AttackName);
+        if (LocalIndex != INDEX_NONE)
+        {
+            return Layer.FirstIndex + LocalIndex;
+        }
+    }
+
+    return INDEX_NONE;
+}
+
+TArray<FMCS_AttackEntry> UMCS_AttackChooser::GetAttackEntries() const
+{
+    if (Layers.IsEmpty())
+    {
+        return AttackEntries;
+    }
+
+    TArray<FMCS_AttackEntry> Merged;
+    for (const FMCS_AttackLayer& Layer : Layers)
+    {
+        if (!Layer.bActive)
+        {
+            continue;
+        }
+
+        for (int32 i = 0; i < Layer.Set->Num(); ++i)
+        {
+            if (!Layer.Shadowed[i])
+            {
+                Merged.Add(Layer.Set->Entries[i]);
+            }
+        }
+    }
+
+    return Merged;
+}
+
+void UMCS_AttackChooser::MarkAttackUsed(int32 EntryIndex, float WorldTime)
+{
+    if (Layers.IsEmpty())
+    {
+        SyncMemory();
+        Memory.MarkUsed(AttackEntries, EntryIndex, WorldTime);
+        return;
+    }
+
+    int32 LocalIndex;
+    const int32 LayerIndex = FindLayerForIndex(EntryIndex, LocalIndex);
+    if (LayerIndex == INDEX_NONE)
+    {
+        return;
+    }
+
+    FMCS_AttackLayer& UsedLayer = Layers[LayerIndex];
+    UsedLayer.Memory.MarkUsed(UsedLayer.Set->Entries, LocalIndex, WorldTime);
+
+    // Cooldown groups are shared across layers (e.g. a stance variant of a base attack)
+    const FMCS_AttackEntry& Used = UsedLayer.Set->Entries[LocalIndex];
+    if (!Used.CooldownGroup.IsNone())
+    {
+        for (FMCS_AttackLayer& Layer : Layers)
+        {
+            if (&Layer != &UsedLayer)
+            {
+                Layer.Memory.ApplyGroupCooldown(Layer.Set->Entries, Used.CooldownGroup, WorldTime + Used.Cooldown);
+            }
+        }
+    }
+}
+
+bool UMCS_AttackChooser::IsAttackReady(int32 EntryIndex, float WorldTime) const
+{
+    if (Layers.IsEmpty())
+    {
+        SyncMemory();
+        return Memory.IsReady(EntryIndex, WorldTime);
+    }
+
+    int32 LocalIndex;
+    const int32 LayerIndex = FindLayerForIndex(EntryIndex, LocalIndex);
+    return LayerIndex != INDEX_NONE && Layers[LayerIndex].Memory.IsReady(LocalIndex, WorldTime);
+}
+
+void UMCS_AttackChooser::GetResourceSizeEx(FResourceSizeEx& CumulativeResourceSize)
+{
+    Super::GetResourceSizeEx(CumulativeResourceSize);
+
+    SIZE_T Size = AttackEntries.GetAllocatedSize() + Layers.GetAllocatedSize() + Memory.GetAllocatedSize() + PenaltyScratch.GetAllocatedSize()
+        + CandidateScratch.GetAllocatedSize();
+    for (const FMCS_AttackLayer& Layer : Layers)
+    {
+        Size += Layer.Memory.GetAllocatedSize() + Layer.Shadowed.GetAllocatedSize() + Layer.ShadowMasks.GetAllocatedSize();
+        for (const TBitArray<>& Mask : Layer.ShadowMasks)
+        {
+            Size += Mask.GetAllocatedSize();
+        }
+    }
+
+    CumulativeResourceSize.AddDedicatedSystemMemoryBytes(Size);
+}
+
+void UMCS_AttackChooser::SyncMemory() const
+{
+    // AttackEntries can be edited from Blueprint at any time; compiled layers never change size
+    if (Layers.IsEmpty() && Memory.Num() != AttackEntries.Num())
+    {
+        LLM_SCOPE_BYTAG(MotionCombat_Choosers);
+        Memory.Rebuild(AttackEntries);
+    }
 }
 
 
@@ -124,7 +709,7 @@ float UMCS_AttackChooser::ScoreAttack_Implementation(
     const float TagScore = ComputeTagScore(Entry);
     const float DistanceScore = ComputeDistanceScore(Entry, Instigator, Targets);
     const float DirectionScore = ComputeDirectionalScore(Entry, DesiredDirection);
-    const float SituationScore = ComputeSituationScore(Entry, CurrentSituation);
+    const float SituationScore = ComputeSituationScore(Entry, CurrentSituation, Instigator);
 
     /* -----------------------------------------------------------------
       Clean logging helpers: clamp or label disqualified values
@@ -193,62 +778,23 @@ float UMCS_AttackChooser::ComputeTagScore(const FMCS_AttackEntry& Entry) const
  */
 float UMCS_AttackChooser::ComputeDistanceScore(const FMCS_AttackEntry& Entry, AActor* Instigator, const TArray<AActor*>& Targets) const
 {
-    // Guard checks
-    if (!IsValid(Instigator) || Targets.IsEmpty())
+    // No instigator or valid target: no distance score
+    const float Distance = MCS_AttackIndex::GetClosestTargetDistance(Instigator, Targets);
+    if (Distance < 0.f)
         return 0.f;
 
-    AActor* ClosestTarget = nullptr;
-    float ClosestDistSq = TNumericLimits<float>::Max();
-    const FVector InstigatorLoc = Instigator->GetActorLocation();
+    const float DistanceScore = MCS_NativeScoring::DistanceScore(Distance, Entry.RangeStart, Entry.RangeEnd);
 
-    // Find closest valid target
-    for (AActor* Target : Targets)
+    if (DistanceScore == MCS_NativeScoring::Disqualified)
     {
-        if (!IsValid(Target))
-            continue;
-
-        const float DistSq = FVector::DistSquared(InstigatorLoc, Target->GetActorLocation());
-        if (DistSq < ClosestDistSq)
-        {
-            ClosestDistSq = DistSq;
-            ClosestTarget = Target;
-        }
+        UE_LOG(LogTemp, Warning, TEXT("[Chooser] Attack '%s' disqualified (out of range %.0f)."), *Entry.AttackName.ToString(), Distance);
     }
-
-    if (!ClosestTarget)
-        return 0.f;
-
-    const float Distance = FMath::Sqrt(ClosestDistSq);
-
-    // Disqualify if completely outside the valid attack window
-    if (Distance < Entry.RangeStart || Distance > Entry.RangeEnd)
+    else if (Distance >= Entry.RangeStart && Distance <= Entry.RangeEnd)
     {
-        // If too far beyond 25% buffer, treat as invalid (disqualified)
-        if (Distance > Entry.RangeEnd * 1.25f)
-        {
-            UE_LOG(LogTemp, Warning, TEXT("[Chooser] Attack '%s' disqualified (out of range %.0f)."), *Entry.AttackName.ToString(), Distance);
-            return -TNumericLimits<float>::Max();
-        }
-
-        // Small soft penalty if near the edge of the valid window
-        const float Overshoot = FMath::Abs(Distance - (Distance < Entry.RangeStart ? Entry.RangeStart : Entry.RangeEnd));
-        return -(Overshoot * 0.1f);
+        UE_LOG(LogTemp, Warning, TEXT("[MCS_AttackChooser] DistanceScore for '%s': Dist=%.1f | Mid=%.1f | Score=%.2f"),
+            *Entry.AttackName.ToString(), Distance, (Entry.RangeStart + Entry.RangeEnd) * 0.5f, DistanceScore);
     }
 
-    // Inside valid range — apply smooth scoring curve centered in window
-    const float RangeMid = (Entry.RangeStart + Entry.RangeEnd) * 0.5f;
-    const float RangeDelta = FMath::Abs(Distance - RangeMid);
-    const float RangeTolerance = (Entry.RangeEnd - Entry.RangeStart) * 0.5f;
-
-    // Normalized 0 (edge) → 1 (perfect center)
-    const float Normalized = 1.f - FMath::Clamp(RangeDelta / RangeTolerance, 0.f, 1.f);
-
-    // Map to -10..+10 scoring range
-    const float DistanceScore = (Normalized * 20.f) - 10.f;
-
-    UE_LOG(LogTemp, Warning, TEXT("[MCS_AttackChooser] DistanceScore for '%s': Dist=%.1f | Mid=%.1f | Score=%.2f"),
-        *Entry.AttackName.ToString(), Distance, RangeMid, DistanceScore);
-
     return DistanceScore;
 }
 
@@ -259,86 +805,21 @@ float UMCS_AttackChooser::ComputeDistanceScore(const FMCS_AttackEntry& Entry, AA
  */
 float UMCS_AttackChooser::ComputeDirectionalScore(const FMCS_AttackEntry& Entry, EMCS_AttackDirection DesiredDirection) const
 {
-    if (Entry.AttackDirection == EMCS_AttackDirection::Omni)
-        return 5.f;
-    if (Entry.AttackDirection == DesiredDirection)
-        return 10.f;
-
-    // Opposite penalties
-    if ((Entry.AttackDirection == EMCS_AttackDirection::Forward && DesiredDirection == EMCS_AttackDirection::Backward) ||
-        (Entry.AttackDirection == EMCS_AttackDirection::Backward && DesiredDirection == EMCS_AttackDirection::Forward) ||
-        (Entry.AttackDirection == EMCS_AttackDirection::Left && DesiredDirection == EMCS_AttackDirection::Right) ||
-        (Entry.AttackDirection == EMCS_AttackDirection::Right && DesiredDirection == EMCS_AttackDirection::Left))
-    {
-        return -10.f;
-    }
-
-    return 0.f;
+    return MCS_NativeScoring::DirectionScore(Entry.AttackDirection, DesiredDirection);
 }
 
-float UMCS_AttackChooser::ComputeSituationScore(const FMCS_AttackEntry& Entry, const FMCS_AttackSituation& CurrentSituation) const
+float UMCS_AttackChooser::ComputeSituationScore(const FMCS_AttackEntry& Entry, const FMCS_AttackSituation& CurrentSituation, AActor* Instigator) const
 {
-    float Score = 0.f;
-
-    switch (Entry.AttackSituation)
-    {
-        case EMCS_AttackSituations::Grounded:
-            if (CurrentSituation.bIsGrounded) Score += 10.f;
-            else if (CurrentSituation.bIsInAir) Score -= 10.f;
-            break;
-
-        case EMCS_AttackSituations::Airborne:
-            if (CurrentSituation.bIsInAir) Score += 15.f;
-            else Score -= 10.f;
-            break;
-
-        case EMCS_AttackSituations::Running:
-            if (CurrentSituation.bIsRunning) Score += 10.f;
-            break;
-
-        case EMCS_AttackSituations::Crouching:
-            if (CurrentSituation.bIsCrouching) Score += 10.f;
-            break;
-
-        case EMCS_AttackSituations::Counter:
-            if (CurrentSituation.bIsCountering) Score += 20.f;
-            break;
-
-        case EMCS_AttackSituations::Parry:
-            if (CurrentSituation.bIsParrying) Score += 25.f;
-            break;
-
-        case EMCS_AttackSituations::Riposte:
-            if (CurrentSituation.bIsRiposting) Score += 30.f;
-            break;
-
-        case EMCS_AttackSituations::Finisher:
-            if (CurrentSituation.bIsFinishing) Score += 25.f;
-            break;
-
-        case EMCS_AttackSituations::Any:
-        default:
-            Score += 5.f; // always somewhat valid
-            break;
-    }
+    float Score = MCS_NativeScoring::SituationScore(Entry.AttackSituation, CurrentSituation);
 
     // ----------------------------------------------------------
     // Extended quantitative condition checks (designer-defined)
     // ----------------------------------------------------------
     for (const FMCS_AttackCondition& Condition : Entry.ConditionalChecks)
     {
-        const float CurrentValue = QueryAttributeValue(Condition.AttributeName, CurrentSituation);
+        const float CurrentValue = QueryAttributeValue(Condition.AttributeName, CurrentSituation, Instigator);
 
-        bool bPass = false;
-        switch (Condition.Comparison)
-        {
-            case EMCS_ComparisonMethod::Equal:          bPass = FMath::IsNearlyEqual(CurrentValue, Condition.Threshold, 0.01f); break;
-            case EMCS_ComparisonMethod::NotEqual:       bPass = !FMath::IsNearlyEqual(CurrentValue, Condition.Threshold, 0.01f); break;
-            case EMCS_ComparisonMethod::Greater:        bPass = CurrentValue > Condition.Threshold; break;
-            case EMCS_ComparisonMethod::Less:           bPass = CurrentValue < Condition.Threshold; break;
-            case EMCS_ComparisonMethod::GreaterOrEqual: bPass = CurrentValue >= Condition.Threshold; break;
-            case EMCS_ComparisonMethod::LessOrEqual:    bPass = CurrentValue <= Condition.Threshold; break;
-        }
+        const bool bPass = MCS_NativeScoring::ConditionPasses(Condition.Comparison, CurrentValue, Condition.Threshold);
 
         // New logic: hard disqualify if required
         if (Condition.bMustPass && !bPass)
@@ -410,12 +891,18 @@ bool UMCS_AttackChooser::IsEntryAllowedByBasicFilters(const FMCS_AttackEntry& En
 /**
  * Queries numeric attributes from the current situation context.
  * Extend this function to expose new values (e.g., Stamina, Altitude, etc.)
+ * The GenerateAttackScorers commandlet mirrors this mapping; extend both.
  */
-float UMCS_AttackChooser::QueryAttributeValue(FName Attribute, const FMCS_AttackSituation& Situation) const
+float UMCS_AttackChooser::QueryAttributeValue(FName Attribute, const FMCS_AttackSituation& Situation, const AActor* Instigator) const
 {
     if (Attribute == "Speed")     return Situation.Speed;
     if (Attribute == "Altitude")  return Situation.Altitude;
-    if (Attribute == "Stamina")   return Situation.Stamina;
+    if (Attribute == "Stamina")
+    {
+        // The resource store is authoritative; the situation's value is for actors without a resource slot
+        const float Available = UMCS_ResourceSubsystem::GetAvailableStamina(Instigator);
+        return Available < MAX_flt ? Available : Situation.Stamina;
+    }
     if (Attribute == "Health")    return Situation.HealthPercent;
     // Extend as needed
     return 0.f;
@@ -21,6 +21,19 @@
 #include "Math/UnrealMathUtility.h"
 #include "DrawDebugHelpers.h"
 #include "Engine/Engine.h"
+#include <SubSystems/MCS_ResourceSubsystem.h>
+#include <SubSystems/MCS_CombatBudgetSubsystem.h>
+#include <Stats/MCS_Stats.h>
+
+namespace MCS_Defense
+{
+    /** Stand-in for a per-entry FRandRange(-5, 5): one random seed per query, hashed with the entry index */
+    float ScoreJitter(uint32 Seed, int32 Index)
+    {
+        const uint32 Hash = HashCombineFast(Seed, static_cast<uint32>(Index));
+        return static_cast<float>(Hash & 0xFFFF) * (10.f / 65535.f) - 5.f;
+    }
+}
 
 
 /**
@@ -32,58 +45,243 @@ UMCS_DefenseChooser::UMCS_DefenseChooser(const FObjectInitializer& ObjectInitial
     // Constructor logic (if any) goes here
 }
 
+void UMCS_DefenseChooser::SetCompiledSet(TSharedPtr<const FMCS_CompiledDefenseSet> InCompiledSet)
+{
+    CompiledSet = MoveTemp(InCompiledSet);
+    bSharedCompiledSet = CompiledSet.IsValid();
+}
+
+void UMCS_DefenseChooser::MarkEntriesDirty()
+{
+    if (!bSharedCompiledSet)
+    {
+        CompiledSet.Reset();
+    }
+}
+
+#if WITH_EDITOR
+void UMCS_DefenseChooser::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+    Super::PostEditChangeProperty(PropertyChangedEvent);
+
+    // Same-size edits don't change the count GetCompiledSet checks
+    if (PropertyChangedEvent.GetMemberPropertyName() == GET_MEMBER_NAME_CHECKED(UMCS_DefenseChooser, DefenseEntries))
+    {
+        MarkEntriesDirty();
+    }
+}
+#endif
+
+const FMCS_CompiledDefenseSet& UMCS_DefenseChooser::GetCompiledSet() const
+{
+    // DefenseEntries may be edited from Blueprint; a count change is the cheap staleness check,
+    // other edits go through MarkEntriesDirty
+    if (!CompiledSet.IsValid() || (!bSharedCompiledSet && CompiledSet->Num() != DefenseEntries.Num()))
+    {
+        LLM_SCOPE_BYTAG(MotionCombat_Choosers);
+
+        TSharedRef<FMCS_CompiledDefenseSet> Local = MakeShared<FMCS_CompiledDefenseSet>();
+        Local->Build(DefenseEntries);
+        CompiledSet = Local;
+    }
+
+    return *CompiledSet;
+}
+
+void UMCS_DefenseChooser::GetResourceSizeEx(FResourceSizeEx& CumulativeResourceSize)
+{
+    Super::GetResourceSizeEx(CumulativeResourceSize);
+
+    SIZE_T Size = DefenseEntries.GetAllocatedSize() + DistanceScratch.GetAllocatedSize();
+    if (CompiledSet.IsValid() && !bSharedCompiledSet)
+    {
+        Size += sizeof(FMCS_CompiledDefenseSet) + CompiledSet->GetAllocatedSize();
+    }
+
+    CumulativeResourceSize.AddDedicatedSystemMemoryBytes(Size);
+}
+
+TConstArrayView<FMCS_DefenseEntry> UMCS_DefenseChooser::GetDefenseEntries() const
+{
+    return GetCompiledSet().Entries;
+}
+
+const FMCS_DefenseEntry* UMCS_DefenseChooser::GetEntry(int32 Index) const
+{
+    const FMCS_CompiledDefenseSet& Set = GetCompiledSet();
+    return Set.Entries.IsValidIndex(Index) ? &Set.Entries[Index] : nullptr;
+}
+
+bool UMCS_DefenseChooser::UsesCustomScoring() const
+{
+    const UClass* Class = GetClass();
+    if (Class->IsFunctionImplementedInScript(GET_FUNCTION_NAME_CHECKED(UMCS_DefenseChooser, ScoreDefense))
+        || Class->IsFunctionImplementedInScript(GET_FUNCTION_NAME_CHECKED(UMCS_DefenseChooser, CanAttemptDefense)))
+    {
+        return true;
+    }
+
+    // Any native class below this one may override the _Implementation functions
+    while (Class && !Class->HasAnyClassFlags(CLASS_Native))
+    {
+        Class = Class->GetSuperClass();
+    }
+    return Class != UMCS_DefenseChooser::StaticClass();
+}
+
+void UMCS_DefenseChooser::MakeQueryContext(const FMCS_CompiledDefenseSet& Set, AActor* Defender, FMCS_DefenseQueryContext& OutContext) const
+{
+    OutContext.Defender = Defender;
+
+    // Read once from the resource store; defenders without resources are unlimited
+    OutContext.AvailableStamina = UMCS_ResourceSubsystem::GetAvailableStamina(Defender);
+    OutContext.bHasTags = Set.GatherOwnedTags(Defender, OutContext.OwnedTagBits, OutContext.OwnedTags);
+}
+
 /**
- * @brief Evaluates all defensive entries and selects the one with the highest score.
- *
- * This function iterates through each available FMCS_DefenseEntry in DefenseEntries.
- * It calls CanAttemptDefense() to ensure each entry is eligible, then uses ScoreDefense()
- * to calculate a suitability score. The entry with the highest score is chosen as the optimal defense.
+ * @brief Scores every entry against one attacker and returns the best.
  *
- * @param Defender         The actor performing the defensive action.
- * @param Attacker         The actor initiating the attack.
- * @param Intent           The defense intent (Defense or Parry).
- * @param OutChosenEntry   [Out] The resulting defense entry selected by the chooser.
- * @return True if a valid defense was found; false otherwise.
+ * Geometry is computed once for the (defender, attacker) pair. Unless a subclass customizes scoring,
+ * entries are scored from the compiled columns: intent mask, vectorized distance score, direction mask
+ * and a hashed jitter, matching ScoreDefense_Implementation.
  */
-bool UMCS_DefenseChooser::ChooseDefense(AActor* Defender, AActor* Attacker, EMCS_DefenseIntent Intent, FMCS_DefenseEntry& OutChosenEntry)
+int32 UMCS_DefenseChooser::ChooseIndexAgainst(const FMCS_CompiledDefenseSet& Set, const FMCS_DefenseQueryContext& Context, AActor* Attacker, EMCS_DefenseIntent Intent) const
 {
-    if (!Defender || DefenseEntries.IsEmpty())
+    FMCS_BudgetScope BudgetScope(Context.Defender, EMCS_BudgetCategory::Chooser);
+
+    const FMCS_DefenseThreat Threat = FMCS_DefenseThreat::Make(Context.Defender, Attacker);
+    const bool bCustomScoring = UsesCustomScoring();
+
+    // The default scoring rejects every entry without a valid attacker
+    if (!bCustomScoring)
     {
-        UE_LOG(LogTemp, Warning, TEXT("[DefenseChooser] Invalid input or no DefenseEntries available."));
-        return false;
+        if (!Threat.bValid)
+        {
+            return INDEX_NONE;
+        }
+
+        Set.ComputeDistanceScores(Threat.Distance, DistanceScratch);
     }
 
+    const uint8 IntentBit = static_cast<uint8>(1u << static_cast<uint8>(Intent));
+    const uint32 Seed = static_cast<uint32>(FMath::Rand());
+
     float BestScore = -FLT_MAX;
-    bool bFound = false;
+    int32 BestIndex = INDEX_NONE;
 
-    for (const FMCS_DefenseEntry& Entry : DefenseEntries)
+    for (int32 i = 0; i < Set.Num(); ++i)
     {
-        // Skip if not eligible for attempt
-        if (!CanAttemptDefense(Entry, Defender, Attacker))
+        const FMCS_DefenseEntry& Entry = Set.Entries[i];
+
+        if (Entry.StaminaCost > Context.AvailableStamina)
+        {
+            continue;
+        }
+
+        if (Context.bHasTags && !Set.PassesTags(i, Context.OwnedTagBits, Context.OwnedTags))
         {
-            UE_LOG(LogTemp, VeryVerbose, TEXT("[DefenseChooser] Skipping %s (CanAttemptDefense returned false)"), *Entry.DefenseName.ToString());
             continue;
         }
 
-        const float Score = ScoreDefense(Entry, Defender, Attacker, Intent);
+        float Score;
+        if (bCustomScoring)
+        {
+            // Skip if not eligible for attempt
+            if (!CanAttemptDefense(Entry, Context.Defender, Attacker))
+            {
+                UE_LOG(LogTemp, VeryVerbose, TEXT("[DefenseChooser] Skipping %s (CanAttemptDefense returned false)"), *Entry.DefenseName.ToString());
+                continue;
+            }
+
+            Score = ScoreDefense(Entry, Context.Defender, Attacker, Intent);
+        }
+        else
+        {
+            Score = (Set.IntentBits[i] & IntentBit) ? 50.f : -25.f;
+            Score += DistanceScratch[i];
+            Score += (Set.DirectionBits[i] & Threat.DirectionBit) ? 10.f : 0.f;
+            Score += MCS_Defense::ScoreJitter(Seed, i);
+        }
+
         if (Score > BestScore)
         {
             BestScore = Score;
-            OutChosenEntry = Entry;
-            bFound = true;
+            BestIndex = i;
         }
     }
 
-    if (bFound)
+    if (BestIndex != INDEX_NONE)
     {
-        UE_LOG(LogTemp, Log, TEXT("[DefenseChooser] Selected Defense: %s | Score: %.2f"), *OutChosenEntry.DefenseName.ToString(), BestScore);
+        UE_LOG(LogTemp, Verbose, TEXT("[DefenseChooser] Best against %s: %s | Score: %.2f"),
+            *GetNameSafe(Attacker), *Set.Entries[BestIndex].DefenseName.ToString(), BestScore);
     }
-    else
+
+    return BestIndex;
+}
+
+int32 UMCS_DefenseChooser::ChooseDefenseIndex(AActor* Defender, AActor* Attacker, EMCS_DefenseIntent Intent) const
+{
+    const FMCS_CompiledDefenseSet& Set = GetCompiledSet();
+    if (!Defender || Set.Num() == 0)
+    {
+        return INDEX_NONE;
+    }
+
+    FMCS_DefenseQueryContext Context;
+    MakeQueryContext(Set, Defender, Context);
+
+    return ChooseIndexAgainst(Set, Context, Attacker, Intent);
+}
+
+void UMCS_DefenseChooser::ChooseDefensesAgainst(AActor* Defender, TConstArrayView<AActor*> Attackers, EMCS_DefenseIntent Intent, TArray<int32>& OutIndices) const
+{
+    OutIndices.Init(INDEX_NONE, Attackers.Num());
+
+    const FMCS_CompiledDefenseSet& Set = GetCompiledSet();
+    if (!Defender || Set.Num() == 0)
+    {
+        return;
+    }
+
+    FMCS_DefenseQueryContext Context;
+    MakeQueryContext(Set, Defender, Context);
+
+    for (int32 i = 0; i < Attackers.Num(); ++i)
+    {
+        OutIndices[i] = ChooseIndexAgainst(Set, Context, Attackers[i], Intent);
+    }
+}
+
+/**
+ * @brief Evaluates all defensive entries and selects the one with the highest score.
+ *
+ * Thin wrapper over ChooseDefenseIndex(): entries are scored by index and the winner is copied once.
+ * Blueprint overrides of CanAttemptDefense() and ScoreDefense() are still called for every entry.
+ *
+ * @param Defender         The actor performing the defensive action.
+ * @param Attacker         The actor initiating the attack.
+ * @param Intent           The defense intent (Defense or Parry).
+ * @param OutChosenEntry   [Out] The resulting defense entry selected by the chooser.
+ * @return True if a valid defense was found; false otherwise.
+ */
+bool UMCS_DefenseChooser::ChooseDefense(AActor* Defender, AActor* Attacker, EMCS_DefenseIntent Intent, FMCS_DefenseEntry& OutChosenEntry)
+{
+    if (!Defender || GetCompiledSet().Num() == 0)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("[DefenseChooser] Invalid input or no DefenseEntries available."));
+        return false;
+    }
+
+    const int32 ChosenIndex = ChooseDefenseIndex(Defender, Attacker, Intent);
+    if (ChosenIndex == INDEX_NONE)
     {
         UE_LOG(LogTemp, Warning, TEXT("[DefenseChooser] No valid defense found."));
+        return false;
     }
 
-    return bFound;
+    OutChosenEntry = *GetEntry(ChosenIndex);
+    UE_LOG(LogTemp, Log, TEXT("[DefenseChooser] Selected Defense: %s"), *OutChosenEntry.DefenseName.ToString());
+    return true;
 }
 
 /**
@@ -184,14 +382,14 @@ float UMCS_DefenseChooser::ScoreFacing(const FMCS_DefenseEntry& Entry, AActor* D
     if (!IsValid(Defender) || !IsValid(Attacker))
         return 0.0f;
 
-    const FVector ToAttacker = (Attacker->GetActorLocation() - Defender->GetActorLocation()).GetSafeNormal();
-    const float Facing = FVector::DotProduct(Defender->GetActorForwardVector(), ToAttacker);
+    if (Entry.ValidDirection == EMCS_AttackDirection::Omni)
+        return 0.0f;
 
-    if (Entry.ValidDirection == EMCS_AttackDirection::Forward && Facing > 0.25f)
-    {
-        return 10.f;
-    }
-    return 0.0f;
+    // Same side classification the compiled scoring uses (Forward = ~75° frontal cone)
+    const FMCS_DefenseThreat Threat = FMCS_DefenseThreat::Make(Defender, Attacker);
+    const uint8 DirectionBit = static_cast<uint8>(1u << static_cast<uint8>(Entry.ValidDirection));
+
+    return (Threat.DirectionBit & DirectionBit) ? 10.f : 0.0f;
 }
 
 /**
@@ -248,14 +446,18 @@ void UMCS_DefenseChooser::DrawDebugDistanceScores(AActor* Defender, AActor* Atta
     }
 
     // Iterate over all defense entries to visualize score by range
-    for (const FMCS_DefenseEntry& Entry : DefenseEntries)
+    const FMCS_CompiledDefenseSet& Set = GetCompiledSet();
+    Set.ComputeDistanceScores(ActualDist, DistanceScratch);
+
+    for (int32 i = 0; i < Set.Num(); ++i)
     {
-        const float Score = ScoreDistance(Entry, Defender, Attacker);
+        const FMCS_DefenseEntry& Entry = Set.Entries[i];
+        const float Score = DistanceScratch[i];
 
         // Compute color based on score
         FColor ScoreColor = FColor::MakeRedToGreenColorFromScalar((Score + 25.f) / 50.f);
 
-        const FVector TextPos = DefenderLoc + FVector(0, 0, 100 + (&Entry - DefenseEntries.GetData()) * 15);
+        const FVector TextPos = DefenderLoc + FVector(0, 0, 100 + i * 15);
 
         // Draw entry name + score
         if (GEngine)
@@ -0,0 +1,55 @@
+/*
+ * ========================================================================
+ * Copyright © 2025 God's Studio
+ * All Rights Reserved.
+ *
+ * Free for all to use, copy, and distribute. I hope you learn from this as I learned creating it.
+ * =============================================================================
+ *
+ * Project: Motion Combat System
+ * This is a combat system inspired by Unreal Engine’s Motion Matching plugin.
+ * Author: Christopher D. Parker
+ * Date: 10-18-2026
+ * =============================================================================
+ * MCS_NativeScorer.cpp
+ * Registry of generated attack set scorers.
+ */
+
+#include <Choosers/MCS_NativeScorer.h>
+
+TMap<FName, FMCS_NativeScorer>& FMCS_NativeScorerRegistry::GetScorers()
+{
+    static TMap<FName, FMCS_NativeScorer> Scorers;
+    return Scorers;
+}
+
+void FMCS_NativeScorerRegistry::Register(FName SetId, const FMCS_NativeScorer& Scorer)
+{
+    check(IsInGameThread());
+    GetScorers().Add(SetId, Scorer);
+}
+
+void FMCS_NativeScorerRegistry::Unregister(FName SetId)
+{
+    check(IsInGameThread());
+    GetScorers().Remove(SetId);
+}
+
+FMCS_NativeScorer FMCS_NativeScorerRegistry::Find(const FMCS_CompiledAttackSet& Set)
+{
+    const FMCS_NativeScorer* Scorer = Set.SetId.IsNone() ? nullptr : GetScorers().Find(Set.SetId);
+    if (!Scorer)
+    {
+        return FMCS_NativeScorer();
+    }
+
+    // Generated code bakes the rows in; any edit since generation means it no longer scores this table
+    if (Scorer->NumEntries != Set.Num() || Scorer->ScoringHash != Set.ComputeScoringHash())
+    {
+        UE_LOG(LogTemp, Warning, TEXT("[NativeScorer] %s changed since its scorer was generated; using data-driven scoring. Rerun the GenerateAttackScorers commandlet."),
+            *Set.SetId.ToString());
+        return FMCS_NativeScorer();
+    }
+
+    return *Scorer;
+}
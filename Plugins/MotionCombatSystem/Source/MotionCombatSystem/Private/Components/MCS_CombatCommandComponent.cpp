@@ -0,0 +1,353 @@
+/*
+ * ========================================================================
+ * Copyright © 2025 God's Studio
+ * All Rights Reserved.
+ *
+ * Free for all to use, copy, and distribute. I hope you learn from this as I learned creating it.
+ * =============================================================================
+ *
+ * Project: Motion Combat System
+ * This is a combat system inspired by Unreal Engine’s Motion Matching plugin.
+ * Author: Christopher D. Parker
+ * Date: 10-18-2026
+ * =============================================================================
+ * MCS_CombatCommandComponent.cpp
+ * Implements command input buffering and recognition.
+ */
+
+#include <Components/MCS_CombatCommandComponent.h>
+#include <Components/MCS_CombatCoreComponent.h>
+#include <SubSystems/MCS_LatencySubsystem.h>
+#include "Engine/World.h"
+#include "TimerManager.h"
+#include "HAL/PlatformTime.h"
+
+namespace MCS_Command
+{
+    /** Maps Light/Heavy/Special (and their releases) to 0..2, or INDEX_NONE */
+    static int32 GetButtonIndex(EMCS_CommandInput Input)
+    {
+        switch (Input)
+        {
+            case EMCS_CommandInput::Light:
+            case EMCS_CommandInput::LightRelease:   return 0;
+            case EMCS_CommandInput::Heavy:
+            case EMCS_CommandInput::HeavyRelease:   return 1;
+            case EMCS_CommandInput::Special:
+            case EMCS_CommandInput::SpecialRelease: return 2;
+            default:                                return INDEX_NONE;
+        }
+    }
+
+    static const EMCS_CommandInput ReleaseInputs[3] = { EMCS_CommandInput::LightRelease, EMCS_CommandInput::HeavyRelease, EMCS_CommandInput::SpecialRelease };
+    static const EMCS_AttackType ButtonAttackTypes[3] = { EMCS_AttackType::Light, EMCS_AttackType::Heavy, EMCS_AttackType::Special };
+}
+
+// Constructor
+UMCS_CombatCommandComponent::UMCS_CombatCommandComponent()
+{
+    PrimaryComponentTick.bCanEverTick = false;
+}
+
+void UMCS_CombatCommandComponent::BeginPlay()
+{
+    Super::BeginPlay();
+
+    if (AActor* Owner = GetOwner())
+    {
+        CombatCore = Owner->FindComponentByClass<UMCS_CombatCoreComponent>();
+    }
+
+    RebuildCommands();
+}
+
+void UMCS_CombatCommandComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    ClearHeldFallback();
+
+    Super::EndPlay(EndPlayReason);
+}
+
+#if WITH_EDITOR
+void UMCS_CombatCommandComponent::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+    Super::PostEditChangeProperty(PropertyChangedEvent);
+
+    // Keep the automaton in sync when commands are edited while playing
+    if (PropertyChangedEvent.GetMemberPropertyName() == GET_MEMBER_NAME_CHECKED(UMCS_CombatCommandComponent, Commands))
+    {
+        RebuildCommands();
+    }
+}
+#endif
+
+void UMCS_CombatCommandComponent::RebuildCommands()
+{
+    Automaton.Build(Commands);
+
+    for (bool& bUsed : bReleaseUsed)
+    {
+        bUsed = false;
+    }
+
+    MaxCommandDuration = 0.f;
+
+    for (const FMCS_CommandDefinition& Command : Commands)
+    {
+        MaxCommandDuration = FMath::Max(MaxCommandDuration, Command.MaxDuration);
+
+        for (const EMCS_CommandInput Input : Command.Sequence)
+        {
+            for (int32 i = 0; i < 3; ++i)
+            {
+                bReleaseUsed[i] |= (Input == MCS_Command::ReleaseInputs[i]);
+            }
+        }
+    }
+
+    History.Reset();
+    CurrentState = 0;
+    ClearHeldFallback();
+
+    if (bDebug)
+    {
+        UE_LOG(LogTemp, Log, TEXT("[CombatCommand] Compiled %d commands into %d states."), Commands.Num(), Automaton.NumStates());
+    }
+}
+
+void UMCS_CombatCommandComponent::PushDirectionalInput(const FVector2D& MoveInput)
+{
+    if (!MCS_NetRole::ShouldExecute(this, NetExecution))
+    {
+        return;
+    }
+
+    EMCS_CommandInput Direction = EMCS_CommandInput::MAX;
+
+    if (MoveInput.Size() >= DirectionDeadZone && CombatCore)
+    {
+        switch (CombatCore->GetAttackDirection(MoveInput))
+        {
+            case EMCS_AttackDirection::Forward:  Direction = EMCS_CommandInput::Forward; break;
+            case EMCS_AttackDirection::Backward: Direction = EMCS_CommandInput::Back; break;
+            case EMCS_AttackDirection::Left:     Direction = EMCS_CommandInput::Left; break;
+            case EMCS_AttackDirection::Right:    Direction = EMCS_CommandInput::Right; break;
+            default: break;
+        }
+    }
+
+    // Edge triggered: only a change of direction is an input; neutral just re-arms
+    if (Direction == LastDirection)
+    {
+        return;
+    }
+
+    LastDirection = Direction;
+    if (Direction == EMCS_CommandInput::MAX)
+    {
+        return;
+    }
+
+    FMCS_InputEvent Event;
+    Event.Input = Direction;
+    Event.Timestamp = FPlatformTime::Seconds();
+    ProcessInput(Event);
+}
+
+void UMCS_CombatCommandComponent::PushButtonPressed(EMCS_CommandInput Button)
+{
+    if (!MCS_NetRole::ShouldExecute(this, NetExecution))
+    {
+        return;
+    }
+
+    const int32 ButtonIndex = MCS_Command::GetButtonIndex(Button);
+    if (ButtonIndex == INDEX_NONE)
+    {
+        return;
+    }
+
+    FMCS_InputEvent Event;
+    Event.Input = Button;
+    Event.Timestamp = FPlatformTime::Seconds();
+    PressTimestamps[ButtonIndex] = Event.Timestamp;
+
+    if (UMCS_LatencySubsystem* Latency = UMCS_LatencySubsystem::Get(this))
+    {
+        Latency->MarkInput(GetOwner());
+    }
+
+    if (ProcessInput(Event) || !bFallbackToPlainAttack)
+    {
+        return;
+    }
+
+    // A press that only advances a command (the start of a charge) waits to see how it resolves
+    if (Automaton.HasPendingCommands(CurrentState))
+    {
+        ReleaseHeldFallback();
+        HoldFallback(ButtonIndex);
+        return;
+    }
+
+    ExecuteAttack(MCS_Command::ButtonAttackTypes[ButtonIndex], GetHeldAttackDirection(), NAME_None);
+}
+
+void UMCS_CombatCommandComponent::PushButtonReleased(EMCS_CommandInput Button)
+{
+    if (!MCS_NetRole::ShouldExecute(this, NetExecution))
+    {
+        return;
+    }
+
+    const int32 ButtonIndex = MCS_Command::GetButtonIndex(Button);
+
+    // Releases only matter when a command uses them; skipping them keeps tap-tap sequences contiguous
+    if (ButtonIndex == INDEX_NONE || !bReleaseUsed[ButtonIndex])
+    {
+        return;
+    }
+
+    FMCS_InputEvent Event;
+    Event.Input = MCS_Command::ReleaseInputs[ButtonIndex];
+    Event.Timestamp = FPlatformTime::Seconds();
+    Event.HoldTime = static_cast<float>(Event.Timestamp - PressTimestamps[ButtonIndex]);
+    ProcessInput(Event);
+}
+
+bool UMCS_CombatCommandComponent::ProcessInput(const FMCS_InputEvent& Event)
+{
+    History.Push(Event);
+    CurrentState = Automaton.Advance(CurrentState, Event.Input);
+
+    //----------------------------------------
+    // Pick the best command completed on this input
+    //----------------------------------------
+    const FMCS_CommandDefinition* Best = nullptr;
+
+    for (const int32 CommandIndex : Automaton.GetMatches(CurrentState))
+    {
+        const FMCS_CommandDefinition& Command = Commands[CommandIndex];
+        if (!IsCommandTimingValid(Command))
+        {
+            continue;
+        }
+
+        if (!Best || Command.Priority > Best->Priority ||
+            (Command.Priority == Best->Priority && Command.Sequence.Num() > Best->Sequence.Num()))
+        {
+            Best = &Command;
+        }
+    }
+
+    if (!Best)
+    {
+        // No command can follow any more: the held press was a plain attack after all
+        if (!Automaton.HasPendingCommands(CurrentState))
+        {
+            ReleaseHeldFallback();
+        }
+        return false;
+    }
+
+    if (bDebug)
+    {
+        UE_LOG(LogTemp, Log, TEXT("[CombatCommand] Recognized command: %s"), *Best->CommandName.ToString());
+    }
+
+    // Consume the sequence so its tail can't immediately retrigger a shorter command
+    CurrentState = 0;
+    ClearHeldFallback();
+
+    OnCommandRecognized.Broadcast(Best->CommandName);
+    ExecuteAttack(Best->AttackType, Best->AttackDirection, Best->AttackName);
+    return true;
+}
+
+bool UMCS_CombatCommandComponent::IsCommandTimingValid(const FMCS_CommandDefinition& Command) const
+{
+    const int32 Length = Command.Sequence.Num();
+    if (Length == 0 || History.Num() < Length)
+    {
+        return false;
+    }
+
+    const FMCS_InputEvent& Last = History.GetFromNewest(0);
+    const FMCS_InputEvent& First = History.GetFromNewest(Length - 1);
+
+    if (Last.Timestamp - First.Timestamp > Command.MaxDuration)
+    {
+        return false;
+    }
+
+    return Command.MinChargeTime <= 0.f || Last.HoldTime >= Command.MinChargeTime;
+}
+
+void UMCS_CombatCommandComponent::HoldFallback(int32 ButtonIndex)
+{
+    HeldFallbackButton = ButtonIndex;
+    HeldFallbackDirection = GetHeldAttackDirection();
+
+    if (UWorld* World = GetWorld())
+    {
+        World->GetTimerManager().SetTimer(HeldFallbackTimer, this, &UMCS_CombatCommandComponent::ReleaseHeldFallback,
+            FMath::Max(MaxCommandDuration, KINDA_SMALL_NUMBER), false);
+    }
+}
+
+void UMCS_CombatCommandComponent::ReleaseHeldFallback()
+{
+    if (HeldFallbackButton == INDEX_NONE)
+    {
+        return;
+    }
+
+    const EMCS_AttackType Type = MCS_Command::ButtonAttackTypes[HeldFallbackButton];
+    const EMCS_AttackDirection Direction = HeldFallbackDirection;
+    ClearHeldFallback();
+
+    ExecuteAttack(Type, Direction, NAME_None);
+}
+
+void UMCS_CombatCommandComponent::ClearHeldFallback()
+{
+    HeldFallbackButton = INDEX_NONE;
+
+    if (UWorld* World = GetWorld())
+    {
+        World->GetTimerManager().ClearTimer(HeldFallbackTimer);
+    }
+}
+
+void UMCS_CombatCommandComponent::ExecuteAttack(EMCS_AttackType Type, EMCS_AttackDirection Direction, FName AttackName)
+{
+    if (!CombatCore)
+    {
+        return;
+    }
+
+    const FMCS_AttackSituation Situation = CombatCore->PlayerSituation;
+
+    if (AttackName != NAME_None && CombatCore->PerformNamedAttack(AttackName, Situation))
+    {
+        return;
+    }
+
+    // Chain if a combo window is open, otherwise start a new attack
+    if (!CombatCore->TryContinueCombo(Type, Direction, Situation))
+    {
+        CombatCore->PerformAttack(Type, Direction, Situation);
+    }
+}
+
+EMCS_AttackDirection UMCS_CombatCommandComponent::GetHeldAttackDirection() const
+{
+    switch (LastDirection)
+    {
+        case EMCS_CommandInput::Forward: return EMCS_AttackDirection::Forward;
+        case EMCS_CommandInput::Back:    return EMCS_AttackDirection::Backward;
+        case EMCS_CommandInput::Left:    return EMCS_AttackDirection::Left;
+        case EMCS_CommandInput::Right:   return EMCS_AttackDirection::Right;
+        default:                         return EMCS_AttackDirection::Omni;
+    }
+}
@@ -24,6 +24,14 @@
 
  // Local dependency: used only for pulling defensive state info
 #include <Components/MCS_CombatDefenseComponent.h>
+#include <SubSystems/MCS_LatencySubsystem.h>
+#include <SubSystems/MCS_CombatGridSubsystem.h>
+#include <SubSystems/MCS_ProjectileSubsystem.h>
+#include <Components/MCS_CombatResourceComponent.h>
+#include <SubSystems/MCS_ResourceSubsystem.h>
+#include <SubSystems/MCS_AttackDatabaseSubsystem.h>
+#include <SubSystems/MCS_CombatBudgetSubsystem.h>
+#include <Stats/MCS_Stats.h>
 
 #if WITH_EDITORONLY_DATA
 #include "Engine/Canvas.h"
@@ -53,6 +61,18 @@ void UMCS_CombatCoreComponent::BeginPlay()
     if (UWorld* World = GetWorld())
     {
         TargetingSubsystem = World->GetSubsystem<UMCS_TargetingSubsystem>();
+
+        // Make the owner hittable by projectiles and area attacks
+        if (UMCS_CombatGridSubsystem* Grid = World->GetSubsystem<UMCS_CombatGridSubsystem>())
+        {
+            Grid->RegisterCombatant(GetOwner());
+        }
+    }
+
+    // Pick up attack tables recompiled while playing (editor hot reload)
+    if (UMCS_AttackDatabaseSubsystem* Database = UMCS_AttackDatabaseSubsystem::Get(this))
+    {
+        AttackTableRecompiledHandle = Database->OnAttackTableRecompiled.AddUObject(this, &UMCS_CombatCoreComponent::HandleAttackTableRecompiled);
     }
 
     // If no active set defined but map has entries, activate the first
@@ -78,6 +98,21 @@ void UMCS_CombatCoreComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
         TargetingSubsystem->OnTargetsUpdated.RemoveDynamic(this, &UMCS_CombatCoreComponent::HandleTargetsUpdated);
     }
 
+    // Remove the owner from the combat grid
+    if (UWorld* World = GetWorld())
+    {
+        if (UMCS_CombatGridSubsystem* Grid = World->GetSubsystem<UMCS_CombatGridSubsystem>())
+        {
+            Grid->UnregisterCombatant(GetOwner());
+        }
+    }
+
+    if (UMCS_AttackDatabaseSubsystem* Database = UMCS_AttackDatabaseSubsystem::Get(this))
+    {
+        Database->OnAttackTableRecompiled.Remove(AttackTableRecompiledHandle);
+    }
+    AttackTableRecompiledHandle.Reset();
+
     // Unbind all notifies
     UnbindAllNotifies();
 
@@ -110,11 +145,71 @@ void UMCS_CombatCoreComponent::TickComponent(float DeltaTime, ELevelTick TickTyp
 */
 void UMCS_CombatCoreComponent::PerformAttack(EMCS_AttackType DesiredType, EMCS_AttackDirection DesiredDirection, const FMCS_AttackSituation& CurrentSituation)
 {
+    if (!MCS_NetRole::ShouldExecute(this, NetExecution))
+    {
+        return;
+    }
+
+    if (UMCS_LatencySubsystem* Latency = UMCS_LatencySubsystem::Get(this))
+    {
+        Latency->MarkDispatch(GetOwner());
+    }
+
     if (!SelectAttack(DesiredType, DesiredDirection, CurrentSituation))
     {
         return;
     }
 
+    PlayCurrentAttack();
+}
+
+/*
+ * Plays a specific row of the active attack set, bypassing the chooser
+ * @param AttackName - AttackName of the row to play
+ */
+bool UMCS_CombatCoreComponent::PerformNamedAttack(FName AttackName, const FMCS_AttackSituation& CurrentSituation)
+{
+    if (!MCS_NetRole::ShouldExecute(this, NetExecution))
+    {
+        return false;
+    }
+
+    if (UMCS_LatencySubsystem* Latency = UMCS_LatencySubsystem::Get(this))
+    {
+        Latency->MarkDispatch(GetOwner());
+    }
+
+    if (AttackName == NAME_None || !IsValid(ActiveAttackChooser))
+    {
+        return false;
+    }
+
+    const int32 FoundIndex = ActiveAttackChooser->FindEntryIndex(AttackName);
+    if (FoundIndex == INDEX_NONE)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("[CombatCore] No attack named %s in active set %s."), *AttackName.ToString(), *ActiveAttackSetTag.ToString());
+        return false;
+    }
+
+    // Named attacks skip the chooser, so apply its stamina and cooldown filters here
+    const FMCS_AttackEntry& Found = *ActiveAttackChooser->GetEntry(FoundIndex);
+    if (Found.StaminaCost > UMCS_ResourceSubsystem::GetAvailableStamina(GetOwner()) ||
+        !ActiveAttackChooser->IsAttackReady(FoundIndex, GetWorld()->GetTimeSeconds()))
+    {
+        return false;
+    }
+
+    PlayerSituation = CurrentSituation;
+    CurrentAttack = Found;
+    PlayCurrentAttack();
+    return true;
+}
+
+/*
+ * Plays CurrentAttack's montage, binds its notifies and broadcasts the attack start
+ */
+void UMCS_CombatCoreComponent::PlayCurrentAttack()
+{
     ACharacter* CharacterOwner = Cast<ACharacter>(GetOwner());
     if (!IsValid(CharacterOwner) || !CurrentAttack.HasValidMontage()) return;
 
@@ -168,14 +263,21 @@ void UMCS_CombatCoreComponent::PerformAttack(EMCS_AttackType DesiredType, EMCS_A
     const float StartTime = 0.0f;
     AnimInstance->Montage_Play(CurrentAttack.AttackMontage, PlayRate, EMontagePlayReturnType::MontageLength, StartTime, true);
 
-    // Broadcast attack started event to event bus
-    if (UWorld* World = GetWorld())
+    if (UMCS_LatencySubsystem* Latency = UMCS_LatencySubsystem::Get(this))
     {
-        if (UMCS_CombatEventBus* Bus = UMCS_CombatEventBus::Get(World))
-        {
-            AActor* Target = GetClosestTarget(2500.f);
-            Bus->OnAttackStarted.Broadcast(GetOwner(), Target);
-        }
+        Latency->MarkMontageStarted(CharacterOwner, AnimInstance, CurrentAttack.AttackMontage);
+    }
+
+    // Spend the attack's stamina (the chooser already ensured there was enough)
+    if (UMCS_CombatResourceComponent* Resources = CharacterOwner->FindComponentByClass<UMCS_CombatResourceComponent>())
+    {
+        Resources->ConsumeStamina(CurrentAttack.StaminaCost);
+    }
+
+    // Start the attack's cooldown and recency penalty in the chooser's memory
+    if (IsValid(ActiveAttackChooser))
+    {
+        ActiveAttackChooser->MarkAttackUsed(ActiveAttackChooser->FindEntryIndex(CurrentAttack.AttackName), GetWorld()->GetTimeSeconds());
     }
 
     // Jump to specified section if provided
@@ -183,6 +285,16 @@ void UMCS_CombatCoreComponent::PerformAttack(EMCS_AttackType DesiredType, EMCS_A
     {
         AnimInstance->Montage_JumpToSection(CurrentAttack.MontageSection, CurrentAttack.AttackMontage);
     }
+
+    // Broadcast attack started event to event bus (after the section jump so listeners see the real montage position)
+    if (UWorld* World = GetWorld())
+    {
+        if (UMCS_CombatEventBus* Bus = UMCS_CombatEventBus::Get(World))
+        {
+            AActor* Target = GetClosestTarget(2500.f);
+            Bus->OnAttackStarted.Broadcast(GetOwner(), Target);
+        }
+    }
 }
 
 /*
@@ -192,6 +304,12 @@ void UMCS_CombatCoreComponent::PerformAttack(EMCS_AttackType DesiredType, EMCS_A
 */
 bool UMCS_CombatCoreComponent::SelectAttack(EMCS_AttackType DesiredType, EMCS_AttackDirection DesiredDirection, const FMCS_AttackSituation& CurrentSituation)
 {
+    // Simulated proxies (by default) never query the chooser; their attacks arrive as replicated montages
+    if (!MCS_NetRole::ShouldExecute(this, NetExecution))
+    {
+        return false;
+    }
+
     const FMCS_AttackSetData* ActiveSet = AttackSets.Find(ActiveAttackSetTag);
     if (!ActiveSet || !ActiveSet->AttackChooser)
     {
@@ -204,45 +322,28 @@ bool UMCS_CombatCoreComponent::SelectAttack(EMCS_AttackType DesiredType, EMCS_At
         return false;
     }
 
-    //----------------------------------------
-    // 1. Gather filtered entries by DesiredType
-    //----------------------------------------
-    TArray<FMCS_AttackEntry> FilteredEntries;
-
-    if (ActiveSet->AttackDataTable)
-    {
-        TArray<FMCS_AttackEntry*> Rows;
-        ActiveSet->AttackDataTable->GetAllRows(TEXT("SelectAttack"), Rows);
-
-        for (const FMCS_AttackEntry* Row : Rows)
-        {
-            if (Row && Row->AttackType == DesiredType)
-            {
-                FilteredEntries.Add(*Row);
-            }
-        }
-    }
-
-    if (FilteredEntries.IsEmpty())
+    // Under heavy load, distant AI combatants only decide every few frames
+    const UMCS_CombatBudgetSubsystem* Governor = UMCS_CombatBudgetSubsystem::Get(OwnerActor);
+    if (Governor && !Governor->ShouldRunAIDecision(OwnerActor))
     {
         return false;
     }
 
     //----------------------------------------
-    // 2. Get a chooser instance from the pool. (Memory optimization)
+    // 1. Get the active chooser (it already holds the compiled set; no rows are copied per query)
     //----------------------------------------
-    UMCS_AttackChooser* TempChooser = IsValid(ActiveAttackChooser.Get())
-        ? ActiveAttackChooser.Get()                                     // raw pointer
-        : NewObject<UMCS_AttackChooser>(this, ActiveSet->AttackChooser);
-
-    if (!IsValid(TempChooser))
+    if (!IsValid(ActiveAttackChooser) && !SetActiveAttackSet(ActiveAttackSetTag))
     {
         UE_LOG(LogTemp, Warning, TEXT("[CombatCore] Failed to create or retrieve AttackChooser instance."));
         return false;
     }
 
-    // Refresh entries
-    TempChooser->AttackEntries = FilteredEntries;
+    //----------------------------------------
+    // 2. Filter by DesiredType inside the chooser
+    //----------------------------------------
+    FMCS_AttackQueryFilter Filter;
+    Filter.bFilterType = true;
+    Filter.Type = DesiredType;
 
     //----------------------------------------
     // 3. Gather valid targets
@@ -267,12 +368,12 @@ bool UMCS_CombatCoreComponent::SelectAttack(EMCS_AttackType DesiredType, EMCS_At
     //----------------------------------------
     // 5. Choose the best attack
     //----------------------------------------
-    FMCS_AttackEntry ChosenAttack;
-    const bool bSuccess = TempChooser->ChooseAttack(OwnerActor, Targets, DesiredDirection, CurrentSituation, ChosenAttack);
+    const int32 ChosenIndex = ActiveAttackChooser->ChooseAttackIndex(OwnerActor, Targets, DesiredDirection, CurrentSituation, Filter);
+    const bool bSuccess = ChosenIndex != INDEX_NONE;
 
     if (bSuccess)
     {
-        CurrentAttack = ChosenAttack;
+        CurrentAttack = *ActiveAttackChooser->GetEntry(ChosenIndex);
     }
     else
     {
@@ -291,57 +392,46 @@ bool UMCS_CombatCoreComponent::SelectAttack(EMCS_AttackType DesiredType, EMCS_At
 bool UMCS_CombatCoreComponent::TryContinueCombo(
     EMCS_AttackType DesiredType, EMCS_AttackDirection DesiredDirection, const FMCS_AttackSituation& CurrentSituation)
 {
-    if (!bIsComboWindowOpen)
+    if (!MCS_NetRole::ShouldExecute(this, NetExecution))
     {
         return false;
     }
 
-    if (AllowedComboNames.IsEmpty())
+    if (UMCS_LatencySubsystem* Latency = UMCS_LatencySubsystem::Get(this))
     {
-        return false;
+        Latency->MarkDispatch(GetOwner());
     }
 
-    const FMCS_AttackSetData* ActiveSet = AttackSets.Find(ActiveAttackSetTag);
-    if (!ActiveSet || !ActiveSet->AttackChooser) return false;
-
-    UMCS_AttackChooser* Chooser = IsValid(ActiveAttackChooser.Get())
-        ? ActiveAttackChooser.Get()
-        : NewObject<UMCS_AttackChooser>(this, ActiveSet->AttackChooser);
-    
-    AActor* OwnerActor = GetOwnerActor();
-    if (!OwnerActor) return false;
-
-    // Filter by allowed combo names
-    TArray<FMCS_AttackEntry> Filtered;
-    for (const FMCS_AttackEntry& Entry : Chooser->AttackEntries)
+    if (!bIsComboWindowOpen)
     {
-        if (AllowedComboNames.Contains(Entry.AttackName))
-        {
-            Filtered.Add(Entry);
-        }
+        return false;
     }
 
-    if (Filtered.IsEmpty())
+    if (AllowedComboNames.IsEmpty())
     {
         return false;
     }
 
-    // Temporarily override chooser entries
-    const TArray<FMCS_AttackEntry> Original = Chooser->AttackEntries;
-    Chooser->AttackEntries = Filtered;
+    const FMCS_AttackSetData* ActiveSet = AttackSets.Find(ActiveAttackSetTag);
+    if (!ActiveSet || !ActiveSet->AttackChooser) return false;
+
+    if (!IsValid(ActiveAttackChooser) && !SetActiveAttackSet(ActiveAttackSetTag)) return false;
 
-    FMCS_AttackEntry NextAttack;
-    bool bChosen = Chooser->ChooseAttack(OwnerActor, {}, DesiredDirection, CurrentSituation, NextAttack);
+    AActor* OwnerActor = GetOwnerActor();
+    if (!OwnerActor) return false;
 
-    Chooser->AttackEntries = Original;
+    // Filter by allowed combo names inside the chooser
+    FMCS_AttackQueryFilter Filter;
+    Filter.AllowedNames = AllowedComboNames;
 
-    if (!bChosen)
+    const int32 NextIndex = ActiveAttackChooser->ChooseAttackIndex(OwnerActor, {}, DesiredDirection, CurrentSituation, Filter);
+    if (NextIndex == INDEX_NONE)
     {
         return false;
     }
 
     // Chain into next attack
-    CurrentAttack = NextAttack;
+    CurrentAttack = *ActiveAttackChooser->GetEntry(NextIndex);
     PerformAttack(DesiredType, DesiredDirection, CurrentSituation);
 
     // Reset combo window state (will be reopened by next montage’s combo notify)
@@ -509,6 +599,8 @@ void UMCS_CombatCoreComponent::HandleMCSNotifyBegin(EMCS_AnimEventType EventType
     const AActor* Owner = GetOwner();
     if (!Owner) return;
 
+    FMCS_BudgetScope BudgetScope(Owner, EMCS_BudgetCategory::Events);
+
     // 🛡️ Guard: only run if this character is actively playing this montage
     if (const ACharacter* C = Cast<ACharacter>(Owner);
         !(C && C->GetMesh() && C->GetMesh()->GetAnimInstance() &&
@@ -534,6 +626,22 @@ void UMCS_CombatCoreComponent::HandleMCSNotifyBegin(EMCS_AnimEventType EventType
 
             break;
 
+        case EMCS_AnimEventType::ProjectileFire:
+            FireCurrentProjectile();
+            break;
+
+        case EMCS_AnimEventType::AreaOfEffect:
+            if (!CachedHitboxComp)
+            {
+                if (ACharacter* CharacterOwner = Cast<ACharacter>(GetOwner()))
+                    CachedHitboxComp = CharacterOwner->FindComponentByClass<UMCS_CombatHitboxComponent>();
+            }
+            if (!CachedHitboxComp) return;
+
+            // Areas share the already-hit set with the melee sweep of the same attack
+            CachedHitboxComp->StartAreaDetection(CurrentAttack, Notify->Id);
+            break;
+
         case EMCS_AnimEventType::ComboWindow:
             // Mark combo window as active
             bIsComboWindowOpen = true;
@@ -577,6 +685,32 @@ void UMCS_CombatCoreComponent::HandleMCSNotifyBegin(EMCS_AnimEventType EventType
     }
 }
 
+void UMCS_CombatCoreComponent::FireCurrentProjectile()
+{
+    if (!CurrentAttack.Projectile.bEnabled || !MCS_NetRole::ShouldExecute(this, NetExecution)) return;
+
+    ACharacter* CharacterOwner = Cast<ACharacter>(GetOwner());
+    UWorld* World = GetWorld();
+    if (!CharacterOwner || !World) return;
+
+    UMCS_ProjectileSubsystem* Projectiles = World->GetSubsystem<UMCS_ProjectileSubsystem>();
+    if (!Projectiles) return;
+
+    // Spawn from the muzzle socket when the mesh has one
+    FVector Origin = CharacterOwner->GetActorLocation();
+    const FName MuzzleSocket = CurrentAttack.Projectile.MuzzleSocket;
+    if (const USkeletalMeshComponent* Mesh = CharacterOwner->GetMesh();
+        Mesh && MuzzleSocket != NAME_None && Mesh->DoesSocketExist(MuzzleSocket))
+    {
+        Origin = Mesh->GetSocketLocation(MuzzleSocket);
+    }
+
+    // Base aim rotation is the control rotation for players and the focus direction for AI
+    const FVector Direction = CharacterOwner->GetBaseAimRotation().Vector();
+
+    Projectiles->FireProjectile(CharacterOwner, CurrentAttack, Origin, Direction);
+}
+
 void UMCS_CombatCoreComponent::HandleMCSNotifyEnd(EMCS_AnimEventType EventType, UAnimNotifyState_MCSWindow* Notify)
 {
     // Validate the notify instance
@@ -586,6 +720,8 @@ void UMCS_CombatCoreComponent::HandleMCSNotifyEnd(EMCS_AnimEventType EventType,
     const AActor* Owner = GetOwner();
     if (!Owner) return;
 
+    FMCS_BudgetScope BudgetScope(Owner, EMCS_BudgetCategory::Events);
+
     // 🛡️ Guard: only run if this character is actively playing this montage
     if (const ACharacter* C = Cast<ACharacter>(Owner);
         !(C && C->GetMesh() && C->GetMesh()->GetAnimInstance() &&
@@ -637,44 +773,200 @@ bool UMCS_CombatCoreComponent::SetActiveAttackSet(const FGameplayTag& NewAttackS
         return false;
     }
 
-    if (!FoundSet->AttackDataTable || !FoundSet->AttackChooser)
+    if (FoundSet->AttackDataTable.IsNull() || !FoundSet->AttackChooser)
     {
         UE_LOG(LogTemp, Warning, TEXT("[CombatCore] AttackSet '%s' missing DataTable or Chooser Class."), *NewAttackSetTag.ToString());
         return false;
     }
 
+    const FGameplayTag PreviousSetTag = ActiveAttackSetTag;
     ActiveAttackSetTag = NewAttackSetTag;
     AttackDataTable = FoundSet->AttackDataTable;
 
     //----------------------------------------
-    // 🧩 Create a runtime instance from the class
+    // 🧩 Create a runtime instance from the class (the base set decides the chooser class)
     //----------------------------------------
-    ActiveAttackChooser = NewObject<UMCS_AttackChooser>(this, FoundSet->AttackChooser);
-    if (!IsValid(ActiveAttackChooser))
+    if (!IsValid(ActiveAttackChooser) || ActiveAttackChooser->GetClass() != FoundSet->AttackChooser)
     {
-        UE_LOG(LogTemp, Warning, TEXT("[CombatCore] Failed to instantiate AttackChooser for set: %s"), *NewAttackSetTag.ToString());
-        return false;
+        LLM_SCOPE_BYTAG(MotionCombat_Choosers);
+
+        ActiveAttackChooser = NewObject<UMCS_AttackChooser>(this, FoundSet->AttackChooser);
+        if (!IsValid(ActiveAttackChooser))
+        {
+            UE_LOG(LogTemp, Warning, TEXT("[CombatCore] Failed to instantiate AttackChooser for set: %s"), *NewAttackSetTag.ToString());
+            return false;
+        }
+
+        // A fresh chooser needs the additive layers registered again
+        for (const TPair<FGameplayTag, int32>& Layer : AttackLayers)
+        {
+            if (const FMCS_AttackSetData* LayerSet = AttackSets.Find(Layer.Key))
+            {
+                ActiveAttackChooser->AddLayer(Layer.Key, GetCompiledAttackSet(LayerSet->AttackDataTable), Layer.Value);
+            }
+        }
+    }
+    else if (PreviousSetTag != NewAttackSetTag && !AttackLayers.Contains(PreviousSetTag))
+    {
+        ActiveAttackChooser->SetLayerActive(PreviousSetTag, false);
     }
 
     //----------------------------------------
-    // Load DataTable rows into the chooser
+    // Register the base set as the lowest layer (shared compiled rows, no copies); a base set also pushed as a layer keeps that priority
     //----------------------------------------
-    ActiveAttackChooser->AttackEntries.Reset();
+    const TSharedPtr<const FMCS_CompiledAttackSet> Compiled = GetCompiledAttackSet(AttackDataTable);
+    const int32* LayerPriority = AttackLayers.Find(NewAttackSetTag);
+    ActiveAttackChooser->AddLayer(NewAttackSetTag, Compiled, LayerPriority ? *LayerPriority : BaseAttackLayerPriority);
+
+    // Accumulate the weighted range window (used by engagement positioning)
+    float WeightedStart = 0.f;
+    float WeightedEnd = 0.f;
+    float TotalWeight = 0.f;
+
+    for (const FMCS_AttackEntry& Row : Compiled->Entries)
+    {
+        const float Weight = FMath::Max(Row.SelectionWeight, KINDA_SMALL_NUMBER);
+        WeightedStart += Row.RangeStart * Weight;
+        WeightedEnd += Row.RangeEnd * Weight;
+        TotalWeight += Weight;
+    }
+
+    if (TotalWeight > 0.f)
+    {
+        ActiveRangeStart = WeightedStart / TotalWeight;
+        ActiveRangeEnd = FMath::Max(WeightedEnd / TotalWeight, ActiveRangeStart);
+    }
+    else
+    {
+        // Empty set: back to the defaults instead of keeping the previous set's window
+        ActiveRangeStart = 0.f;
+        ActiveRangeEnd = 150.f;
+    }
 
-    TArray<FMCS_AttackEntry*> Rows;
-    AttackDataTable->GetAllRows(TEXT("LoadFromSet"), Rows);
+    return true;
+}
+
+/**
+ * Swaps in the rebuilt rows of an edited attack table.
+ */
+void UMCS_CombatCoreComponent::HandleAttackTableRecompiled(const UDataTable* Table)
+{
+    if (!IsValid(ActiveAttackChooser))
+    {
+        return;
+    }
 
-    for (FMCS_AttackEntry* Row : Rows)
+    // The base set also refreshes the engagement range
+    if (Table == AttackDataTable.Get())
     {
-        if (Row)
+        SetActiveAttackSet(ActiveAttackSetTag);
+    }
+
+    for (const TPair<FGameplayTag, int32>& Layer : AttackLayers)
+    {
+        const FMCS_AttackSetData* LayerSet = AttackSets.Find(Layer.Key);
+        if (LayerSet && LayerSet->AttackDataTable.Get() == Table && Layer.Key != ActiveAttackSetTag)
         {
-            ActiveAttackChooser->AttackEntries.Add(*Row);
+            ActiveAttackChooser->AddLayer(Layer.Key, GetCompiledAttackSet(LayerSet->AttackDataTable), Layer.Value);
         }
     }
+}
+
+/**
+ * Activates an additional attack set on top of the base set.
+ */
+bool UMCS_CombatCoreComponent::AddAttackLayer(const FGameplayTag& AttackSetTag, int32 Priority)
+{
+    const FMCS_AttackSetData* LayerSet = AttackSets.Find(AttackSetTag);
+    if (!LayerSet || LayerSet->AttackDataTable.IsNull())
+    {
+        UE_LOG(LogTemp, Warning, TEXT("[CombatCore] No AttackSet with a DataTable found for layer: %s"), *AttackSetTag.ToString());
+        return false;
+    }
+
+    if (!IsValid(ActiveAttackChooser) && !SetActiveAttackSet(ActiveAttackSetTag))
+    {
+        return false;
+    }
+
+    AttackLayers.Add(AttackSetTag, Priority);
+    ActiveAttackChooser->AddLayer(AttackSetTag, GetCompiledAttackSet(LayerSet->AttackDataTable), Priority);
+    return true;
+}
+
+/**
+ * Deactivates an additional attack set.
+ */
+bool UMCS_CombatCoreComponent::RemoveAttackLayer(const FGameplayTag& AttackSetTag)
+{
+    if (AttackLayers.Remove(AttackSetTag) == 0)
+    {
+        return false;
+    }
+
+    if (!IsValid(ActiveAttackChooser))
+    {
+        return true;
+    }
+
+    // The base set stays active even if it was also pushed as a layer, back at the base priority
+    if (AttackSetTag == ActiveAttackSetTag)
+    {
+        if (const FMCS_AttackSetData* BaseSet = AttackSets.Find(AttackSetTag))
+        {
+            ActiveAttackChooser->AddLayer(AttackSetTag, GetCompiledAttackSet(BaseSet->AttackDataTable), BaseAttackLayerPriority);
+        }
+    }
+    else
+    {
+        ActiveAttackChooser->SetLayerActive(AttackSetTag, false);
+    }
 
     return true;
 }
 
+/**
+ * Gets the additional attack sets currently active.
+ */
+TArray<FGameplayTag> UMCS_CombatCoreComponent::GetActiveAttackLayers() const
+{
+    TArray<FGameplayTag> Tags;
+    AttackLayers.GetKeys(Tags);
+    return Tags;
+}
+
+/**
+ * Returns the shared compiled rows of an attack DataTable.
+ */
+TSharedPtr<const FMCS_CompiledAttackSet> UMCS_CombatCoreComponent::GetCompiledAttackSet(const TSoftObjectPtr<UDataTable>& TableRef) const
+{
+    if (UMCS_AttackDatabaseSubsystem* Database = UMCS_AttackDatabaseSubsystem::Get(this))
+    {
+        return Database->GetCompiledSet(TableRef);
+    }
+
+    const UDataTable* Table = TableRef.LoadSynchronous();
+    if (!Table)
+    {
+        return nullptr;
+    }
+
+    // No game world (e.g. editor utility); compile a private copy
+    TSharedRef<FMCS_CompiledAttackSet> Local = MakeShared<FMCS_CompiledAttackSet>();
+    Local->Build(*Table);
+    return Local;
+}
+
+/**
+ * Gets the preferred engagement range of the active attack set.
+ */
+bool UMCS_CombatCoreComponent::GetActiveAttackRange(float& OutRangeStart, float& OutRangeEnd) const
+{
+    OutRangeStart = ActiveRangeStart;
+    OutRangeEnd = ActiveRangeEnd;
+    return ActiveAttackSetTag.IsValid();
+}
+
 /**
  * Gets the currently active attack DataTable.
  */
@@ -682,7 +974,7 @@ UDataTable* UMCS_CombatCoreComponent::GetActiveAttackTable() const
 {
     if (const FMCS_AttackSetData* Found = AttackSets.Find(ActiveAttackSetTag))
     {
-        return Found->AttackDataTable;
+        return Found->AttackDataTable.LoadSynchronous();
     }
     return nullptr;
 }
@@ -732,8 +1024,11 @@ void UMCS_CombatCoreComponent::UpdatePlayerSituation(float DeltaTime)
         PlayerSituation.bIsBlocking = Defense->bIsInDefenseWindow; // Is blocking state.
     }
 
-    // Optional: get stamina/health percent from owner’s interface or attributes (placeholder)
-    PlayerSituation.Stamina = 100.f;
+    // Stamina from the resource store when the owner has a resource component
+    const UMCS_CombatResourceComponent* Resources = OwnerPawn->FindComponentByClass<UMCS_CombatResourceComponent>();
+    PlayerSituation.Stamina = Resources ? Resources->GetStamina() : 100.f;
+
+    // Optional: get health percent from owner’s interface or attributes (placeholder)
     PlayerSituation.HealthPercent = 100.f;
 }
 
@@ -751,6 +1046,7 @@ UMCS_AttackChooser* UMCS_CombatCoreComponent::GetPooledChooser(TSubclassOf<UMCS_
     }
 
     // None found — create a new one and add to pool
+    LLM_SCOPE_BYTAG(MotionCombat_Choosers);
     UMCS_AttackChooser* NewChooser = NewObject<UMCS_AttackChooser>(this, ChooserClass);
     ChooserPool.Add(NewChooser);
 
@@ -17,7 +17,32 @@
 
 #include <Components/MCS_CombatDefenseComponent.h>
 #include "GameFramework/Actor.h"
+#include "GameFramework/Character.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Animation/AnimInstance.h"
+#include "Animation/AnimMontage.h"
+#include "TimerManager.h"
+#include "Algo/BinarySearch.h"
+#include <SubSystems/MCS_LatencySubsystem.h>
+#include <SubSystems/MCS_AttackDatabaseSubsystem.h>
+#include <SubSystems/MCS_ResourceSubsystem.h>
+#include <Stats/MCS_Stats.h>
+
+
+namespace MCS_Threat
+{
+    /** Anim instance driving an actor's montages */
+    UAnimInstance* GetAnimInstance(const AActor* Actor)
+    {
+        if (const ACharacter* Character = Cast<ACharacter>(Actor))
+        {
+            return Character->GetMesh() ? Character->GetMesh()->GetAnimInstance() : nullptr;
+        }
 
+        const USkeletalMeshComponent* Mesh = Actor ? Actor->FindComponentByClass<USkeletalMeshComponent>() : nullptr;
+        return Mesh ? Mesh->GetAnimInstance() : nullptr;
+    }
+}
 
 UMCS_CombatDefenseComponent::UMCS_CombatDefenseComponent()
 {
@@ -59,6 +84,12 @@ void UMCS_CombatDefenseComponent::BeginPlay()
         }
     }
 
+    // Pick up defense tables recompiled while playing (editor hot reload)
+    if (UMCS_AttackDatabaseSubsystem* Database = UMCS_AttackDatabaseSubsystem::Get(this))
+    {
+        DefenseTableRecompiledHandle = Database->OnDefenseTableRecompiled.AddUObject(this, &UMCS_CombatDefenseComponent::HandleDefenseTableRecompiled);
+    }
+
     // If no active set defined but map has entries, activate the first
     if (!ActiveDefenseSetTag.IsValid() && DefenseSets.Num() > 0)
     {
@@ -70,6 +101,14 @@ void UMCS_CombatDefenseComponent::BeginPlay()
 /**
  * Called when the game ends
  */
+void UMCS_CombatDefenseComponent::GetResourceSizeEx(FResourceSizeEx& CumulativeResourceSize)
+{
+    Super::GetResourceSizeEx(CumulativeResourceSize);
+
+    CumulativeResourceSize.AddDedicatedSystemMemoryBytes(
+        IncomingThreats.GetAllocatedSize() + ParryWindows.GetAllocatedSize() + DefenseWindows.GetAllocatedSize());
+}
+
 void UMCS_CombatDefenseComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
     Super::EndPlay(EndPlayReason);
@@ -101,6 +140,23 @@ void UMCS_CombatDefenseComponent::EndPlay(const EEndPlayReason::Type EndPlayReas
         }
     }
 
+    if (UMCS_AttackDatabaseSubsystem* Database = UMCS_AttackDatabaseSubsystem::Get(this))
+    {
+        Database->OnDefenseTableRecompiled.Remove(DefenseTableRecompiledHandle);
+    }
+    DefenseTableRecompiledHandle.Reset();
+
+    if (UWorld* World = GetWorld())
+    {
+        World->GetTimerManager().ClearTimer(ThreatTimerHandle);
+        World->GetTimerManager().ClearTimer(PendingInputTimerHandle);
+    }
+    IncomingThreats.Reset();
+    ParryWindows.Reset();
+    DefenseWindows.Reset();
+    PendingParryInputTime = -1.f;
+    PendingDefenseInputTime = -1.f;
+
     LastParrySource = nullptr;
     bIsInParryWindow = false;
     bIsInDefenseWindow = false;
@@ -112,6 +168,7 @@ void UMCS_CombatDefenseComponent::EndPlay(const EEndPlayReason::Type EndPlayReas
     OnDefenseWindowActive.Clear();
     OnDefenseSuccess.Clear();
     OnDefenseFail.Clear();
+    OnDefenseDue.Clear();
 }
 
 /**
@@ -148,6 +205,19 @@ void UMCS_CombatDefenseComponent::HandleDefenseWindowBegin(AActor* Defender)
     bIsInDefenseWindow = true;
     OnDefenseWindowActive.Broadcast();
     UE_LOG(LogTemp, Log, TEXT("[CombatDefense] Defense Window OPEN (Defender: %s)"), *GetNameSafe(Defender));
+
+    // Exact interval from our montage; without a timeline the window stays open until its end notify
+    if (!AddTimelineWindows(GetOwner(), EMCS_AnimEventType::DefenseWindow, DefenseWindows))
+    {
+        if (const UWorld* World = GetWorld())
+        {
+            FMCS_TimedWindow& Window = DefenseWindows.AddDefaulted_GetRef();
+            Window.Source = GetOwner();
+            Window.StartTime = World->GetTimeSeconds();
+        }
+    }
+
+    ResolvePendingInputs();
 }
 
 /**
@@ -158,12 +228,132 @@ void UMCS_CombatDefenseComponent::HandleDefenseWindowEnd(AActor* Defender)
 {
     bIsInDefenseWindow = false;
     UE_LOG(LogTemp, Log, TEXT("[CombatDefense] Defense Window CLOSED (Defender: %s)"), *GetNameSafe(Defender));
+
+    // Close windows that were reported without a timeline
+    if (const UWorld* World = GetWorld())
+    {
+        for (FMCS_TimedWindow& Window : DefenseWindows)
+        {
+            if (Window.EndTime == MAX_flt)
+            {
+                Window.EndTime = World->GetTimeSeconds();
+            }
+        }
+    }
 }
 
 bool UMCS_CombatDefenseComponent::TryParry()
 {
-    // ✅ Can only parry if a window is active and we have a valid attacker
-    if (!bIsInParryWindow || !IsValid(LastParrySource))
+    const UWorld* World = GetWorld();
+    return TryParryAt(World ? World->GetTimeSeconds() : 0.f);
+}
+
+bool UMCS_CombatDefenseComponent::TryDefense()
+{
+    const UWorld* World = GetWorld();
+    return TryDefenseAt(World ? World->GetTimeSeconds() : 0.f);
+}
+
+/*
+ * Resolves a parry input by comparing its timestamp with the known parry windows.
+ *
+ * @param InputTime - World time the input was pressed.
+ * @return True if the parry succeeded immediately.
+ */
+bool UMCS_CombatDefenseComponent::TryParryAt(float InputTime)
+{
+    if (!MCS_NetRole::ShouldExecute(this, NetExecution))
+    {
+        return false;
+    }
+
+    if (UMCS_LatencySubsystem* Latency = UMCS_LatencySubsystem::Get(this))
+    {
+        Latency->MarkDispatch(GetOwner());
+    }
+
+    const UWorld* World = GetWorld();
+    if (!World)
+    {
+        return false;
+    }
+
+    const float Now = World->GetTimeSeconds();
+    PruneWindows(ParryWindows, Now);
+
+    if (Now - InputTime <= MaxInputAge)
+    {
+        if (const FMCS_TimedWindow* Window = FindWindow(ParryWindows, InputTime, Now))
+        {
+            return CompleteParry(Window->Source.Get());
+        }
+
+        // Slightly early: a window may still be reported within the grace margin
+        if (Now - InputTime < TimingGraceMargin)
+        {
+            PendingParryInputTime = InputTime;
+            SchedulePendingExpiry();
+            UE_LOG(LogTemp, Verbose, TEXT("[CombatDefense] Parry input held for %.3fs."), TimingGraceMargin);
+            return false;
+        }
+    }
+
+    UE_LOG(LogTemp, Warning, TEXT("[CombatDefense] Parry failed: No active window or invalid source."));
+    OnParryFail.Broadcast();
+    return false;
+}
+
+/*
+ * Resolves a block input by comparing its timestamp with the defense windows.
+ *
+ * @param InputTime - World time the input was pressed.
+ * @return True if the block succeeded immediately.
+ */
+bool UMCS_CombatDefenseComponent::TryDefenseAt(float InputTime)
+{
+    if (!MCS_NetRole::ShouldExecute(this, NetExecution))
+    {
+        return false;
+    }
+
+    if (UMCS_LatencySubsystem* Latency = UMCS_LatencySubsystem::Get(this))
+    {
+        Latency->MarkDispatch(GetOwner());
+    }
+
+    const UWorld* World = GetWorld();
+    if (!World)
+    {
+        return false;
+    }
+
+    const float Now = World->GetTimeSeconds();
+    PruneWindows(DefenseWindows, Now);
+
+    if (Now - InputTime <= MaxInputAge)
+    {
+        if (FindWindow(DefenseWindows, InputTime, Now))
+        {
+            return CompleteDefense();
+        }
+
+        if (Now - InputTime < TimingGraceMargin)
+        {
+            PendingDefenseInputTime = InputTime;
+            SchedulePendingExpiry();
+            UE_LOG(LogTemp, Verbose, TEXT("[CombatDefense] Block input held for %.3fs."), TimingGraceMargin);
+            return false;
+        }
+    }
+
+    UE_LOG(LogTemp, Warning, TEXT("[CombatDefense] Block failed: No active defense window."));
+    OnDefenseFail.Broadcast();
+    return false;
+}
+
+bool UMCS_CombatDefenseComponent::CompleteParry(AActor* Attacker)
+{
+    if (!IsValid(Attacker))
     {
         UE_LOG(LogTemp, Warning, TEXT("[CombatDefense] Parry failed: No active window or invalid source."));
         OnParryFail.Broadcast();
@@ -171,38 +361,38 @@ bool UMCS_CombatDefenseComponent::TryParry()
     }
 
     // Later we’ll add conditions like facing, stamina, reaction time, etc.
-    const FVector ToAttacker = (LastParrySource->GetActorLocation() - GetOwner()->GetActorLocation()).GetSafeNormal();
+    const FVector ToAttacker = (Attacker->GetActorLocation() - GetOwner()->GetActorLocation()).GetSafeNormal();
     const FVector Forward = GetOwner()->GetActorForwardVector();
 
     const float FacingDot = FMath::Clamp(FVector::DotProduct(Forward, ToAttacker), -1.f, 1.f); // -1 to 1
     const bool bIsFacingAttacker = FacingDot > 0.25f; // ~75° cone
 
-    if (bIsFacingAttacker)
+    if (bIsFacingAttacker && SpendDefenseStamina())
     {
-        UE_LOG(LogTemp, Warning, TEXT("[CombatDefense] Parry SUCCESS against %s"), *GetNameSafe(LastParrySource));
+        UE_LOG(LogTemp, Warning, TEXT("[CombatDefense] Parry SUCCESS against %s"), *GetNameSafe(Attacker));
         OnParrySuccess.Broadcast();
 
         if (UWorld* World = GetWorld())
         {
             if (UMCS_CombatEventBus* Bus = UMCS_CombatEventBus::Get(World))
             {
-                Bus->OnParrySuccess.Broadcast(GetOwner(), LastParrySource);
+                Bus->OnParrySuccess.Broadcast(GetOwner(), Attacker);
             }
         }
 
         return true;
     }
 
-    UE_LOG(LogTemp, Warning, TEXT("[CombatDefense] Parry FAILED (not facing attacker)."));
+    UE_LOG(LogTemp, Warning, TEXT("[CombatDefense] Parry FAILED (%s)."), bIsFacingAttacker ? TEXT("not enough stamina") : TEXT("not facing attacker"));
     OnParryFail.Broadcast();
     return false;
 }
 
-bool UMCS_CombatDefenseComponent::TryDefense()
+bool UMCS_CombatDefenseComponent::CompleteDefense()
 {
-    if (!bIsInDefenseWindow)
+    if (!SpendDefenseStamina())
     {
-        UE_LOG(LogTemp, Warning, TEXT("[CombatDefense] Block failed: No active defense window."));
+        UE_LOG(LogTemp, Warning, TEXT("[CombatDefense] Block failed: not enough stamina."));
         OnDefenseFail.Broadcast();
         return false;
     }
@@ -220,16 +410,102 @@ bool UMCS_CombatDefenseComponent::TryDefense()
     return true;
 }
 
+/*
+ * Spends the selected defense's stamina, as the core component does when an attack starts.
+ * The chooser filtered on it, but stamina may have been spent since the defense was selected.
+ */
+bool UMCS_CombatDefenseComponent::SpendDefenseStamina()
+{
+    if (CurrentDefense.StaminaCost <= 0.f)
+    {
+        return true;
+    }
+
+    const UWorld* World = GetWorld();
+    UMCS_ResourceSubsystem* Store = World ? World->GetSubsystem<UMCS_ResourceSubsystem>() : nullptr;
+    const int32 Slot = Store ? Store->FindSlot(GetOwner()) : INDEX_NONE;
+
+    // Actors without a resource slot have unlimited stamina (see GetAvailableStamina)
+    return Slot == INDEX_NONE || Store->ConsumeStamina(Slot, CurrentDefense.StaminaCost);
+}
+
 void UMCS_CombatDefenseComponent::HandleGlobalAttackStarted(AActor* Attacker, AActor* Target)
 {
     if (Attacker == GetOwner()) return; // Ignore self
     UE_LOG(LogTemp, Verbose, TEXT("[CombatDefense] Global Attack Started by %s -> Target: %s"), *GetNameSafe(Attacker), *GetNameSafe(Target));
+
+    if (Target != GetOwner())
+    {
+        return;
+    }
+
+    // Parry windows of an attack aimed at us are known from the timeline before they open
+    if (AddTimelineWindows(Attacker, EMCS_AnimEventType::ParryWindow, ParryWindows))
+    {
+        ResolvePendingInputs();
+    }
+
+    if (!bPredictIncomingAttacks || !MCS_NetRole::ShouldExecute(this, NetExecution))
+    {
+        return;
+    }
+
+    // Players defend from their own input; a predicted pick must never replace it or be charged to them
+    if (const APawn* OwnerPawn = Cast<APawn>(GetOwner()); OwnerPawn && OwnerPawn->IsPlayerControlled())
+    {
+        return;
+    }
+
+    FMCS_IncomingThreat Threat;
+    if (!PredictImpact(Attacker, Threat))
+    {
+        return;
+    }
+
+    // A new attack from the same attacker replaces the previous one
+    IncomingThreats.RemoveAll([ Attacker ] (const FMCS_IncomingThreat& Existing)
+        {
+            return Existing.Attacker == Attacker;
+        });
+
+    const int32 InsertAt = Algo::UpperBoundBy(IncomingThreats, Threat.ImpactTime, &FMCS_IncomingThreat::ImpactTime);
+    IncomingThreats.Insert(Threat, InsertAt);
+
+    if (IncomingThreats.Num() > MaxTrackedThreats)
+    {
+        IncomingThreats.SetNum(MaxTrackedThreats, EAllowShrinking::No);
+    }
+
+    ScheduleNextThreat();
 }
 
 void UMCS_CombatDefenseComponent::HandleGlobalParryWindowOpened(AActor* Attacker, float Duration)
 {
     if (Attacker == GetOwner()) return; // Ignore self
     UE_LOG(LogTemp, Verbose, TEXT("[CombatDefense] Parry window opened by %s for %.2fs"), *GetNameSafe(Attacker), Duration);
+
+    const UWorld* World = GetWorld();
+    if (!World)
+    {
+        return;
+    }
+
+    // Attacks not aimed at us have no predicted windows; fall back to the reported one
+    const float Now = World->GetTimeSeconds();
+    const bool bKnown = ParryWindows.ContainsByPredicate([ Attacker, Now ] (const FMCS_TimedWindow& Window)
+        {
+            return Window.Source == Attacker && Window.Contains(Now, 0.f);
+        });
+
+    if (!bKnown)
+    {
+        FMCS_TimedWindow& Window = ParryWindows.AddDefaulted_GetRef();
+        Window.Source = Attacker;
+        Window.StartTime = Now;
+        Window.EndTime = Now + Duration;
+
+        ResolvePendingInputs();
+    }
 }
 
 void UMCS_CombatDefenseComponent::HandleGlobalParrySuccess(AActor* Defender, AActor* Attacker)
@@ -267,44 +543,401 @@ bool UMCS_CombatDefenseComponent::SetActiveDefenseSet(const FGameplayTag& NewDef
         return false;
     }
 
-    if (!IsValid(FoundSet->DefenseDataTable) || !FoundSet->DefenseChooser)
+    if (FoundSet->DefenseDataTable.IsNull() || !FoundSet->DefenseChooser)
     {
         UE_LOG(LogTemp, Warning, TEXT("[CombatDefense] DefenseSet '%s' missing DataTable or Chooser Class."),
             *NewDefenseSetTag.ToString());
         return false;
     }
 
-    if (IsValid(ActiveDefenseChooser))
-    {
-        ActiveDefenseChooser->MarkAsGarbage();
-        ActiveDefenseChooser = nullptr;
-    }
-
     // Store new active tag
     ActiveDefenseSetTag = NewDefenseSetTag;
+    DefenseDataTable = FoundSet->DefenseDataTable;
 
     // -------------------------------------------------------------
-    // 1. Create a runtime instance of the Defense Chooser
+    // 1. Create a runtime instance of the Defense Chooser (reused if the class is unchanged)
     // -------------------------------------------------------------
-    ActiveDefenseChooser = NewObject<UMCS_DefenseChooser>(this, FoundSet->DefenseChooser);
-    check(ActiveDefenseChooser);
+    if (!IsValid(ActiveDefenseChooser) || ActiveDefenseChooser->GetClass() != FoundSet->DefenseChooser)
+    {
+        if (IsValid(ActiveDefenseChooser))
+        {
+            ActiveDefenseChooser->MarkAsGarbage();
+        }
+
+        LLM_SCOPE_BYTAG(MotionCombat_Choosers);
+        ActiveDefenseChooser = NewObject<UMCS_DefenseChooser>(this, FoundSet->DefenseChooser);
+        check(ActiveDefenseChooser);
+    }
 
     // -------------------------------------------------------------
-    // 2. Populate the chooser’s DefenseEntries array
+    // 2. Point the chooser at the shared compiled rows (no per-component copies)
     // -------------------------------------------------------------
-    ActiveDefenseChooser->DefenseEntries.Reset();
+    ActiveDefenseChooser->SetCompiledSet(GetCompiledDefenseSet(DefenseDataTable));
+
+    return true;
+}
+
+/*
+ * Selects the best defense against an attacker and stores it as the current defense.
+ *
+ * @param Attacker - The actor initiating the attack.
+ * @param Intent - Defense or Parry.
+ * @return True if a defense was selected.
+ */
+bool UMCS_CombatDefenseComponent::SelectDefense(AActor* Attacker, EMCS_DefenseIntent Intent)
+{
+    if (!MCS_NetRole::ShouldExecute(this, NetExecution))
+    {
+        return false;
+    }
+
+    return ChooseDefense(Attacker, Intent, CurrentDefense);
+}
+
+bool UMCS_CombatDefenseComponent::ChooseDefense(AActor* Attacker, EMCS_DefenseIntent Intent, FMCS_DefenseEntry& OutDefense) const
+{
+    if (!IsValid(ActiveDefenseChooser))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("[CombatDefense] ChooseDefense: no active defense set."));
+        return false;
+    }
 
-    TArray<FMCS_DefenseEntry*> Rows;
-    FoundSet->DefenseDataTable->GetAllRows(TEXT("LoadDefenseSet"), Rows);
+    const int32 ChosenIndex = ActiveDefenseChooser->ChooseDefenseIndex(GetOwner(), Attacker, Intent);
+    if (ChosenIndex == INDEX_NONE)
+    {
+        return false;
+    }
+
+    OutDefense = *ActiveDefenseChooser->GetEntry(ChosenIndex);
+    return true;
+}
 
-    for (const FMCS_DefenseEntry* Row : Rows)
+/**
+ * Swaps in the rebuilt rows of an edited defense table.
+ */
+void UMCS_CombatDefenseComponent::HandleDefenseTableRecompiled(const UDataTable* Table)
+{
+    if (IsValid(ActiveDefenseChooser) && Table == DefenseDataTable.Get())
     {
-        if (Row)
+        ActiveDefenseChooser->SetCompiledSet(GetCompiledDefenseSet(DefenseDataTable));
+    }
+}
+
+TSharedPtr<const FMCS_CompiledDefenseSet> UMCS_CombatDefenseComponent::GetCompiledDefenseSet(const TSoftObjectPtr<UDataTable>& TableRef) const
+{
+    if (UMCS_AttackDatabaseSubsystem* Database = UMCS_AttackDatabaseSubsystem::Get(this))
+    {
+        return Database->GetCompiledDefenseSet(TableRef);
+    }
+
+    const UDataTable* Table = TableRef.LoadSynchronous();
+    if (!Table)
+    {
+        return nullptr;
+    }
+
+    // No game world (e.g. editor utility); compile a private copy
+    TSharedRef<FMCS_CompiledDefenseSet> Local = MakeShared<FMCS_CompiledDefenseSet>();
+    Local->Build(*Table);
+    return Local;
+}
+
+/*
+ * Gets the tracked incoming attack that lands first.
+ */
+bool UMCS_CombatDefenseComponent::GetNextIncomingAttack(AActor*& OutAttacker, float& OutTimeToImpact) const
+{
+    OutAttacker = nullptr;
+    OutTimeToImpact = 0.f;
+
+    const UWorld* World = GetWorld();
+    if (!World)
+    {
+        return false;
+    }
+
+    for (const FMCS_IncomingThreat& Threat : IncomingThreats)
+    {
+        if (AActor* Attacker = Threat.Attacker.Get())
         {
-            ActiveDefenseChooser->DefenseEntries.Add(*Row);
+            OutAttacker = Attacker;
+            OutTimeToImpact = FMath::Max(Threat.ImpactTime - World->GetTimeSeconds(), 0.f);
+            return true;
         }
     }
 
+    return false;
+}
+
+/*
+ * Looks up the cached notify timeline of the montage an actor is currently playing.
+ */
+TSharedPtr<const FMCS_MontageTimeline> UMCS_CombatDefenseComponent::GetPlayingTimeline(const AActor* Actor, const UAnimMontage*& OutMontage, float& OutPosition, float& OutPlayRate) const
+{
+    const UAnimInstance* AnimInstance = MCS_Threat::GetAnimInstance(Actor);
+    OutMontage = AnimInstance ? AnimInstance->GetCurrentActiveMontage() : nullptr;
+    if (!OutMontage)
+    {
+        return nullptr;
+    }
+
+    UMCS_AttackDatabaseSubsystem* Database = UMCS_AttackDatabaseSubsystem::Get(this);
+    if (!Database)
+    {
+        return nullptr;
+    }
+
+    OutPosition = AnimInstance->Montage_GetPosition(OutMontage);
+    OutPlayRate = FMath::Max(AnimInstance->Montage_GetPlayRate(OutMontage), KINDA_SMALL_NUMBER);
+    return Database->GetMontageTimeline(OutMontage);
+}
+
+/*
+ * Predicts when the montage the attacker is playing reaches its first damaging window,
+ * from the montage's cached notify timeline and the attacker's current position and play rate.
+ */
+bool UMCS_CombatDefenseComponent::PredictImpact(AActor* Attacker, FMCS_IncomingThreat& OutThreat) const
+{
+    const UWorld* World = GetWorld();
+    const UAnimMontage* Montage = nullptr;
+    float Position = 0.f;
+    float PlayRate = 1.f;
+
+    const TSharedPtr<const FMCS_MontageTimeline> Timeline = GetPlayingTimeline(Attacker, Montage, Position, PlayRate);
+    if (!World || !Timeline.IsValid())
+    {
+        return false;
+    }
+
+    const FMCS_MontageWindow* Impact = Timeline->FindNextImpact(Position);
+    if (!Impact)
+    {
+        return false;
+    }
+
+    const FMCS_MontageWindow* Parry = Timeline->FindNextWindow(EMCS_AnimEventType::ParryWindow, Position);
+
+    OutThreat.Attacker = Attacker;
+    OutThreat.Montage = Montage;
+    OutThreat.ImpactTime = World->GetTimeSeconds() + FMath::Max(Impact->StartTime - Position, 0.f) / PlayRate;
+    OutThreat.bParryable = Parry && Parry->StartTime <= Impact->EndTime;
     return true;
 }
 
+/*
+ * Converts the remaining windows of a type in an actor's playing montage to absolute world-time intervals.
+ */
+bool UMCS_CombatDefenseComponent::AddTimelineWindows(AActor* Source, EMCS_AnimEventType EventType, TArray<FMCS_TimedWindow>& OutWindows) const
+{
+    const UWorld* World = GetWorld();
+    const UAnimMontage* Montage = nullptr;
+    float Position = 0.f;
+    float PlayRate = 1.f;
+
+    const TSharedPtr<const FMCS_MontageTimeline> Timeline = GetPlayingTimeline(Source, Montage, Position, PlayRate);
+    if (!World || !Timeline.IsValid())
+    {
+        return false;
+    }
+
+    const float Now = World->GetTimeSeconds();
+    bool bAdded = false;
+
+    for (const FMCS_MontageWindow& MontageWindow : Timeline->Windows)
+    {
+        if (MontageWindow.EventType != EventType || MontageWindow.EndTime <= Position)
+        {
+            continue;
+        }
+
+        // Replace what we knew about this montage's windows rather than duplicating them
+        if (!bAdded)
+        {
+            OutWindows.RemoveAll([ Source, Montage ] (const FMCS_TimedWindow& Window)
+                {
+                    return Window.Source == Source && Window.Montage == Montage;
+                });
+        }
+
+        FMCS_TimedWindow& Window = OutWindows.AddDefaulted_GetRef();
+        Window.Source = Source;
+        Window.Montage = Montage;
+        Window.StartTime = Now + (MontageWindow.StartTime - Position) / PlayRate; // may be in the past
+        Window.EndTime = Now + (MontageWindow.EndTime - Position) / PlayRate;
+        bAdded = true;
+    }
+
+    return bAdded;
+}
+
+void UMCS_CombatDefenseComponent::PruneWindows(TArray<FMCS_TimedWindow>& Windows, float Now) const
+{
+    const float Cutoff = Now - MaxInputAge - TimingGraceMargin;
+    Windows.RemoveAll([ Cutoff ] (const FMCS_TimedWindow& Window)
+        {
+            return Window.EndTime < Cutoff || !Window.Source.IsValid();
+        });
+}
+
+const FMCS_TimedWindow* UMCS_CombatDefenseComponent::FindWindow(const TArray<FMCS_TimedWindow>& Windows, float InputTime, float Now) const
+{
+    for (const FMCS_TimedWindow& Window : Windows)
+    {
+        if (!Window.Contains(InputTime, TimingGraceMargin))
+        {
+            continue;
+        }
+
+        // A predicted window that hasn't finished only counts while its montage is still playing
+        if (Window.Montage.IsValid() && Now < Window.EndTime)
+        {
+            const UAnimInstance* AnimInstance = MCS_Threat::GetAnimInstance(Window.Source.Get());
+            if (!AnimInstance || !AnimInstance->Montage_IsPlaying(Window.Montage.Get()))
+            {
+                continue;
+            }
+        }
+
+        return &Window;
+    }
+    return nullptr;
+}
+
+void UMCS_CombatDefenseComponent::ResolvePendingInputs()
+{
+    const UWorld* World = GetWorld();
+    if (!World)
+    {
+        return;
+    }
+
+    const float Now = World->GetTimeSeconds();
+
+    if (PendingParryInputTime >= 0.f)
+    {
+        if (const FMCS_TimedWindow* Window = FindWindow(ParryWindows, PendingParryInputTime, Now))
+        {
+            PendingParryInputTime = -1.f;
+            CompleteParry(Window->Source.Get());
+        }
+    }
+
+    if (PendingDefenseInputTime >= 0.f && FindWindow(DefenseWindows, PendingDefenseInputTime, Now))
+    {
+        PendingDefenseInputTime = -1.f;
+        CompleteDefense();
+    }
+}
+
+void UMCS_CombatDefenseComponent::SchedulePendingExpiry()
+{
+    UWorld* World = GetWorld();
+    if (!World)
+    {
+        return;
+    }
+
+    // Expire at the oldest pending input's deadline
+    float Oldest = MAX_flt;
+    if (PendingParryInputTime >= 0.f) Oldest = FMath::Min(Oldest, PendingParryInputTime);
+    if (PendingDefenseInputTime >= 0.f) Oldest = FMath::Min(Oldest, PendingDefenseInputTime);
+
+    if (Oldest == MAX_flt)
+    {
+        World->GetTimerManager().ClearTimer(PendingInputTimerHandle);
+        return;
+    }
+
+    const float Delay = Oldest + TimingGraceMargin - World->GetTimeSeconds();
+    World->GetTimerManager().SetTimer(PendingInputTimerHandle, this, &UMCS_CombatDefenseComponent::HandlePendingInputExpired,
+        FMath::Max(Delay, KINDA_SMALL_NUMBER), false);
+}
+
+void UMCS_CombatDefenseComponent::HandlePendingInputExpired()
+{
+    const UWorld* World = GetWorld();
+    if (!World)
+    {
+        return;
+    }
+
+    const float Deadline = World->GetTimeSeconds() - TimingGraceMargin + KINDA_SMALL_NUMBER;
+
+    if (PendingParryInputTime >= 0.f && PendingParryInputTime <= Deadline)
+    {
+        PendingParryInputTime = -1.f;
+        UE_LOG(LogTemp, Warning, TEXT("[CombatDefense] Parry failed: No active window or invalid source."));
+        OnParryFail.Broadcast();
+    }
+
+    if (PendingDefenseInputTime >= 0.f && PendingDefenseInputTime <= Deadline)
+    {
+        PendingDefenseInputTime = -1.f;
+        UE_LOG(LogTemp, Warning, TEXT("[CombatDefense] Block failed: No active defense window."));
+        OnDefenseFail.Broadcast();
+    }
+
+    SchedulePendingExpiry();
+}
+
+/*
+ * Arms a single timer for the earliest tracked impact (no per-frame polling).
+ */
+void UMCS_CombatDefenseComponent::ScheduleNextThreat()
+{
+    UWorld* World = GetWorld();
+    if (!World)
+    {
+        return;
+    }
+
+    FTimerManager& TimerManager = World->GetTimerManager();
+    if (IncomingThreats.IsEmpty())
+    {
+        TimerManager.ClearTimer(ThreatTimerHandle);
+        return;
+    }
+
+    const float Delay = IncomingThreats[0].ImpactTime - DefenseLeadTime - World->GetTimeSeconds();
+    TimerManager.SetTimer(ThreatTimerHandle, this, &UMCS_CombatDefenseComponent::HandleThreatDue, FMath::Max(Delay, KINDA_SMALL_NUMBER), false);
+}
+
+/*
+ * Chooses a defense against every threat whose impact is within Defense Lead Time,
+ * skipping attacks that were interrupted since they were predicted.
+ */
+void UMCS_CombatDefenseComponent::HandleThreatDue()
+{
+    const UWorld* World = GetWorld();
+    if (!World)
+    {
+        return;
+    }
+
+    const float Now = World->GetTimeSeconds();
+
+    while (!IncomingThreats.IsEmpty() && IncomingThreats[0].ImpactTime - DefenseLeadTime <= Now + KINDA_SMALL_NUMBER)
+    {
+        const FMCS_IncomingThreat Threat = IncomingThreats[0];
+        IncomingThreats.RemoveAt(0, EAllowShrinking::No);
+
+        AActor* Attacker = Threat.Attacker.Get();
+        const UAnimInstance* AnimInstance = MCS_Threat::GetAnimInstance(Attacker);
+        if (!AnimInstance || !AnimInstance->Montage_IsPlaying(Threat.Montage.Get()))
+        {
+            continue;
+        }
+
+        const EMCS_DefenseIntent Intent = (bParryWhenPossible && Threat.bParryable) ? EMCS_DefenseIntent::Parry : EMCS_DefenseIntent::Defense;
+        // Stored apart from CurrentDefense: the stamina cost is only charged for a committed defense
+        if (ChooseDefense(Attacker, Intent, PredictedDefense))
+        {
+            UE_LOG(LogTemp, Verbose, TEXT("[CombatDefense] Defense due against %s: %s (impact in %.3fs)"),
+                *GetNameSafe(Attacker), *PredictedDefense.DefenseName.ToString(), Threat.ImpactTime - Now);
+
+            OnDefenseDue.Broadcast(Attacker, FMath::Max(Threat.ImpactTime - Now, 0.f), Intent);
+        }
+    }
+
+    ScheduleNextThreat();
+}
@@ -22,6 +22,12 @@
 #include "GameFramework/Character.h"
 #include "Engine/DataTable.h"
 #include "Kismet/KismetSystemLibrary.h"
+#include <SubSystems/MCS_CombatGridSubsystem.h>
+#include <SubSystems/MCS_ResourceSubsystem.h>
+#include <SubSystems/MCS_CombatBudgetSubsystem.h>
+#include <SubSystems/MCS_AttackDatabaseSubsystem.h>
+#include <SubSystems/MCS_CombatWorldSubsystem.h>
+#include <SubSystems/MCS_HitConfirmSubsystem.h>
 
 
  // Constructor
@@ -34,6 +40,29 @@ UMCS_CombatHitReactionComponent::UMCS_CombatHitReactionComponent()
 void UMCS_CombatHitReactionComponent::BeginPlay()
 {
     Super::BeginPlay();
+
+    // Anything that can react to hits must be findable by projectiles and area attacks
+    if (UWorld* World = GetWorld())
+    {
+        if (UMCS_CombatGridSubsystem* Grid = World->GetSubsystem<UMCS_CombatGridSubsystem>())
+        {
+            Grid->RegisterCombatant(GetOwner());
+        }
+    }
+}
+
+// Called when the component is removed from play
+void UMCS_CombatHitReactionComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (UWorld* World = GetWorld())
+    {
+        if (UMCS_CombatGridSubsystem* Grid = World->GetSubsystem<UMCS_CombatGridSubsystem>())
+        {
+            Grid->UnregisterCombatant(GetOwner());
+        }
+    }
+
+    Super::EndPlay(EndPlayReason);
 }
 
 /**
@@ -47,7 +76,9 @@ void UMCS_CombatHitReactionComponent::BeginPlay()
  */
 void UMCS_CombatHitReactionComponent::PerformHitReaction(const FHitResult& Hit, AActor* TargetActor, EPGAS_HitSeverity Severity)
 {
-    if (!HitReactionDataTable)
+    FMCS_BudgetScope BudgetScope(this, EMCS_BudgetCategory::Reactions);
+
+    if (HitReactionDataTable.IsNull())
     {
         UE_LOG(LogTemp, Warning, TEXT("[HitReaction] No HitReactionDataTable assigned."));
         return;
@@ -96,6 +127,121 @@ void UMCS_CombatHitReactionComponent::PerformHitReaction(const FHitResult& Hit,
         static_cast<int32>(Severity));
 }
 
+/**
+ * Defers ReactToHit to the Reactions phase of the combat world pipeline.
+ */
+void UMCS_CombatHitReactionComponent::QueueReactToHit(const FHitResult& Hit, AActor* Attacker, const FMCS_AttackEntry& Attack)
+{
+    UMCS_CombatWorldSubsystem* Pipeline = UMCS_CombatWorldSubsystem::Get(this);
+    if (!Pipeline)
+    {
+        ReactToHit(Hit, Attacker, Attack);
+        return;
+    }
+
+    Pipeline->Defer(EMCS_CombatPhase::Reactions,
+        [WeakThis = TWeakObjectPtr<UMCS_CombatHitReactionComponent>(this), Hit, WeakAttacker = TWeakObjectPtr<AActor>(Attacker), Attack]()
+        {
+            if (UMCS_CombatHitReactionComponent* This = WeakThis.Get())
+            {
+                This->ReactToHit(Hit, WeakAttacker.Get(), Attack);
+            }
+        });
+}
+
+/**
+ * Applies an attack's poise damage to the owner and plays the matching reaction level.
+ * Poise lives in the resource store (accumulated and decayed there in one batched pass);
+ * this only decides what the new value means for the hit.
+ *
+ * @param Hit - The hit result data containing impact point and bone info.
+ * @param Attacker - The actor that landed the hit.
+ * @param Attack - The attack that landed.
+ * @return The reaction level that was played.
+ */
+EMCS_HitReactionLevel UMCS_CombatHitReactionComponent::ReactToHit(const FHitResult& Hit, AActor* Attacker, const FMCS_AttackEntry& Attack)
+{
+    FMCS_BudgetScope BudgetScope(this, EMCS_BudgetCategory::Reactions);
+
+    AActor* Owner = GetOwner();
+    if (!IsValid(Owner))
+    {
+        return EMCS_HitReactionLevel::None;
+    }
+
+    UWorld* World = GetWorld();
+    UMCS_ResourceSubsystem* Store = World ? World->GetSubsystem<UMCS_ResourceSubsystem>() : nullptr;
+    const int32 Slot = Store ? Store->FindSlot(Owner) : INDEX_NONE;
+
+    // No poise meter (or an unstoppable hit): every hit is a full reaction, as before
+    EMCS_HitReactionLevel Level = EMCS_HitReactionLevel::Full;
+
+    if (Slot != INDEX_NONE && Attack.HitSeverity < AlwaysFullReactionSeverity)
+    {
+        const float Scale = bHyperArmor ? HyperArmorPoiseScale : 1.f;
+        const float NewPoise = Store->AddPoise(Slot, Attack.PoiseDamage * Scale);
+
+        // The store clamps poise to its max, so a threshold above it would never break
+        const float BreakThreshold = FMath::Min(FullReactionThreshold, Store->GetMaxPoise(Slot));
+
+        if (NewPoise >= BreakThreshold)
+        {
+            Level = EMCS_HitReactionLevel::Full;
+        }
+        else if (!bHyperArmor && NewPoise >= FlinchThreshold)
+        {
+            Level = EMCS_HitReactionLevel::Flinch;
+        }
+        else
+        {
+            Level = EMCS_HitReactionLevel::None;
+        }
+    }
+
+    if (Level == EMCS_HitReactionLevel::Full && Slot != INDEX_NONE)
+    {
+        Store->ResetPoise(Slot);
+        OnPoiseBroken.Broadcast(Attacker);
+    }
+
+    PlayReaction(Hit, Level, Attack.HitSeverity);
+
+    // Clients see the outcome through the frame's hit confirm batch
+    if (Owner->HasAuthority() && Owner->GetNetMode() != NM_Standalone)
+    {
+        if (UMCS_HitConfirmSubsystem* Confirms = UMCS_HitConfirmSubsystem::Get(this))
+        {
+            Confirms->ConfirmHit(Hit, Attacker, Owner, Attack, Level);
+        }
+    }
+
+    return Level;
+}
+
+/**
+ * Plays a reaction level without touching poise.
+ *
+ * @param Hit - The hit result data containing impact point and bone info.
+ * @param Level - The reaction level to play.
+ * @param Severity - The severity used to pick the full reaction montage.
+ */
+void UMCS_CombatHitReactionComponent::PlayReaction(const FHitResult& Hit, EMCS_HitReactionLevel Level, EPGAS_HitSeverity Severity)
+{
+    switch (Level)
+    {
+    case EMCS_HitReactionLevel::Full:
+        PerformHitReaction(Hit, GetOwner(), Severity);
+        break;
+
+    case EMCS_HitReactionLevel::Flinch:
+        PlayFlinchInternal(CalculateHitDirection(Hit.ImpactPoint, GetOwner()));
+        break;
+
+    default:
+        break;
+    }
+}
+
 
 /**
  * Finds the best matching hit reaction using bone, region, direction, and severity hierarchy.
@@ -106,11 +252,27 @@ void UMCS_CombatHitReactionComponent::PerformHitReaction(const FHitResult& Hit,
  */
 const FMCS_HitReaction* UMCS_CombatHitReactionComponent::FindReaction(const FName& BoneName, EMCS_Direction Direction, EPGAS_HitSeverity Severity) const
 {
-    if (!HitReactionDataTable) return nullptr;
+    if (HitReactionDataTable.IsNull()) return nullptr;
 
-    static const FString Context(TEXT("FindReaction"));
-    TArray<FMCS_HitReaction*> AllRows;
-    HitReactionDataTable->GetAllRows(Context, AllRows);
+    // Rows are read once per world (or come from a cooked database) and shared by every combatant
+    TArray<const FMCS_HitReaction*, TInlineAllocator<64>> AllRows;
+    if (UMCS_AttackDatabaseSubsystem* Database = UMCS_AttackDatabaseSubsystem::Get(this))
+    {
+        if (const TSharedPtr<const TArray<FMCS_HitReaction>> Reactions = Database->GetHitReactions(HitReactionDataTable))
+        {
+            for (const FMCS_HitReaction& Reaction : *Reactions)
+            {
+                AllRows.Add(&Reaction);
+            }
+        }
+    }
+    else if (const UDataTable* Table = HitReactionDataTable.LoadSynchronous())
+    {
+        static const FString Context(TEXT("FindReaction"));
+        TArray<FMCS_HitReaction*> TableRows;
+        Table->GetAllRows(Context, TableRows);
+        AllRows.Append(TableRows);
+    }
 
     const FMCS_HitReaction* ExactBoneMatch = nullptr;
     const FMCS_HitReaction* RegionMatch = nullptr;
@@ -188,11 +350,51 @@ void UMCS_CombatHitReactionComponent::PlayMontageInternal(UAnimMontage* Montage,
         return;
     }
 
+    // Over the frame budget only a few reactions start per frame; the rest keep their current pose (poise was already applied)
+    UMCS_CombatBudgetSubsystem* Governor = UMCS_CombatBudgetSubsystem::Get(this);
+    if (Governor && !Governor->AdmitReactionMontage())
+    {
+        return;
+    }
+
     // Stop any current reaction to ensure clarity
     AnimInstance->Montage_Stop(0.1f);
     AnimInstance->Montage_Play(Montage, InPlayRate);
 }
 
+/**
+ * Helper: Plays an additive flinch montage for a hit direction.
+ * Unlike PlayMontageInternal this does not stop the current montage.
+ * @param Direction The direction of the hit
+ */
+void UMCS_CombatHitReactionComponent::PlayFlinchInternal(EMCS_Direction Direction)
+{
+    const TObjectPtr<UAnimMontage>* Found = FlinchMontages.Find(Direction);
+    if (!Found || !*Found)
+    {
+        Found = FlinchMontages.Find(EMCS_Direction::None);
+    }
+
+    UAnimMontage* Montage = Found ? Found->Get() : nullptr;
+    if (!Montage)
+        return;
+
+    const ACharacter* CharacterOwner = Cast<ACharacter>(GetOwner());
+    if (!IsValid(CharacterOwner) || !IsValid(CharacterOwner->GetMesh()))
+        return;
+
+    UMCS_CombatBudgetSubsystem* Governor = UMCS_CombatBudgetSubsystem::Get(this);
+    if (Governor && !Governor->AdmitReactionMontage())
+    {
+        return;
+    }
+
+    if (UAnimInstance* AnimInstance = CharacterOwner->GetMesh()->GetAnimInstance())
+    {
+        AnimInstance->Montage_Play(Montage);
+    }
+}
+
 /**
  * Calculates hit direction based on hit location relative to the target actor.
  * @param HitLocation The world location of the hit.
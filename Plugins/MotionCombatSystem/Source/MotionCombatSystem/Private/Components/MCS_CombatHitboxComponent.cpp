@@ -16,8 +16,69 @@
 #include "Components/MCS_CombatHitboxComponent.h"
 #include "GameFramework/Actor.h"
 #include "Components/SkeletalMeshComponent.h"
+#include "Components/PrimitiveComponent.h"
 #include "Engine/World.h"
+#include "Animation/AnimInstance.h"
 #include "DrawDebugHelpers.h"
+#include <SubSystems/MCS_AttackDatabaseSubsystem.h>
+#include <SubSystems/MCS_LatencySubsystem.h>
+#include <SubSystems/MCS_CombatGridSubsystem.h>
+#include <SubSystems/MCS_CombatBudgetSubsystem.h>
+#include <SubSystems/MCS_CombatWorldSubsystem.h>
+#include <Stats/MCS_Stats.h>
+
+DECLARE_CYCLE_STAT(TEXT("Hitbox Areas"), STAT_MCS_HitboxAreas, STATGROUP_MotionCombat);
+
+namespace MCS_Area
+{
+    /**
+     * Tests candidate offsets (relative to the area center) four at a time.
+     * A candidate passes when its cylinder overlaps the annulus [Inner, Outer] in the horizontal plane,
+     * the vertical extent, and (for cones) the angular window around Forward.
+     * Arrays must be padded to a multiple of 4.
+     */
+    static void TestCandidates(
+        const float* DX, const float* DY, const float* DZ, const float* Radius, const float* Height, int32 PaddedCount,
+        float InnerRadius, float OuterRadius, float HalfHeight, const FVector& Forward, float ConeCos, bool bCone, TArray<uint8>& OutPass)
+    {
+        const VectorRegister4Float Inner = VectorSetFloat1(InnerRadius);
+        const VectorRegister4Float Outer = VectorSetFloat1(OuterRadius);
+        const VectorRegister4Float AreaHeight = VectorSetFloat1(HalfHeight);
+        const VectorRegister4Float ForwardX = VectorSetFloat1(static_cast<float>(Forward.X));
+        const VectorRegister4Float ForwardY = VectorSetFloat1(static_cast<float>(Forward.Y));
+        const VectorRegister4Float Cos = VectorSetFloat1(ConeCos);
+
+        OutPass.SetNumUninitialized(PaddedCount);
+
+        for (int32 i = 0; i < PaddedCount; i += 4)
+        {
+            const VectorRegister4Float X = VectorLoad(DX + i);
+            const VectorRegister4Float Y = VectorLoad(DY + i);
+            const VectorRegister4Float Z = VectorLoad(DZ + i);
+            const VectorRegister4Float R = VectorLoad(Radius + i);
+            const VectorRegister4Float H = VectorLoad(Height + i);
+
+            const VectorRegister4Float Dist = VectorSqrt(VectorMultiplyAdd(X, X, VectorMultiply(Y, Y)));
+
+            VectorRegister4Float Pass = VectorCompareLE(Dist, VectorAdd(Outer, R));
+            Pass = VectorBitwiseAnd(Pass, VectorCompareGE(Dist, VectorSubtract(Inner, R)));
+            Pass = VectorBitwiseAnd(Pass, VectorCompareLE(VectorAbs(Z), VectorAdd(AreaHeight, H)));
+
+            if (bCone)
+            {
+                // Dot + R >= Cos * Dist widens the cone by the target radius
+                const VectorRegister4Float Dot = VectorMultiplyAdd(ForwardX, X, VectorMultiply(ForwardY, Y));
+                Pass = VectorBitwiseAnd(Pass, VectorCompareGE(VectorAdd(Dot, R), VectorMultiply(Cos, Dist)));
+            }
+
+            const int32 Bits = VectorMaskBits(Pass);
+            OutPass[i + 0] = (Bits >> 0) & 1;
+            OutPass[i + 1] = (Bits >> 1) & 1;
+            OutPass[i + 2] = (Bits >> 2) & 1;
+            OutPass[i + 3] = (Bits >> 3) & 1;
+        }
+    }
+}
 
 UMCS_CombatHitboxComponent::UMCS_CombatHitboxComponent()
 {
@@ -32,6 +93,8 @@ void UMCS_CombatHitboxComponent::BeginPlay()
 
 void UMCS_CombatHitboxComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
+    LLM_SCOPE_BYTAG(MotionCombat_HitBuffers);
+
     Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 
     if (GetWorld()->bIsTearingDown || !IsValid(GetOwner()))
@@ -43,10 +106,37 @@ void UMCS_CombatHitboxComponent::TickComponent(float DeltaTime, ELevelTick TickT
     {
         PerformSweep();
     }
+
+    if (PendingSightChecks.Num() > 0)
+    {
+        ResolveSightChecks();
+    }
+
+    if (ActiveAreas.Num() > 0)
+    {
+        UpdateAreas(DeltaTime);
+    }
+
+    UpdateTickEnabled();
+}
+
+void UMCS_CombatHitboxComponent::GetResourceSizeEx(FResourceSizeEx& CumulativeResourceSize)
+{
+    Super::GetResourceSizeEx(CumulativeResourceSize);
+
+    CumulativeResourceSize.AddDedicatedSystemMemoryBytes(
+        AlreadyHitActors.GetAllocatedSize() + ActiveAreas.GetAllocatedSize() + PendingSightChecks.GetAllocatedSize()
+        + SweepSteps.GetAllocatedSize() + SweepHits.GetAllocatedSize() + StepHits.GetAllocatedSize() + PendingHits.GetAllocatedSize()
+        + ReachCandidates.GetAllocatedSize() + AreaCandidates.GetAllocatedSize() + AreaDX.GetAllocatedSize() + AreaDY.GetAllocatedSize()
+        + AreaDZ.GetAllocatedSize() + AreaRadius.GetAllocatedSize() + AreaHeight.GetAllocatedSize());
 }
 
 void UMCS_CombatHitboxComponent::StartHitDetection(const FMCS_AttackEntry& Attack, const FMCS_AttackHitbox& Hitbox)
 {
+    // Roles outside NetExecution don't detect; the authority's hits reach them replicated
+    if (!MCS_NetRole::ShouldExecute(this, NetExecution))
+        return;
+
     // ActiveHitbox = Attack.Hitbox; // cache hitbox from AttackType
     ActiveAttack = Attack;          // cache full attack type
     ActiveHitbox = Hitbox;          // cache hitbox
@@ -54,6 +144,8 @@ void UMCS_CombatHitboxComponent::StartHitDetection(const FMCS_AttackEntry& Attac
 
     AlreadyHitActors.Reset(); // clear at start of swing
 
+    ActiveReach = bCullByReach ? ResolveWindowReach(Attack) : FBox(ForceInit);
+
     // Cache initial socket positions
     if (USkeletalMeshComponent* Mesh = ResolveMesh())
     {
@@ -61,14 +153,342 @@ void UMCS_CombatHitboxComponent::StartHitDetection(const FMCS_AttackEntry& Attac
         PrevEndLoc = Mesh->GetSocketLocation(ActiveHitbox.EndSocket);
     }
 
-    SetComponentTickEnabled(true); // enable ticking
+    UpdateTickEnabled(); // join the pipeline (or enable ticking)
+
+    if (UMCS_LatencySubsystem* Latency = UMCS_LatencySubsystem::Get(this))
+    {
+        Latency->MarkHitboxActive(GetOwner());
+    }
 }
 
 void UMCS_CombatHitboxComponent::StopHitDetection()
 {
     bIsDetecting = false;
-    AlreadyHitActors.Reset(); // clear at end of swing
-    SetComponentTickEnabled(false); // disable ticking
+
+    // clear at end of swing, unless an area of the same attack still needs the set
+    if (ActiveAreas.Num() == 0)
+    {
+        AlreadyHitActors.Reset();
+    }
+
+    UpdateTickEnabled(); // disable ticking if nothing else is active
+}
+
+void UMCS_CombatHitboxComponent::StartAreaDetection(const FMCS_AttackEntry& Attack, FName NotifyId)
+{
+    AActor* Owner = GetOwner();
+    if (!IsValid(Owner) || !MCS_NetRole::ShouldExecute(this, NetExecution))
+        return;
+
+    LLM_SCOPE_BYTAG(MotionCombat_HitBuffers);
+
+    // First hit source of a new attack starts a fresh already-hit set
+    if (!bIsDetecting && ActiveAreas.Num() == 0 && PendingSightChecks.Num() == 0)
+    {
+        AlreadyHitActors.Reset();
+    }
+
+    AreaAttack = Attack;
+
+    for (const FMCS_AttackArea& Area : Attack.Areas)
+    {
+        if (Area.NotifyId != NAME_None && Area.NotifyId != NotifyId)
+            continue;
+
+        FActiveArea& Active = ActiveAreas.AddDefaulted_GetRef();
+        Active.Area = Area;
+        Active.Center = ResolveAreaCenter(Area);
+        Active.Forward = Owner->GetActorForwardVector();
+    }
+
+    UpdateTickEnabled();
+
+    if (UMCS_LatencySubsystem* Latency = UMCS_LatencySubsystem::Get(this))
+    {
+        Latency->MarkHitboxActive(Owner);
+    }
+}
+
+void UMCS_CombatHitboxComponent::StopAreaDetection()
+{
+    ActiveAreas.Reset();
+    PendingSightChecks.Reset();
+    UpdateTickEnabled();
+}
+
+void UMCS_CombatHitboxComponent::UpdateTickEnabled()
+{
+    const bool bActive = HasActiveWork();
+
+    // The pipeline drops the hitbox by itself once it has nothing left to do
+    UMCS_CombatWorldSubsystem* Pipeline = bActive ? UMCS_CombatWorldSubsystem::Get(this) : nullptr;
+    if (Pipeline && Pipeline->bEnabled)
+    {
+        bPipelineDriven = true;
+        Pipeline->RegisterHitbox(this);
+        SetComponentTickEnabled(false);
+        return;
+    }
+
+    bPipelineDriven = false;
+    SetComponentTickEnabled(bActive);
+}
+
+void UMCS_CombatHitboxComponent::ReleaseFromPipeline()
+{
+    // Nothing is left queued between pipeline ticks, so the tick starts with a clean slate
+    bPipelineDriven = false;
+    SetComponentTickEnabled(HasActiveWork());
+}
+
+FVector UMCS_CombatHitboxComponent::ResolveAreaCenter(const FMCS_AttackArea& Area) const
+{
+    const AActor* Owner = GetOwner();
+    FVector Center = Owner->GetActorLocation();
+
+    if (Area.CenterSocket != NAME_None)
+    {
+        if (const USkeletalMeshComponent* Mesh = ResolveMesh(); Mesh && Mesh->DoesSocketExist(Area.CenterSocket))
+        {
+            Center = Mesh->GetSocketLocation(Area.CenterSocket);
+        }
+    }
+
+    return Center + Owner->GetActorRotation().RotateVector(Area.Offset);
+}
+
+void UMCS_CombatHitboxComponent::UpdateAreas(float DeltaTime)
+{
+    FMCS_BudgetScope BudgetScope(this, EMCS_BudgetCategory::Sweeps);
+
+    TestAreas(DeltaTime);
+    FinishAreas();
+}
+
+void UMCS_CombatHitboxComponent::TestAreas(float DeltaTime)
+{
+    SCOPE_CYCLE_COUNTER(STAT_MCS_HitboxAreas);
+
+    AActor* Owner = GetOwner();
+    UMCS_CombatGridSubsystem* Grid = GetWorld()->GetSubsystem<UMCS_CombatGridSubsystem>();
+    if (!Grid)
+    {
+        ActiveAreas.Reset();
+        return;
+    }
+
+    Grid->RebuildIfStale();
+
+    const uint8 OwnerTeam = UMCS_CombatGridSubsystem::GetTeamOf(Owner);
+    const TArray<float>& PosX = Grid->GetPositionsX();
+    const TArray<float>& PosY = Grid->GetPositionsY();
+    const TArray<float>& PosZ = Grid->GetPositionsZ();
+    const TArray<float>& Radii = Grid->GetRadii();
+    const TArray<float>& HalfHeights = Grid->GetHalfHeights();
+    const TArray<uint8>& Teams = Grid->GetTeams();
+
+    TArray<uint8> Pass;
+
+    for (int32 AreaIndex = 0; AreaIndex < ActiveAreas.Num(); ++AreaIndex)
+    {
+        FActiveArea& Active = ActiveAreas[AreaIndex];
+        const FMCS_AttackArea& Area = Active.Area;
+
+        if (Area.bFollowOwner)
+        {
+            Active.Center = ResolveAreaCenter(Area);
+            Active.Forward = Owner->GetActorForwardVector();
+        }
+
+        Active.Elapsed += DeltaTime;
+
+        //----------------------------------------
+        // Shape parameters for this frame
+        //----------------------------------------
+        float Inner = 0.f;
+        float Outer = Area.Radius;
+
+        if (Area.Shape == EMCS_AreaShape::Ring)
+        {
+            Inner = FMath::Min(Area.InnerRadius, Area.Radius);
+        }
+        else if (Area.Shape == EMCS_AreaShape::ExpandingShell)
+        {
+            const float Alpha = Area.Duration > 0.f ? FMath::Clamp(Active.Elapsed / Area.Duration, 0.f, 1.f) : 1.f;
+            Outer = Area.Radius * Alpha;
+
+            // Cover the whole band swept since last frame so fast waves don't skip targets
+            Inner = FMath::Max(FMath::Min(Active.PrevShellRadius, Outer - Area.ShellThickness), 0.f);
+            Active.PrevShellRadius = Outer;
+        }
+
+        Active.Inner = Inner;
+        Active.Outer = Outer;
+
+        const bool bCone = Area.Shape == EMCS_AreaShape::Cone;
+        const float ConeCos = FMath::Cos(FMath::DegreesToRadians(Area.ConeHalfAngle));
+        const FVector Forward = Active.Forward.GetSafeNormal2D();
+        const FVector Center = Active.Center;
+
+        //----------------------------------------
+        // Broad phase + scalar filters (self, team, already hit)
+        //----------------------------------------
+        const float Pad = Outer + Grid->GetMaxRadius();
+        const FBox Bounds(
+            Center - FVector(Pad, Pad, Area.HalfHeight + Grid->GetMaxHalfHeight()),
+            Center + FVector(Pad, Pad, Area.HalfHeight + Grid->GetMaxHalfHeight()));
+
+        AreaCandidates.Reset();
+        Grid->GatherCandidates(Bounds, AreaCandidates);
+
+        AreaDX.Reset();
+        AreaDY.Reset();
+        AreaDZ.Reset();
+        AreaRadius.Reset();
+        AreaHeight.Reset();
+
+        int32 Kept = 0;
+        for (const int32 Candidate : AreaCandidates)
+        {
+            AActor* Actor = Grid->GetActor(Candidate);
+            if (!Actor || Actor == Owner || AlreadyHitActors.Contains(Actor) ||
+                !UMCS_CombatGridSubsystem::CanAffectTeam(OwnerTeam, Teams[Candidate], Area.bFriendlyFire))
+                continue;
+
+            AreaCandidates[Kept++] = Candidate;
+            AreaDX.Add(PosX[Candidate] - Center.X);
+            AreaDY.Add(PosY[Candidate] - Center.Y);
+            AreaDZ.Add(PosZ[Candidate] - Center.Z);
+            AreaRadius.Add(Radii[Candidate]);
+            AreaHeight.Add(HalfHeights[Candidate]);
+        }
+        AreaCandidates.SetNum(Kept, EAllowShrinking::No);
+
+        // Pad with far-away lanes that always fail
+        const int32 Padded = Align(Kept, 4);
+        for (int32 i = Kept; i < Padded; ++i)
+        {
+            AreaDX.Add(1.e10f);
+            AreaDY.Add(1.e10f);
+            AreaDZ.Add(1.e10f);
+            AreaRadius.Add(0.f);
+            AreaHeight.Add(0.f);
+        }
+
+        //----------------------------------------
+        // Narrow phase (4-wide)
+        //----------------------------------------
+        MCS_Area::TestCandidates(AreaDX.GetData(), AreaDY.GetData(), AreaDZ.GetData(), AreaRadius.GetData(), AreaHeight.GetData(), Padded,
+            Inner, Outer, Area.HalfHeight, Forward, ConeCos, bCone, Pass);
+
+        for (int32 i = 0; i < Kept; ++i)
+        {
+            if (!Pass[i])
+                continue;
+
+            AActor* HitActor = Grid->GetActor(AreaCandidates[i]);
+            const FVector TargetLocation = Grid->GetLocation(AreaCandidates[i]);
+            const FVector ToTarget = FVector(AreaDX[i], AreaDY[i], 0.f).GetSafeNormal();
+
+            FHitResult Hit(HitActor, Cast<UPrimitiveComponent>(HitActor->GetRootComponent()), TargetLocation - ToTarget * AreaRadius[i], -ToTarget);
+            Hit.TraceStart = Center;
+            Hit.TraceEnd = TargetLocation;
+            Hit.bBlockingHit = true;
+
+            AlreadyHitActors.Add(HitActor);
+
+            if (!Area.bRequireLineOfSight)
+            {
+                RegisterHit(HitActor, Hit, AreaAttack);
+                continue;
+            }
+
+            // Sight checks are issued together (FinishAreas) and resolved next frame
+            FPendingSightCheck& Check = PendingSightChecks.AddDefaulted_GetRef();
+            Check.Actor = HitActor;
+            Check.Hit = Hit;
+        }
+    }
+}
+
+void UMCS_CombatHitboxComponent::FinishAreas()
+{
+    AActor* Owner = GetOwner();
+
+    //----------------------------------------
+    // Issue the sight traces queued by TestAreas
+    //----------------------------------------
+    for (FPendingSightCheck& Check : PendingSightChecks)
+    {
+        if (Check.Handle.IsValid())
+            continue;
+
+        FCollisionQueryParams Params(SCENE_QUERY_STAT(MCS_AreaSight), false, Owner);
+        Params.AddIgnoredActor(Check.Actor.Get());
+
+        FCollisionObjectQueryParams ObjParams;
+        ObjParams.AddObjectTypesToQuery(ECC_WorldStatic);
+        ObjParams.AddObjectTypesToQuery(ECC_WorldDynamic);
+
+        Check.Handle = GetWorld()->AsyncLineTraceByObjectType(EAsyncTraceType::Single, Check.Hit.TraceStart, Check.Hit.TraceEnd, ObjParams, Params);
+    }
+
+#if WITH_EDITORONLY_DATA || UE_BUILD_DEVELOPMENT
+    const UMCS_CombatBudgetSubsystem* Governor = UMCS_CombatBudgetSubsystem::Get(this);
+    const bool bAllowDebugDraw = !Governor || Governor->AllowDebugDraw();
+
+    for (const FActiveArea& Active : ActiveAreas)
+    {
+        const FMCS_AttackArea& Area = Active.Area;
+        const bool bCone = Area.Shape == EMCS_AreaShape::Cone;
+        const FVector Center = Active.Center;
+        const float Inner = Active.Inner;
+        const float Outer = Active.Outer;
+
+        if (Area.bDebugDraw && bAllowDebugDraw)
+        {
+            const FColor Color = bCone ? FColor::Orange : FColor::Purple;
+            DrawDebugCircle(GetWorld(), Center, Outer, 32, Color, false, 0.05f, 0, 2.f, FVector::ForwardVector, FVector::RightVector, false);
+            if (Inner > 0.f)
+            {
+                DrawDebugCircle(GetWorld(), Center, Inner, 32, Color, false, 0.05f, 0, 1.f, FVector::ForwardVector, FVector::RightVector, false);
+            }
+            if (bCone)
+            {
+                const float HalfAngle = FMath::DegreesToRadians(Area.ConeHalfAngle);
+                DrawDebugCone(GetWorld(), Center, Active.Forward.GetSafeNormal2D(), Outer, HalfAngle, 0.f, 12, Color, false, 0.05f);
+            }
+        }
+    }
+#endif
+
+    // Areas past their duration (single-frame areas after one test) are done
+    ActiveAreas.RemoveAll([] (const FActiveArea& Active) { return Active.Elapsed >= Active.Area.Duration; });
+}
+
+void UMCS_CombatHitboxComponent::ResolveSightChecks()
+{
+    for (const FPendingSightCheck& Check : PendingSightChecks)
+    {
+        AActor* HitActor = Check.Actor.Get();
+        if (!HitActor)
+            continue;
+
+        FTraceDatum Datum;
+        const bool bHasResult = GetWorld()->QueryTraceData(Check.Handle, Datum);
+
+        if (bHasResult && !FHitResult::GetFirstBlockingHit(Datum.OutHits))
+        {
+            RegisterHit(HitActor, Check.Hit, AreaAttack);
+        }
+        else
+        {
+            // Blocked: a lasting area may still reach it from another angle
+            AlreadyHitActors.Remove(HitActor);
+        }
+    }
+
+    PendingSightChecks.Reset();
 }
 
 void UMCS_CombatHitboxComponent::PerformSweep()
@@ -76,8 +496,25 @@ void UMCS_CombatHitboxComponent::PerformSweep()
     if (!IsValid(GetOwner()))
         return;
 
+    FMCS_BudgetScope BudgetScope(this, EMCS_BudgetCategory::Sweeps);
+
+    // The budget governor may lower substeps and suppress debug draws under load
+    const UMCS_CombatBudgetSubsystem* Governor = UMCS_CombatBudgetSubsystem::Get(this);
+    const int32 Substeps = FMath::Max(Governor ? Governor->GetSubstepCount(SubstepCount) : SubstepCount, 1);
+
+    PrepareSweep(Substeps);
+    RunSweepQueries();
+    FilterSweepHits();
+    DrawSweepDebug();
+}
+
+void UMCS_CombatHitboxComponent::PrepareSweep(int32 Substeps)
+{
+    SweepSteps.Reset();
+    SweepHits.Reset();
+
     // Get mesh component
-    USkeletalMeshComponent* Mesh = ResolveMesh();
+    const USkeletalMeshComponent* Mesh = ResolveMesh();
 
     // Validate mesh and sockets
     if (!Mesh || ActiveHitbox.StartSocket == NAME_None || ActiveHitbox.EndSocket == NAME_None)
@@ -87,74 +524,219 @@ void UMCS_CombatHitboxComponent::PerformSweep()
     const FVector CurrStart = Mesh->GetSocketLocation(ActiveHitbox.StartSocket);
     const FVector CurrEnd = Mesh->GetSocketLocation(ActiveHitbox.EndSocket);
 
-    // Sweep multiple times between previous and current positions (substepping)
-    for (int32 i = 0; i < SubstepCount; i++)
+    // Nobody the swing could reach: skip every substep, but keep tracking the sockets
+    if (!ActiveReach.IsValid || IsAnyoneInReach(*Mesh))
     {
-        const float Alpha = (i + 1) / static_cast<float>(SubstepCount);
+        // Sweep multiple times between previous and current positions (substepping)
+        for (int32 i = 0; i < Substeps; i++)
+        {
+            const float Alpha = (i + 1) / static_cast<float>(Substeps);
+            SweepSteps.Add({ FMath::Lerp(PrevStartLoc, CurrStart, Alpha), FMath::Lerp(PrevEndLoc, CurrEnd, Alpha) });
+        }
+    }
 
-        const FVector StepStart = FMath::Lerp(PrevStartLoc, CurrStart, Alpha);
-        const FVector StepEnd = FMath::Lerp(PrevEndLoc, CurrEnd, Alpha);
+    // Update previous socket locations for next frame
+    PrevStartLoc = CurrStart;
+    PrevEndLoc = CurrEnd;
+}
 
-        // Setup collision parameters
-        FCollisionQueryParams Params(SCENE_QUERY_STAT(MCS_Hitbox), false, GetOwner());
-        Params.bReturnPhysicalMaterial = false;
-        Params.bReturnFaceIndex = false;
-        Params.bTraceComplex = true;
+void UMCS_CombatHitboxComponent::RunSweepQueries()
+{
+    if (SweepSteps.IsEmpty())
+        return;
 
-        FCollisionObjectQueryParams ObjParams;
-        ObjParams.AddObjectTypesToQuery(ECC_Pawn);
-        ObjParams.AddObjectTypesToQuery(ECC_PhysicsBody); // include skeletal mesh bodies
+    // Setup collision parameters
+    FCollisionQueryParams Params(SCENE_QUERY_STAT(MCS_Hitbox), false, GetOwner());
+    Params.bReturnPhysicalMaterial = false;
+    Params.bReturnFaceIndex = false;
+    Params.bTraceComplex = true;
 
-        // Array to store hit results
-        TArray<FHitResult> Hits;
+    FCollisionObjectQueryParams ObjParams;
+    ObjParams.AddObjectTypesToQuery(ECC_Pawn);
+    ObjParams.AddObjectTypesToQuery(ECC_PhysicsBody); // include skeletal mesh bodies
 
+    for (const FSweepStep& Step : SweepSteps)
+    {
         // Perform the sweep
         GetWorld()->SweepMultiByObjectType(
-            Hits,
-            StepStart,
-            StepEnd,
+            StepHits,
+            Step.Start,
+            Step.End,
             FQuat::Identity,
             ObjParams,
             FCollisionShape::MakeSphere(ActiveHitbox.Radius),
             Params
         );
 
-        // Process hit results
-        for (const FHitResult& Hit : Hits)
+        SweepHits.Append(StepHits);
+    }
+}
+
+void UMCS_CombatHitboxComponent::FilterSweepHits()
+{
+    DebugImpacts.Reset();
+
+    // Process hit results
+    for (const FHitResult& Hit : SweepHits)
+    {
+        if (AActor* HitActor = Hit.GetActor())
         {
-            if (AActor* HitActor = Hit.GetActor())
-            {
-                if (HitActor == GetOwner()) // skip self
-                    continue;
+            if (HitActor == GetOwner()) // skip self
+                continue;
 
-                if (AlreadyHitActors.Contains(HitActor)) // skip duplicate hits in same swing
-                    continue;
+            if (AlreadyHitActors.Contains(HitActor)) // skip duplicate hits in same swing
+                continue;
 
-                AlreadyHitActors.Add(HitActor); // mark as hit
-                OnHitboxHit.Broadcast(HitActor, Hit, ActiveAttack); // Broadcast hit event
+            AlreadyHitActors.Add(HitActor); // mark as hit
+            RegisterHit(HitActor, Hit, ActiveAttack); // Broadcast hit event
 
-                if (ActiveHitbox.bDebugDraw)
-                {
-                    DrawDebugSphere(GetWorld(), Hit.ImpactPoint, ActiveHitbox.Radius, 12, FColor::Red, false, 0.05f);
-                }
+            if (ActiveHitbox.bDebugDraw)
+            {
+                DebugImpacts.Add(Hit.ImpactPoint);
             }
         }
+    }
+}
+
+void UMCS_CombatHitboxComponent::DrawSweepDebug()
+{
+    const UMCS_CombatBudgetSubsystem* Governor = UMCS_CombatBudgetSubsystem::Get(this);
+    const bool bDebugDraw = ActiveHitbox.bDebugDraw && !SweepSteps.IsEmpty() && (!Governor || Governor->AllowDebugDraw());
+
+    if (bDebugDraw)
+    {
+        for (const FVector& Impact : DebugImpacts)
+        {
+            DrawDebugSphere(GetWorld(), Impact, ActiveHitbox.Radius, 12, FColor::Red, false, 0.05f);
+        }
 
-        // Draw sweep line
-        if (ActiveHitbox.bDebugDraw)
+        // Draw sweep lines
+        for (const FSweepStep& Step : SweepSteps)
         {
-            DrawDebugLine(GetWorld(), StepStart, StepEnd, FColor::Green, false, 0.05f, 0, 1.5f);
+            DrawDebugLine(GetWorld(), Step.Start, Step.End, FColor::Green, false, 0.05f, 0, 1.5f);
         }
+
+        // Draw socket spheres
+        DrawDebugSphere(GetWorld(), PrevStartLoc, ActiveHitbox.Radius, 8, FColor::Blue, false, 0.05f);
+        DrawDebugSphere(GetWorld(), PrevEndLoc, ActiveHitbox.Radius, 8, FColor::Blue, false, 0.05f);
     }
 
-    // Update previous socket locations for next frame
-    PrevStartLoc = CurrStart;
-    PrevEndLoc = CurrEnd;
+    SweepSteps.Reset();
+    SweepHits.Reset();
+    DebugImpacts.Reset();
+}
+
+FBox UMCS_CombatHitboxComponent::GetFrameBounds() const
+{
+    FBox Bounds(ForceInit);
+
+    for (const FSweepStep& Step : SweepSteps)
+    {
+        Bounds += Step.Start;
+        Bounds += Step.End;
+    }
+    if (Bounds.IsValid)
+    {
+        Bounds = Bounds.ExpandBy(ActiveHitbox.Radius);
+    }
+
+    for (const FActiveArea& Active : ActiveAreas)
+    {
+        const FVector Extent(Active.Area.Radius, Active.Area.Radius, Active.Area.HalfHeight);
+        Bounds += FBox(Active.Center - Extent, Active.Center + Extent);
+    }
+
+    for (const FPendingSightCheck& Check : PendingSightChecks)
+    {
+        Bounds += Check.Hit.TraceEnd;
+    }
+
+    return Bounds;
+}
+
+FBox UMCS_CombatHitboxComponent::ResolveWindowReach(const FMCS_AttackEntry& Attack) const
+{
+    const USkeletalMeshComponent* Mesh = ResolveMesh();
+    const UAnimInstance* AnimInstance = Mesh ? Mesh->GetAnimInstance() : nullptr;
+    UMCS_AttackDatabaseSubsystem* Database = UMCS_AttackDatabaseSubsystem::Get(this);
+
+    if (!AnimInstance || !Database || !Attack.AttackMontage || !AnimInstance->Montage_IsPlaying(Attack.AttackMontage))
+    {
+        return FBox(ForceInit);
+    }
+
+    const TSharedPtr<const FMCS_MontageTimeline> Timeline = Database->GetMontageTimeline(Attack.AttackMontage);
+    return Timeline ? Timeline->FindReach(AnimInstance->Montage_GetPosition(Attack.AttackMontage)) : FBox(ForceInit);
+}
+
+bool UMCS_CombatHitboxComponent::IsAnyoneInReach(const USkeletalMeshComponent& Mesh)
+{
+    UMCS_CombatGridSubsystem* Grid = GetWorld()->GetSubsystem<UMCS_CombatGridSubsystem>();
+    if (!Grid)
+    {
+        return true;
+    }
+
+    Grid->RebuildIfStale();
+
+    const FBox WorldReach = ActiveReach.TransformBy(Mesh.GetComponentTransform());
+
+    ReachCandidates.Reset();
+    Grid->GatherCandidates(WorldReach.ExpandBy(FVector(Grid->GetMaxRadius(), Grid->GetMaxRadius(), Grid->GetMaxHalfHeight())), ReachCandidates);
+
+    const TArray<float>& Radii = Grid->GetRadii();
+    const TArray<float>& HalfHeights = Grid->GetHalfHeights();
+
+    for (const int32 Candidate : ReachCandidates)
+    {
+        AActor* Actor = Grid->GetActor(Candidate);
+        if (!Actor || Actor == GetOwner() || AlreadyHitActors.Contains(Actor))
+            continue;
+
+        // Box vs the bounds of the combatant's collision cylinder
+        const FVector Location = Grid->GetLocation(Candidate);
+        const FVector Extent(Radii[Candidate], Radii[Candidate], HalfHeights[Candidate]);
+        if (WorldReach.Intersect(FBox(Location - Extent, Location + Extent)))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void UMCS_CombatHitboxComponent::RegisterHit(AActor* HitActor, const FHitResult& Hit, const FMCS_AttackEntry& Attack)
+{
+    if (!bPipelineDriven)
+    {
+        DispatchHit(HitActor, Hit, Attack);
+        return;
+    }
+
+    PendingHits.Add({ HitActor, Hit, Attack });
+}
+
+void UMCS_CombatHitboxComponent::DispatchPendingHits()
+{
+    // Handlers may start the next swing (and queue into a fresh list)
+    const TArray<FPendingHit> Hits = MoveTemp(PendingHits);
+
+    for (const FPendingHit& Pending : Hits)
+    {
+        DispatchHit(Pending.Actor.Get(), Pending.Hit, Pending.Attack);
+    }
+}
+
+void UMCS_CombatHitboxComponent::DispatchHit(AActor* HitActor, const FHitResult& Hit, const FMCS_AttackEntry& Attack)
+{
+    if (!IsValid(HitActor) || HitActor == GetOwner())
+        return;
+
+    OnHitboxHit.Broadcast(HitActor, Hit, Attack);
 
-    // Draw socket spheres
-    if (ActiveHitbox.bDebugDraw)
+    // Published on the combat event bus at the end of the frame
+    if (UMCS_CombatWorldSubsystem* Pipeline = UMCS_CombatWorldSubsystem::Get(this))
     {
-        DrawDebugSphere(GetWorld(), CurrStart, ActiveHitbox.Radius, 8, FColor::Blue, false, 0.05f);
-        DrawDebugSphere(GetWorld(), CurrEnd, ActiveHitbox.Radius, 8, FColor::Blue, false, 0.05f);
+        Pipeline->RecordHitLanded(GetOwner(), HitActor, Attack);
     }
 }
@@ -0,0 +1,92 @@
+/*
+ * ========================================================================
+ * Copyright © 2025 God's Studio
+ * All Rights Reserved.
+ *
+ * Free for all to use, copy, and distribute. I hope you learn from this as I learned creating it.
+ * =============================================================================
+ *
+ * Project: Motion Combat System
+ * This is a combat system inspired by Unreal Engine’s Motion Matching plugin.
+ * Author: Christopher D. Parker
+ * Date: 10-18-2026
+ * =============================================================================
+ * MCS_CombatResourceComponent.cpp
+ * Implements the combat resource component (thin view over the resource store).
+ */
+
+#include <Components/MCS_CombatResourceComponent.h>
+#include <SubSystems/MCS_ResourceSubsystem.h>
+#include "Engine/World.h"
+
+// Constructor
+UMCS_CombatResourceComponent::UMCS_CombatResourceComponent()
+{
+    PrimaryComponentTick.bCanEverTick = false;
+}
+
+void UMCS_CombatResourceComponent::BeginPlay()
+{
+    Super::BeginPlay();
+
+    if (UWorld* World = GetWorld())
+    {
+        Store = World->GetSubsystem<UMCS_ResourceSubsystem>();
+    }
+
+    if (Store)
+    {
+        ResourceSlot = Store->AllocateSlot(GetOwner());
+        ApplyConfiguration();
+    }
+}
+
+void UMCS_CombatResourceComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (Store && ResourceSlot != INDEX_NONE)
+    {
+        Store->ReleaseSlot(ResourceSlot);
+    }
+
+    ResourceSlot = INDEX_NONE;
+    Store = nullptr;
+
+    Super::EndPlay(EndPlayReason);
+}
+
+void UMCS_CombatResourceComponent::ApplyConfiguration()
+{
+    if (Store)
+    {
+        Store->ConfigureStamina(ResourceSlot, MaxStamina, StaminaRegenRate, StaminaRegenDelay);
+        Store->ConfigurePoise(ResourceSlot, MaxPoise, PoiseDecayRate, PoiseDecayDelay);
+    }
+}
+
+float UMCS_CombatResourceComponent::GetStamina() const
+{
+    return Store ? Store->GetStamina(ResourceSlot) : MaxStamina;
+}
+
+float UMCS_CombatResourceComponent::GetStaminaPercent() const
+{
+    return MaxStamina > 0.f ? GetStamina() / MaxStamina * 100.f : 0.f;
+}
+
+bool UMCS_CombatResourceComponent::ConsumeStamina(float Cost)
+{
+    return Store ? Store->ConsumeStamina(ResourceSlot, Cost) : true;
+}
+
+void UMCS_CombatResourceComponent::RestoreStamina(float Amount)
+{
+    if (Store)
+    {
+        Store->RestoreStamina(ResourceSlot, Amount);
+    }
+}
+
+float UMCS_CombatResourceComponent::GetPoise() const
+{
+    return Store ? Store->GetPoise(ResourceSlot) : 0.f;
+}
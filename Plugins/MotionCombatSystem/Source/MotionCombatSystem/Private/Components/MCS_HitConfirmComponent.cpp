@@ -0,0 +1,83 @@
+/*
+ * ========================================================================
+ * Copyright © 2025 God's Studio
+ * All Rights Reserved.
+ *
+ * Free for all to use, copy, and distribute. I hope you learn from this as I learned creating it.
+ * =============================================================================
+ *
+ * Project: Motion Combat System
+ * This is a combat system inspired by Unreal Engine’s Motion Matching plugin.
+ * Author: Christopher D. Parker
+ * Date: 10-18-2026
+ * =============================================================================
+ * MCS_HitConfirmComponent.cpp
+ * Registers remote connections for hit confirmation and unpacks the batches on clients.
+ */
+
+#include <Components/MCS_HitConfirmComponent.h>
+#include <Components/MCS_CombatHitReactionComponent.h>
+#include <SubSystems/MCS_HitConfirmSubsystem.h>
+#include "Engine/World.h"
+#include "Engine/HitResult.h"
+#include "GameFramework/PlayerController.h"
+
+// Constructor
+UMCS_HitConfirmComponent::UMCS_HitConfirmComponent()
+{
+    PrimaryComponentTick.bCanEverTick = false;
+    SetIsReplicatedByDefault(true);
+}
+
+void UMCS_HitConfirmComponent::BeginPlay()
+{
+    Super::BeginPlay();
+
+    // Only the server sends, and only to controllers of remote clients (a listen server's host reacts directly)
+    const APlayerController* Controller = Cast<APlayerController>(GetOwner());
+    if (Controller && Controller->HasAuthority() && !Controller->IsLocalController())
+    {
+        if (UMCS_HitConfirmSubsystem* Confirms = UMCS_HitConfirmSubsystem::Get(this))
+        {
+            Confirms->RegisterReceiver(this);
+        }
+    }
+}
+
+void UMCS_HitConfirmComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (UMCS_HitConfirmSubsystem* Confirms = UMCS_HitConfirmSubsystem::Get(this))
+    {
+        Confirms->UnregisterReceiver(this);
+    }
+
+    Super::EndPlay(EndPlayReason);
+}
+
+void UMCS_HitConfirmComponent::ClientReceiveHitConfirms_Implementation(const FMCS_HitConfirmBatch& Batch)
+{
+    FMCS_ConfirmedHit Confirmed;
+
+    for (int32 Index = 0; Index < Batch.Num(); ++Index)
+    {
+        if (!Batch.Unpack(Index, Confirmed))
+        {
+            continue;
+        }
+
+        if (bPlayReactions)
+        {
+            if (UMCS_CombatHitReactionComponent* Reaction = Confirmed.Victim->FindComponentByClass<UMCS_CombatHitReactionComponent>())
+            {
+                FHitResult Hit;
+                Hit.Location = Confirmed.ImpactPoint;
+                Hit.ImpactPoint = Confirmed.ImpactPoint;
+                Hit.BoneName = Confirmed.BoneName;
+
+                Reaction->PlayReaction(Hit, Confirmed.Level, Confirmed.Severity);
+            }
+        }
+
+        OnHitConfirmed.Broadcast(Confirmed);
+    }
+}
@@ -0,0 +1,326 @@
+/*
+ * ========================================================================
+ * Copyright © 2025 God's Studio
+ * All Rights Reserved.
+ *
+ * Free for all to use, copy, and distribute. I hope you learn from this as I learned creating it.
+ * =============================================================================
+ *
+ * Project: Motion Combat System
+ * This is a combat system inspired by Unreal Engine’s Motion Matching plugin.
+ * Author: Christopher D. Parker
+ * Date: 10-18-2026
+ * =============================================================================
+ * MCS_CombatDatabase.cpp
+ * Compiles combat DataTables into the cooked database and loads it back.
+ */
+
+#include <Data/MCS_CombatDatabase.h>
+#include <Stats/MCS_Stats.h>
+#include "Engine/DataTable.h"
+#include "Animation/AnimMontage.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "UObject/ObjectSaveContext.h"
+
+namespace MCS_Database
+{
+    /** Bump whenever the layout of the derived blob (or anything it serializes) changes */
+    constexpr int32 DerivedVersion = 1;
+
+    template <typename RowType>
+    static void CopyRows(const UDataTable& Table, TArray<RowType>& OutRows)
+    {
+        TArray<RowType*> Rows;
+        Table.GetAllRows(TEXT("CompileCombatDatabase"), Rows);
+
+        OutRows.Reset(Rows.Num());
+        for (const RowType* Row : Rows)
+        {
+            if (Row)
+            {
+                OutRows.Add(*Row);
+            }
+        }
+    }
+
+    /**
+     * Hands cooked rows over to a runtime set. Cooked builds move them, so every row is held once; the editor
+     * keeps its copy for the details panel and for resaving.
+     */
+    template <typename RowType>
+    static TArray<RowType> TakeRows(TArray<RowType>& Rows)
+    {
+        if (FPlatformProperties::RequiresCookedData())
+        {
+            return MoveTemp(Rows);
+        }
+        return Rows;
+    }
+}
+
+#if WITH_EDITOR
+void UMCS_CombatDatabase::Rebuild()
+{
+    AttackTables.Reset();
+    DefenseTables.Reset();
+    ReactionTables.Reset();
+    Montages.Reset();
+
+    auto AddMontage = [ this ] (const UAnimMontage* Montage)
+        {
+            if (Montage)
+            {
+                Montages.AddUnique(FSoftObjectPath(Montage));
+            }
+        };
+
+    for (const UDataTable* Table : SourceTables)
+    {
+        const UScriptStruct* RowStruct = Table ? Table->GetRowStruct() : nullptr;
+        if (!RowStruct)
+        {
+            continue;
+        }
+
+        if (RowStruct->IsChildOf(FMCS_AttackEntry::StaticStruct()))
+        {
+            FMCS_CookedAttackTable& Cooked = AttackTables.AddDefaulted_GetRef();
+            Cooked.Source = FSoftObjectPath(Table);
+            MCS_Database::CopyRows(*Table, Cooked.Rows);
+
+            for (const FMCS_AttackEntry& Row : Cooked.Rows)
+            {
+                AddMontage(Row.AttackMontage);
+            }
+        }
+        else if (RowStruct->IsChildOf(FMCS_DefenseEntry::StaticStruct()))
+        {
+            FMCS_CookedDefenseTable& Cooked = DefenseTables.AddDefaulted_GetRef();
+            Cooked.Source = FSoftObjectPath(Table);
+            MCS_Database::CopyRows(*Table, Cooked.Rows);
+
+            for (const FMCS_DefenseEntry& Row : Cooked.Rows)
+            {
+                AddMontage(Row.DefenseMontage);
+            }
+        }
+        else if (RowStruct->IsChildOf(FMCS_HitReaction::StaticStruct()))
+        {
+            FMCS_CookedReactionTable& Cooked = ReactionTables.AddDefaulted_GetRef();
+            Cooked.Source = FSoftObjectPath(Table);
+            MCS_Database::CopyRows(*Table, Cooked.Rows);
+        }
+        else
+        {
+            UE_LOG(LogTemp, Warning, TEXT("[CombatDatabase] %s: %s has unsupported rows (%s); skipped."),
+                *GetName(), *Table->GetName(), *RowStruct->GetName());
+        }
+    }
+
+    BuildFromRows();
+
+    UE_LOG(LogTemp, Log, TEXT("[CombatDatabase] Rebuilt %s: %d attack, %d defense, %d reaction tables, %d montage timelines."),
+        *GetName(), AttackTables.Num(), DefenseTables.Num(), ReactionTables.Num(), Montages.Num());
+}
+
+void UMCS_CombatDatabase::PreSave(FObjectPreSaveContext SaveContext)
+{
+    Super::PreSave(SaveContext);
+
+    // Every save (and cook) writes data compiled from the current tables
+    Rebuild();
+}
+#endif
+
+void UMCS_CombatDatabase::Serialize(FArchive& Ar)
+{
+    Super::Serialize(Ar);
+
+    // Only real saves and loads carry the derived blob (not reference collection, undo or memory counting)
+    if (!Ar.IsPersistent() || Ar.IsObjectReferenceCollector() || Ar.IsCountingMemory())
+    {
+        return;
+    }
+
+    LLM_SCOPE_BYTAG(MotionCombat_Databases);
+
+    TArray<uint8> Derived;
+
+    if (Ar.IsSaving())
+    {
+        if (AttackSets.Num() != AttackTables.Num() || DefenseSets.Num() != DefenseTables.Num() || MontageTimelines.Num() != Montages.Num())
+        {
+            BuildFromRows();
+        }
+
+        FMemoryWriter Writer(Derived, true);
+        SerializeDerived(Writer);
+    }
+
+    // One contiguous block: a single read on load
+    Derived.BulkSerialize(Ar);
+
+    if (Ar.IsLoading())
+    {
+        FMemoryReader Reader(Derived, true);
+        if (!SerializeDerived(Reader))
+        {
+            UE_LOG(LogTemp, Warning, TEXT("[CombatDatabase] %s: derived data is missing or out of date, compiling from the cooked rows. Resave the asset."),
+                *GetName());
+            BuildFromRows();
+        }
+        else
+        {
+            AdoptCookedRows();
+        }
+    }
+}
+
+bool UMCS_CombatDatabase::SerializeDerived(FArchive& Ar)
+{
+    int32 Version = MCS_Database::DerivedVersion;
+    int32 NumAttackSets = AttackSets.Num();
+    int32 NumDefenseSets = DefenseSets.Num();
+    int32 NumTimelines = MontageTimelines.Num();
+
+    Ar << Version << NumAttackSets << NumDefenseSets << NumTimelines;
+
+    if (Ar.IsLoading())
+    {
+        if (Ar.IsError() || Version != MCS_Database::DerivedVersion || NumAttackSets != AttackTables.Num()
+            || NumDefenseSets != DefenseTables.Num() || NumTimelines != Montages.Num())
+        {
+            return false;
+        }
+
+        AttackSets.Reset(NumAttackSets);
+        for (const FMCS_CookedAttackTable& Cooked : AttackTables)
+        {
+            TSharedPtr<FMCS_CompiledAttackSet>& Set = AttackSets.Add_GetRef(MakeShared<FMCS_CompiledAttackSet>());
+            Set->SetId = FName(*Cooked.Source.ToString());
+        }
+
+        // Entries are handed over by AdoptCookedRows once the blob proved valid (BuildFromRows needs the rows otherwise)
+        DefenseSets.Reset(NumDefenseSets);
+        for (int32 Index = 0; Index < NumDefenseSets; ++Index)
+        {
+            DefenseSets.Add(MakeShared<FMCS_CompiledDefenseSet>());
+        }
+
+        MontageTimelines.Reset(NumTimelines);
+        MontageTimelines.SetNum(NumTimelines);
+    }
+
+    for (const TSharedPtr<FMCS_CompiledAttackSet>& Set : AttackSets)
+    {
+        Set->SerializeDerived(Ar);
+    }
+
+    for (const TSharedPtr<FMCS_CompiledDefenseSet>& Set : DefenseSets)
+    {
+        Set->SerializeDerived(Ar);
+    }
+
+    // Montages that could not be resolved when the database was built have no timeline
+    for (TSharedPtr<FMCS_MontageTimeline>& Timeline : MontageTimelines)
+    {
+        bool bHasTimeline = Timeline.IsValid();
+        Ar << bHasTimeline;
+
+        if (Ar.IsLoading() && bHasTimeline)
+        {
+            Timeline = MakeShared<FMCS_MontageTimeline>();
+        }
+
+        if (bHasTimeline)
+        {
+            Timeline->Serialize(Ar);
+        }
+    }
+
+    return !Ar.IsError();
+}
+
+void UMCS_CombatDatabase::AdoptCookedRows()
+{
+    LLM_SCOPE_BYTAG(MotionCombat_Databases);
+
+    for (int32 Index = 0; Index < AttackTables.Num(); ++Index)
+    {
+        AttackSets[Index]->Entries = MCS_Database::TakeRows(AttackTables[Index].Rows);
+    }
+
+    for (int32 Index = 0; Index < DefenseTables.Num(); ++Index)
+    {
+        DefenseSets[Index]->Entries = MCS_Database::TakeRows(DefenseTables[Index].Rows);
+    }
+
+    ReactionSets.Reset(ReactionTables.Num());
+    for (FMCS_CookedReactionTable& Cooked : ReactionTables)
+    {
+        ReactionSets.Add(MakeShared<TArray<FMCS_HitReaction>>(MCS_Database::TakeRows(Cooked.Rows)));
+    }
+}
+
+void UMCS_CombatDatabase::BuildFromRows()
+{
+    LLM_SCOPE_BYTAG(MotionCombat_Databases);
+
+    AttackSets.Reset(AttackTables.Num());
+    for (FMCS_CookedAttackTable& Cooked : AttackTables)
+    {
+        TSharedPtr<FMCS_CompiledAttackSet>& Set = AttackSets.Add_GetRef(MakeShared<FMCS_CompiledAttackSet>());
+        Set->Build(MCS_Database::TakeRows(Cooked.Rows));
+        Set->SetId = FName(*Cooked.Source.ToString());
+    }
+
+    DefenseSets.Reset(DefenseTables.Num());
+    for (FMCS_CookedDefenseTable& Cooked : DefenseTables)
+    {
+        TSharedPtr<FMCS_CompiledDefenseSet>& Set = DefenseSets.Add_GetRef(MakeShared<FMCS_CompiledDefenseSet>());
+        Set->Build(MCS_Database::TakeRows(Cooked.Rows));
+    }
+
+    ReactionSets.Reset(ReactionTables.Num());
+    for (FMCS_CookedReactionTable& Cooked : ReactionTables)
+    {
+        ReactionSets.Add(MakeShared<TArray<FMCS_HitReaction>>(MCS_Database::TakeRows(Cooked.Rows)));
+    }
+
+    // Only montages already in memory; the subsystem extracts the others on first use
+    MontageTimelines.Reset(Montages.Num());
+    for (const FSoftObjectPath& Path : Montages)
+    {
+        TSharedPtr<FMCS_MontageTimeline>& Timeline = MontageTimelines.AddDefaulted_GetRef();
+        if (const UAnimMontage* Montage = Cast<UAnimMontage>(Path.ResolveObject()))
+        {
+            Timeline = MakeShared<FMCS_MontageTimeline>();
+            Timeline->Build(*Montage);
+        }
+    }
+}
+
+TSharedPtr<const FMCS_CompiledAttackSet> UMCS_CombatDatabase::FindAttackSet(const FSoftObjectPath& Table) const
+{
+    const int32 Index = AttackTables.IndexOfByPredicate([ &Table ] (const FMCS_CookedAttackTable& Cooked) { return Cooked.Source == Table; });
+    return AttackSets.IsValidIndex(Index) ? AttackSets[Index] : nullptr;
+}
+
+TSharedPtr<const FMCS_CompiledDefenseSet> UMCS_CombatDatabase::FindDefenseSet(const FSoftObjectPath& Table) const
+{
+    const int32 Index = DefenseTables.IndexOfByPredicate([ &Table ] (const FMCS_CookedDefenseTable& Cooked) { return Cooked.Source == Table; });
+    return DefenseSets.IsValidIndex(Index) ? DefenseSets[Index] : nullptr;
+}
+
+TSharedPtr<const TArray<FMCS_HitReaction>> UMCS_CombatDatabase::FindReactions(const FSoftObjectPath& Table) const
+{
+    const int32 Index = ReactionTables.IndexOfByPredicate([ &Table ] (const FMCS_CookedReactionTable& Cooked) { return Cooked.Source == Table; });
+    return ReactionSets.IsValidIndex(Index) ? ReactionSets[Index] : nullptr;
+}
+
+TSharedPtr<const FMCS_MontageTimeline> UMCS_CombatDatabase::FindMontageTimeline(const FSoftObjectPath& Montage) const
+{
+    const int32 Index = Montages.IndexOfByKey(Montage);
+    return MontageTimelines.IsValidIndex(Index) ? MontageTimelines[Index] : nullptr;
+}
@@ -16,6 +16,7 @@
  */
 
 #include "Events/MCS_CombatEventBus.h"
+#include <Stats/MCS_Stats.h>
 #include "Engine/World.h"
 
 TMap<TWeakObjectPtr<UWorld>, TObjectPtr<UMCS_CombatEventBus>> UMCS_CombatEventBus::BusInstances;
@@ -35,6 +36,7 @@ UMCS_CombatEventBus* UMCS_CombatEventBus::Get(UWorld* World)
     }
 
     // Create new instance
+    LLM_SCOPE_BYTAG(MotionCombat_Events);
     UMCS_CombatEventBus* NewBus = NewObject<UMCS_CombatEventBus>(World, UMCS_CombatEventBus::StaticClass());
     BusInstances.Add(World, NewBus);
 
@@ -1,6 +1,17 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "MotionCombatSystem.h"
+#include <Stats/MCS_Stats.h>
+
+CSV_DEFINE_CATEGORY_MODULE(MOTIONCOMBATSYSTEM_API, MotionCombat, true);
+
+LLM_DEFINE_TAG(MotionCombat);
+LLM_DEFINE_TAG(MotionCombat_Databases);
+LLM_DEFINE_TAG(MotionCombat_Choosers);
+LLM_DEFINE_TAG(MotionCombat_HitBuffers);
+LLM_DEFINE_TAG(MotionCombat_Targeting);
+LLM_DEFINE_TAG(MotionCombat_Events);
+LLM_DEFINE_TAG(MotionCombat_Traces);
 
 #define LOCTEXT_NAMESPACE "FMotionCombatSystemModule"
 
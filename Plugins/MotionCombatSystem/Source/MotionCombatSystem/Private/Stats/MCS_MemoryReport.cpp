@@ -0,0 +1,361 @@
+/*
+ * ========================================================================
+ * Copyright © 2025 God's Studio
+ * All Rights Reserved.
+ *
+ * Free for all to use, copy, and distribute. I hope you learn from this as I learned creating it.
+ * =============================================================================
+ *
+ * Project: Motion Combat System
+ * This is a combat system inspired by Unreal Engine’s Motion Matching plugin.
+ * Author: Christopher D. Parker
+ * Date: 10-18-2026
+ * =============================================================================
+ * MCS_MemoryReport.cpp
+ * Implementation of the MCS memory report and the mcs.memreport console command.
+ */
+
+#include <Stats/MCS_MemoryReport.h>
+#include <Components/MCS_CombatCoreComponent.h>
+#include <Components/MCS_CombatDefenseComponent.h>
+#include <Components/MCS_CombatHitboxComponent.h>
+#include <Components/MCS_CombatHitReactionComponent.h>
+#include <Components/MCS_CombatCommandComponent.h>
+#include <Components/MCS_CombatResourceComponent.h>
+#include <Choosers/MCS_AttackChooser.h>
+#include <Choosers/MCS_DefenseChooser.h>
+#include <Events/MCS_CombatEventBus.h>
+#include <SubSystems/MCS_AttackDatabaseSubsystem.h>
+#include <SubSystems/MCS_CombatGridSubsystem.h>
+#include <SubSystems/MCS_ProjectileSubsystem.h>
+#include <SubSystems/MCS_LatencySubsystem.h>
+#include <SubSystems/MCS_TargetingSubsystem.h>
+#include <Structs/MCS_HitReaction.h>
+#include "Engine/DataTable.h"
+#include "Engine/World.h"
+#include "Animation/AnimMontage.h"
+#include "Animation/AnimSequenceBase.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/OutputDevice.h"
+#include "Misc/Parse.h"
+#include "UObject/UObjectIterator.h"
+
+namespace MCS_MemReport
+{
+    static double ToKB(SIZE_T Bytes)
+    {
+        return static_cast<double>(Bytes) / 1024.0;
+    }
+
+    /** Object size as the engine reports it, plus the object itself (UObject's own report is empty) */
+    static SIZE_T ObjectSize(UObject* Object)
+    {
+        return Object ? Object->GetClass()->GetStructureSize() + Object->GetResourceSizeBytes(EResourceSizeMode::Exclusive) : 0;
+    }
+
+    /** One row of a table section */
+    struct FRow
+    {
+        FString Name;
+        int32 Count = 0;
+        SIZE_T Bytes = 0;
+    };
+
+    static void WriteSection(FOutputDevice& Ar, const TCHAR* Title, const TCHAR* CountLabel, TArray<FRow>& Rows)
+    {
+        Rows.Sort([](const FRow& A, const FRow& B) { return A.Bytes > B.Bytes; });
+
+        SIZE_T Total = 0;
+        Ar.Logf(TEXT("--- %s ---"), Title);
+        for (const FRow& Row : Rows)
+        {
+            Ar.Logf(TEXT("  %10.1f KB  %6d %-10s %s"), ToKB(Row.Bytes), Row.Count, CountLabel, *Row.Name);
+            Total += Row.Bytes;
+        }
+        Ar.Logf(TEXT("  %10.1f KB  total"), ToKB(Total));
+    }
+
+    /** Montage plus the sequences it plays (each sequence counted once across the report) */
+    static SIZE_T MontageResidentSize(UAnimMontage* Montage, TSet<const UAnimSequenceBase*>& CountedSequences)
+    {
+        SIZE_T Size = ObjectSize(Montage);
+
+        for (const FSlotAnimationTrack& Slot : Montage->SlotAnimTracks)
+        {
+            for (const FAnimSegment& Segment : Slot.AnimTrack.AnimSegments)
+            {
+                UAnimSequenceBase* Sequence = Segment.GetAnimReference();
+                if (!Sequence || CountedSequences.Contains(Sequence))
+                {
+                    continue;
+                }
+
+                CountedSequences.Add(Sequence);
+                Size += ObjectSize(Sequence);
+            }
+        }
+
+        return Size;
+    }
+
+    /** Sums every live object of a class in World */
+    template <typename TObjectClass>
+    static FRow GatherObjects(const UWorld* World)
+    {
+        FRow Row;
+        Row.Name = TObjectClass::StaticClass()->GetName();
+
+        for (TObjectIterator<TObjectClass> It; It; ++It)
+        {
+            if (It->GetWorld() == World)
+            {
+                ++Row.Count;
+                Row.Bytes += ObjectSize(*It);
+            }
+        }
+
+        return Row;
+    }
+
+    static void WriteReport(const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar)
+    {
+        const FString Params = FString::Join(Args, TEXT(" "));
+
+        int32 BudgetKB = 0;
+        int32 AssetBudgetKB = 0;
+        FParse::Value(*Params, TEXT("Budget="), BudgetKB);
+        FParse::Value(*Params, TEXT("AssetBudget="), AssetBudgetKB);
+
+        const FMCS_MemoryTotals Totals = FMCS_MemoryReport::Write(World, Ar);
+
+        if (BudgetKB > 0 && ToKB(Totals.OwnedBytes) > BudgetKB)
+        {
+            UE_LOG(LogTemp, Error, TEXT("[MCS_MemReport] Owned memory %.1f KB exceeds budget %d KB."), ToKB(Totals.OwnedBytes), BudgetKB);
+        }
+        if (AssetBudgetKB > 0 && ToKB(Totals.AssetBytes) > AssetBudgetKB)
+        {
+            UE_LOG(LogTemp, Error, TEXT("[MCS_MemReport] Asset memory %.1f KB exceeds budget %d KB."), ToKB(Totals.AssetBytes), AssetBudgetKB);
+        }
+    }
+
+    static FAutoConsoleCommandWithWorldArgsAndOutputDevice MemReportCommand(
+        TEXT("mcs.memreport"),
+        TEXT("Prints Motion Combat System memory per attack set, DataTable, component type and subsystem, plus resident montages. ")
+        TEXT("Optional Budget=<KB> / AssetBudget=<KB> log an error when exceeded."),
+        FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateStatic(&WriteReport));
+}
+
+FMCS_MemoryTotals FMCS_MemoryReport::Write(UWorld* World, FOutputDevice& Ar)
+{
+    using namespace MCS_MemReport;
+
+    FMCS_MemoryTotals Totals;
+    if (!World)
+    {
+        return Totals;
+    }
+
+    UMCS_AttackDatabaseSubsystem* Database = UMCS_AttackDatabaseSubsystem::Get(World);
+
+    Ar.Logf(TEXT("===== Motion Combat System memory report (%s) ====="), *World->GetName());
+
+    //----------------------------------------
+    // Attack and defense sets (compiled rows are shared, so each table is counted once)
+    //----------------------------------------
+    TMap<FString, FRow> SetRows;
+    TSet<UDataTable*> AttackTables;
+    TSet<UDataTable*> DefenseTables;
+
+    for (TObjectIterator<UMCS_CombatCoreComponent> It; It; ++It)
+    {
+        if (It->GetWorld() != World)
+        {
+            continue;
+        }
+
+        for (const TPair<FGameplayTag, FMCS_AttackSetData>& Set : It->AttackSets)
+        {
+            // Cooked tables are never loaded; their rows are counted with the set
+            UDataTable* Table = Set.Value.AttackDataTable.Get();
+            const FString Name = FString::Printf(TEXT("Attack  %s (%s)"), *Set.Key.ToString(), *Set.Value.AttackDataTable.GetAssetName());
+
+            FRow& Row = SetRows.FindOrAdd(Name);
+            Row.Name = Name;
+            Row.Bytes = Database ? Database->GetCompiledSetSize(Set.Value.AttackDataTable) : 0;
+            ++Row.Count;
+
+            if (Table)
+            {
+                AttackTables.Add(Table);
+            }
+        }
+    }
+
+    for (TObjectIterator<UMCS_CombatDefenseComponent> It; It; ++It)
+    {
+        if (It->GetWorld() != World)
+        {
+            continue;
+        }
+
+        for (const TPair<FGameplayTag, FMCS_DefenseSetData>& Set : It->DefenseSets)
+        {
+            UDataTable* Table = Set.Value.DefenseDataTable.Get();
+            const FString Name = FString::Printf(TEXT("Defense %s (%s)"), *Set.Key.ToString(), *Set.Value.DefenseDataTable.GetAssetName());
+
+            FRow& Row = SetRows.FindOrAdd(Name);
+            Row.Name = Name;
+            Row.Bytes = Database ? Database->GetCompiledDefenseSetSize(Set.Value.DefenseDataTable) : 0;
+            ++Row.Count;
+
+            if (Table)
+            {
+                DefenseTables.Add(Table);
+            }
+        }
+    }
+
+    TArray<FRow> Rows;
+    SetRows.GenerateValueArray(Rows);
+    WriteSection(Ar, TEXT("Compiled sets (per attack/defense set)"), TEXT("users"), Rows);
+
+    //----------------------------------------
+    // Components and choosers
+    //----------------------------------------
+    Rows.Reset();
+    Rows.Add(GatherObjects<UMCS_CombatCoreComponent>(World));
+    Rows.Add(GatherObjects<UMCS_CombatDefenseComponent>(World));
+    Rows.Add(GatherObjects<UMCS_CombatHitboxComponent>(World));
+    Rows.Add(GatherObjects<UMCS_CombatHitReactionComponent>(World));
+    Rows.Add(GatherObjects<UMCS_CombatCommandComponent>(World));
+    Rows.Add(GatherObjects<UMCS_CombatResourceComponent>(World));
+    Rows.Add(GatherObjects<UMCS_AttackChooser>(World));
+    Rows.Add(GatherObjects<UMCS_DefenseChooser>(World));
+
+    for (const FRow& Row : Rows)
+    {
+        Totals.OwnedBytes += Row.Bytes;
+    }
+    WriteSection(Ar, TEXT("Components and choosers (per type)"), TEXT("objects"), Rows);
+
+    //----------------------------------------
+    // Subsystems
+    //----------------------------------------
+    Rows.Reset();
+    if (Database)
+    {
+        Rows.Add({ TEXT("Attack database (compiled sets, montage timelines)"), Database->NumMontageTimelines(), Database->GetAllocatedSize() });
+    }
+    if (const UMCS_CombatGridSubsystem* Grid = World->GetSubsystem<UMCS_CombatGridSubsystem>())
+    {
+        Rows.Add({ TEXT("Combat grid"), 1, Grid->GetAllocatedSize() });
+    }
+    if (const UMCS_ProjectileSubsystem* Projectiles = World->GetSubsystem<UMCS_ProjectileSubsystem>())
+    {
+        Rows.Add({ TEXT("Projectiles"), Projectiles->GetNumProjectiles(), Projectiles->GetAllocatedSize() });
+    }
+    if (const UMCS_TargetingSubsystem* Targeting = World->GetSubsystem<UMCS_TargetingSubsystem>())
+    {
+        Rows.Add({ TEXT("Target registry"), Targeting->GetAllTargets().Num(), Targeting->GetAllTargets().GetAllocatedSize() });
+    }
+    if (const UMCS_LatencySubsystem* Latency = UMCS_LatencySubsystem::Get(World))
+    {
+        Rows.Add({ TEXT("Latency traces"), 1, Latency->GetAllocatedSize() });
+    }
+    Rows.Add(GatherObjects<UMCS_CombatEventBus>(World));
+
+    for (const FRow& Row : Rows)
+    {
+        Totals.OwnedBytes += Row.Bytes;
+    }
+    WriteSection(Ar, TEXT("Subsystems"), TEXT("items"), Rows);
+
+    //----------------------------------------
+    // DataTables and the montages they keep resident
+    //----------------------------------------
+    TSet<UDataTable*> ReactionTables;
+    TSet<UAnimMontage*> Montages;
+
+    for (TObjectIterator<UMCS_CombatHitReactionComponent> It; It; ++It)
+    {
+        if (It->GetWorld() != World)
+        {
+            continue;
+        }
+
+        if (UDataTable* Table = It->HitReactionDataTable.Get())
+        {
+            ReactionTables.Add(Table);
+        }
+        for (const TPair<EMCS_Direction, TObjectPtr<UAnimMontage>>& Flinch : It->FlinchMontages)
+        {
+            if (Flinch.Value)
+            {
+                Montages.Add(Flinch.Value);
+            }
+        }
+    }
+
+    static const FString Context(TEXT("MCS_MemReport"));
+    Rows.Reset();
+
+    for (UDataTable* Table : AttackTables)
+    {
+        Rows.Add({ Table->GetName(), Table->GetRowMap().Num(), ObjectSize(Table) });
+        Table->ForeachRow<FMCS_AttackEntry>(Context, [&Montages](const FName&, const FMCS_AttackEntry& Entry)
+        {
+            if (Entry.AttackMontage)
+            {
+                Montages.Add(Entry.AttackMontage);
+            }
+        });
+    }
+    for (UDataTable* Table : DefenseTables)
+    {
+        Rows.Add({ Table->GetName(), Table->GetRowMap().Num(), ObjectSize(Table) });
+        Table->ForeachRow<FMCS_DefenseEntry>(Context, [&Montages](const FName&, const FMCS_DefenseEntry& Entry)
+        {
+            if (Entry.DefenseMontage)
+            {
+                Montages.Add(Entry.DefenseMontage);
+            }
+        });
+    }
+    for (UDataTable* Table : ReactionTables)
+    {
+        Rows.Add({ Table->GetName(), Table->GetRowMap().Num(), ObjectSize(Table) });
+        Table->ForeachRow<FMCS_HitReaction>(Context, [&Montages](const FName&, const FMCS_HitReaction& Reaction)
+        {
+            if (Reaction.Montage)
+            {
+                Montages.Add(Reaction.Montage);
+            }
+            if (Reaction.GetUpMontage)
+            {
+                Montages.Add(Reaction.GetUpMontage);
+            }
+        });
+    }
+
+    for (const FRow& Row : Rows)
+    {
+        Totals.AssetBytes += Row.Bytes;
+    }
+    WriteSection(Ar, TEXT("DataTables"), TEXT("rows"), Rows);
+
+    Rows.Reset();
+    TSet<const UAnimSequenceBase*> CountedSequences;
+    for (UAnimMontage* Montage : Montages)
+    {
+        Rows.Add({ Montage->GetName(), Montage->SlotAnimTracks.Num(), MontageResidentSize(Montage, CountedSequences) });
+    }
+
+    for (const FRow& Row : Rows)
+    {
+        Totals.AssetBytes += Row.Bytes;
+    }
+    WriteSection(Ar, TEXT("Resident montages (with their sequences)"), TEXT("slots"), Rows);
+
+    Ar.Logf(TEXT("===== MCS owned: %.1f KB, referenced assets: %.1f KB ====="), ToKB(Totals.OwnedBytes), ToKB(Totals.AssetBytes));
+    return Totals;
+}
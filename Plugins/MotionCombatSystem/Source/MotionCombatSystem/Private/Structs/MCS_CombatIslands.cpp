@@ -0,0 +1,89 @@
+/*
+ * ========================================================================
+ * Copyright © 2025 God's Studio
+ * All Rights Reserved.
+ *
+ * Free for all to use, copy, and distribute. I hope you learn from this as I learned creating it.
+ * =============================================================================
+ *
+ * Project: Motion Combat System
+ * This is a combat system inspired by Unreal Engine’s Motion Matching plugin.
+ * Author: Christopher D. Parker
+ * Date: 10-18-2026
+ * =============================================================================
+ * MCS_CombatIslands.cpp
+ * Union-find and island grouping for the combat world pipeline.
+ */
+
+#include <Structs/MCS_CombatIslands.h>
+
+void FMCS_CombatIslands::Reset(int32 NumNodes)
+{
+    Parent.SetNumUninitialized(NumNodes);
+    for (int32 Node = 0; Node < NumNodes; ++Node)
+    {
+        Parent[Node] = Node;
+    }
+
+    IslandOf.Reset();
+    Starts.Reset();
+    Members.Reset();
+}
+
+int32 FMCS_CombatIslands::FindRoot(int32 Node)
+{
+    while (Parent[Node] != Node)
+    {
+        Parent[Node] = Parent[Parent[Node]];
+        Node = Parent[Node];
+    }
+    return Node;
+}
+
+void FMCS_CombatIslands::Link(int32 A, int32 B)
+{
+    const int32 RootA = FindRoot(A);
+    const int32 RootB = FindRoot(B);
+
+    // The lower root wins, so every root is the lowest node of its set
+    if (RootA < RootB)
+    {
+        Parent[RootB] = RootA;
+    }
+    else if (RootB < RootA)
+    {
+        Parent[RootA] = RootB;
+    }
+}
+
+void FMCS_CombatIslands::Finalize()
+{
+    const int32 NumNodes = Parent.Num();
+
+    // Roots are the lowest node of their set, so visiting nodes in order numbers islands by lowest node
+    IslandOf.SetNumUninitialized(NumNodes);
+    int32 NumIslands = 0;
+    for (int32 Node = 0; Node < NumNodes; ++Node)
+    {
+        const int32 Root = FindRoot(Node);
+        IslandOf[Node] = Root == Node ? NumIslands++ : IslandOf[Root];
+    }
+
+    // Two passes (count, then fill) so each island is one contiguous, ascending run
+    Starts.Init(0, NumIslands + 1);
+    for (int32 Node = 0; Node < NumNodes; ++Node)
+    {
+        ++Starts[IslandOf[Node] + 1];
+    }
+    for (int32 i = 0; i < NumIslands; ++i)
+    {
+        Starts[i + 1] += Starts[i];
+    }
+
+    Members.SetNumUninitialized(NumNodes);
+    TArray<int32> Fill(Starts.GetData(), NumIslands);
+    for (int32 Node = 0; Node < NumNodes; ++Node)
+    {
+        Members[Fill[IslandOf[Node]]++] = Node;
+    }
+}
@@ -0,0 +1,142 @@
+/*
+ * ========================================================================
+ * Copyright © 2025 God's Studio
+ * All Rights Reserved.
+ *
+ * Free for all to use, copy, and distribute. I hope you learn from this as I learned creating it.
+ * =============================================================================
+ *
+ * Project: Motion Combat System
+ * This is a combat system inspired by Unreal Engine’s Motion Matching plugin.
+ * Author: Christopher D. Parker
+ * Date: 10-18-2026
+ * =============================================================================
+ * MCS_CommandAutomaton.cpp
+ * Builds the Aho-Corasick automaton used for command input recognition.
+ */
+
+#include <Structs/MCS_CommandAutomaton.h>
+
+void FMCS_CommandAutomaton::Build(const TArray<FMCS_CommandDefinition>& Commands)
+{
+    //----------------------------------------
+    // 1. Build the trie (goto function). -1 marks a missing edge.
+    //----------------------------------------
+    TArray<int32> Goto;
+    TArray<TArray<int32>> Outputs;
+
+    Goto.Init(-1, NumSymbols);
+    Outputs.AddDefaulted();
+
+    for (int32 CommandIndex = 0; CommandIndex < Commands.Num(); ++CommandIndex)
+    {
+        const TArray<EMCS_CommandInput>& Sequence = Commands[CommandIndex].Sequence;
+        if (Sequence.IsEmpty())
+        {
+            continue;
+        }
+
+        int32 State = 0;
+        for (const EMCS_CommandInput Input : Sequence)
+        {
+            const int32 Symbol = static_cast<int32>(Input);
+            if (Symbol >= NumSymbols)
+            {
+                State = INDEX_NONE;
+                break;
+            }
+
+            const int32 Edge = State * NumSymbols + Symbol;
+            if (Goto[Edge] == -1)
+            {
+                // Grow first; Goto may reallocate
+                const int32 NewState = Outputs.Num();
+                Goto.AddUninitialized(NumSymbols);
+                for (int32 i = 0; i < NumSymbols; ++i)
+                {
+                    Goto[NewState * NumSymbols + i] = -1;
+                }
+                Goto[Edge] = NewState;
+                Outputs.AddDefaulted();
+            }
+            State = Goto[Edge];
+        }
+
+        if (State != INDEX_NONE)
+        {
+            Outputs[State].Add(CommandIndex);
+        }
+    }
+
+    //----------------------------------------
+    // 2. BFS to compute failure links and fold them into a full DFA
+    //----------------------------------------
+    const int32 StateCount = Outputs.Num();
+
+    // Trie nodes with a child are partway through a command; folding below would hide which edges are real
+    PendingStates.Init(false, StateCount);
+    for (int32 Edge = 0; Edge < Goto.Num(); ++Edge)
+    {
+        if (Goto[Edge] != -1)
+        {
+            PendingStates[Edge / NumSymbols] = true;
+        }
+    }
+
+    TArray<int32> Fail;
+    Fail.Init(0, StateCount);
+
+    Transitions = MoveTemp(Goto);
+
+    TArray<int32> Queue;
+    Queue.Reserve(StateCount);
+
+    for (int32 Symbol = 0; Symbol < NumSymbols; ++Symbol)
+    {
+        int32& Next = Transitions[Symbol];
+        if (Next == -1)
+        {
+            Next = 0;
+        }
+        else
+        {
+            Fail[Next] = 0;
+            Queue.Add(Next);
+        }
+    }
+
+    for (int32 QueueIndex = 0; QueueIndex < Queue.Num(); ++QueueIndex)
+    {
+        const int32 State = Queue[QueueIndex];
+
+        // Inherit matches of the longest proper suffix that is also a prefix
+        Outputs[State].Append(Outputs[Fail[State]]);
+
+        for (int32 Symbol = 0; Symbol < NumSymbols; ++Symbol)
+        {
+            int32& Next = Transitions[State * NumSymbols + Symbol];
+            if (Next == -1)
+            {
+                Next = Transitions[Fail[State] * NumSymbols + Symbol];
+            }
+            else
+            {
+                Fail[Next] = Transitions[Fail[State] * NumSymbols + Symbol];
+                Queue.Add(Next);
+            }
+        }
+    }
+
+    //----------------------------------------
+    // 3. Flatten outputs
+    //----------------------------------------
+    MatchOffsets.Reset(StateCount + 1);
+    MatchList.Reset();
+
+    for (const TArray<int32>& StateOutputs : Outputs)
+    {
+        MatchOffsets.Add(MatchList.Num());
+        MatchList.Append(StateOutputs);
+    }
+    MatchOffsets.Add(MatchList.Num());
+}
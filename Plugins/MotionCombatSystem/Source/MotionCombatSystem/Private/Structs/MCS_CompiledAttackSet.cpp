@@ -0,0 +1,325 @@
+/*
+ * ========================================================================
+ * Copyright © 2025 God's Studio
+ * All Rights Reserved.
+ *
+ * Free for all to use, copy, and distribute. I hope you learn from this as I learned creating it.
+ * =============================================================================
+ *
+ * Project: Motion Combat System
+ * This is a combat system inspired by Unreal Engine’s Motion Matching plugin.
+ * Author: Christopher D. Parker
+ * Date: 10-18-2026
+ * =============================================================================
+ * MCS_CompiledAttackSet.cpp
+ * Builds compiled attack sets and updates per-combatant attack memory.
+ */
+
+#include <Structs/MCS_CompiledAttackSet.h>
+#include "Engine/DataTable.h"
+#include "Algo/BinarySearch.h"
+
+namespace MCS_AttackMemory
+{
+    /** Last-used time of entries that were never used; far enough back that any recency window has elapsed */
+    constexpr float NeverUsed = -1.e9f;
+}
+
+void FMCS_CompiledAttackSet::Build(const UDataTable& Table)
+{
+    TArray<FMCS_AttackEntry*> Rows;
+    Table.GetAllRows(TEXT("CompileAttackSet"), Rows);
+
+    TArray<FMCS_AttackEntry> Copied;
+    Copied.Reserve(Rows.Num());
+    for (const FMCS_AttackEntry* Row : Rows)
+    {
+        if (Row)
+        {
+            Copied.Add(*Row);
+        }
+    }
+
+    Build(MoveTemp(Copied));
+    SetId = FName(*Table.GetPathName());
+}
+
+void FMCS_CompiledAttackSet::Build(TConstArrayView<FMCS_AttackEntry> InEntries)
+{
+    Build(TArray<FMCS_AttackEntry>(InEntries));
+}
+
+void FMCS_CompiledAttackSet::Build(TArray<FMCS_AttackEntry>&& InEntries)
+{
+    Entries = MoveTemp(InEntries);
+
+    NameToIndex.Reset();
+    for (int32 Index = 0; Index < Entries.Num(); ++Index)
+    {
+        NameToIndex.FindOrAdd(Entries[Index].AttackName, Index);
+    }
+
+    BuildPartitions();
+}
+
+uint32 FMCS_CompiledAttackSet::ComputeScoringHash() const
+{
+    uint32 Hash = GetTypeHash(Entries.Num());
+    for (const FMCS_AttackEntry& Entry : Entries)
+    {
+        Hash = HashCombineFast(Hash, GetTypeHash(Entry.SelectionWeight));
+        Hash = HashCombineFast(Hash, GetTypeHash(Entry.RangeStart));
+        Hash = HashCombineFast(Hash, GetTypeHash(Entry.RangeEnd));
+        Hash = HashCombineFast(Hash, GetTypeHash(static_cast<uint8>(Entry.AttackDirection)));
+        Hash = HashCombineFast(Hash, GetTypeHash(static_cast<uint8>(Entry.AttackSituation)));
+
+        for (const FMCS_AttackCondition& Condition : Entry.ConditionalChecks)
+        {
+            // FName hashes differ between runs; hash the text
+            Hash = HashCombineFast(Hash, FCrc::StrCrc32(*Condition.AttributeName.ToString()));
+            Hash = HashCombineFast(Hash, GetTypeHash(static_cast<uint8>(Condition.Comparison)));
+            Hash = HashCombineFast(Hash, GetTypeHash(Condition.Threshold));
+            Hash = HashCombineFast(Hash, GetTypeHash(Condition.Weight));
+            Hash = HashCombineFast(Hash, GetTypeHash(Condition.bMustPass));
+        }
+    }
+    return Hash;
+}
+
+void FMCS_CompiledAttackSet::SerializeDerived(FArchive& Ar)
+{
+    Ar << NameToIndex;
+
+    // Plain columns: one memcpy each
+    BucketStarts.BulkSerialize(Ar);
+    BucketIndices.BulkSerialize(Ar);
+    TypeStarts.BulkSerialize(Ar);
+    TypeIndices.BulkSerialize(Ar);
+    Reach.BulkSerialize(Ar);
+    ReachOrder.BulkSerialize(Ar);
+}
+
+void FMCS_CompiledAttackSet::BuildPartitions()
+{
+    constexpr int32 NumBuckets = NumTypes * NumDirections * NumSituations;
+
+    Reach.SetNumUninitialized(Entries.Num());
+    ReachOrder.SetNumUninitialized(Entries.Num());
+    for (int32 Index = 0; Index < Entries.Num(); ++Index)
+    {
+        Reach[Index] = Entries[Index].RangeEnd * RangeSlack;
+        ReachOrder[Index] = Index;
+    }
+
+    // Two passes (count, then fill) so each bucket is one contiguous, ascending run
+    BucketStarts.Init(0, NumBuckets + 1);
+    TypeStarts.Init(0, NumTypes + 1);
+
+    auto ForEachBucket = [](const FMCS_AttackEntry& Entry, TFunctionRef<void(int32)> Visit)
+        {
+            const int32 Type = static_cast<int32>(Entry.AttackType);
+            const int32 Direction = static_cast<int32>(Entry.AttackDirection);
+            const int32 Situation = static_cast<int32>(Entry.AttackSituation);
+
+            const int32 FirstDirection = Direction < NumDirections ? Direction : 0;
+            const int32 LastDirection = Direction < NumDirections ? Direction : NumDirections - 1;
+            const int32 FirstSituation = Situation < NumSituations ? Situation : 0;
+            const int32 LastSituation = Situation < NumSituations ? Situation : NumSituations - 1;
+
+            for (int32 Dir = FirstDirection; Dir <= LastDirection; ++Dir)
+            {
+                for (int32 Sit = FirstSituation; Sit <= LastSituation; ++Sit)
+                {
+                    Visit((Type * NumDirections + Dir) * NumSituations + Sit);
+                }
+            }
+        };
+
+    for (const FMCS_AttackEntry& Entry : Entries)
+    {
+        ForEachBucket(Entry, [this](int32 Bucket) { ++BucketStarts[Bucket + 1]; });
+        ++TypeStarts[static_cast<int32>(Entry.AttackType) + 1];
+    }
+
+    for (int32 i = 0; i < NumBuckets; ++i)
+    {
+        BucketStarts[i + 1] += BucketStarts[i];
+    }
+    for (int32 i = 0; i < NumTypes; ++i)
+    {
+        TypeStarts[i + 1] += TypeStarts[i];
+    }
+
+    BucketIndices.SetNumUninitialized(BucketStarts[NumBuckets]);
+    TypeIndices.SetNumUninitialized(TypeStarts[NumTypes]);
+
+    TArray<int32> BucketFill(BucketStarts.GetData(), NumBuckets);
+    TArray<int32> TypeFill(TypeStarts.GetData(), NumTypes);
+
+    for (int32 Index = 0; Index < Entries.Num(); ++Index)
+    {
+        ForEachBucket(Entries[Index], [this, &BucketFill, Index](int32 Bucket) { BucketIndices[BucketFill[Bucket]++] = Index; });
+        TypeIndices[TypeFill[static_cast<int32>(Entries[Index].AttackType)]++] = Index;
+    }
+
+    // Farthest reach first (ties keep DataTable order) so a distance query only keeps a prefix
+    const auto ByReach = [this](int32 A, int32 B) { return Reach[A] != Reach[B] ? Reach[A] > Reach[B] : A < B; };
+
+    for (int32 i = 0; i < NumBuckets; ++i)
+    {
+        MakeArrayView(BucketIndices.GetData() + BucketStarts[i], BucketStarts[i + 1] - BucketStarts[i]).Sort(ByReach);
+    }
+    for (int32 i = 0; i < NumTypes; ++i)
+    {
+        MakeArrayView(TypeIndices.GetData() + TypeStarts[i], TypeStarts[i + 1] - TypeStarts[i]).Sort(ByReach);
+    }
+    ReachOrder.Sort(ByReach);
+}
+
+TConstArrayView<int32> FMCS_CompiledAttackSet::GetBucket(EMCS_AttackType Type, EMCS_AttackDirection Direction, EMCS_AttackSituations Situation) const
+{
+    const int32 Dir = static_cast<int32>(Direction);
+    const int32 Sit = static_cast<int32>(Situation);
+    if (BucketStarts.IsEmpty() || Dir >= NumDirections || Sit >= NumSituations)
+    {
+        return {};
+    }
+
+    const int32 Bucket = (static_cast<int32>(Type) * NumDirections + Dir) * NumSituations + Sit;
+    return TConstArrayView<int32>(BucketIndices.GetData() + BucketStarts[Bucket], BucketStarts[Bucket + 1] - BucketStarts[Bucket]);
+}
+
+TConstArrayView<int32> FMCS_CompiledAttackSet::GetTypeBucket(EMCS_AttackType Type) const
+{
+    const int32 T = static_cast<int32>(Type);
+    if (TypeStarts.IsEmpty())
+    {
+        return {};
+    }
+
+    return TConstArrayView<int32>(TypeIndices.GetData() + TypeStarts[T], TypeStarts[T + 1] - TypeStarts[T]);
+}
+
+TConstArrayView<int32> FMCS_CompiledAttackSet::ClipToReach(TConstArrayView<int32> Candidates, float Distance) const
+{
+    if (Distance < 0.f)
+    {
+        return Candidates;
+    }
+
+    // First candidate the distance is beyond; everything after it reaches even less far
+    const int32 Count = Algo::UpperBoundBy(Candidates, Distance, [this](int32 Index) { return Reach[Index]; }, TGreater<>());
+    return Candidates.Left(Count);
+}
+
+void FMCS_AttackMemory::Reset(int32 InNumEntries)
+{
+    NumEntries = FMath::Max(InNumEntries, 0);
+    const int32 Padded = Align(NumEntries, 4);
+
+    ReadyTime.Init(0.f, Padded);
+    LastUsedTime.Init(MCS_AttackMemory::NeverUsed, Padded);
+    EntryNames.Init(NAME_None, NumEntries);
+}
+
+void FMCS_AttackMemory::Rebuild(TConstArrayView<FMCS_AttackEntry> Entries)
+{
+    const FMCS_AttackMemory Previous = MoveTemp(*this);
+
+    Reset(Entries.Num());
+    for (int32 i = 0; i < NumEntries; ++i)
+    {
+        EntryNames[i] = Entries[i].AttackName;
+    }
+
+    InheritFrom(Previous);
+}
+
+void FMCS_AttackMemory::InheritFrom(const FMCS_AttackMemory& Other)
+{
+    if (NumEntries == 0 || Other.NumEntries == 0)
+    {
+        return;
+    }
+
+    // Only runs when sets are registered or edited
+    TMap<FName, int32> OtherIndices;
+    OtherIndices.Reserve(Other.NumEntries);
+    for (int32 i = 0; i < Other.NumEntries; ++i)
+    {
+        if (!Other.EntryNames[i].IsNone())
+        {
+            OtherIndices.Add(Other.EntryNames[i], i);
+        }
+    }
+
+    for (int32 i = 0; i < NumEntries; ++i)
+    {
+        if (const int32* Found = OtherIndices.Find(EntryNames[i]))
+        {
+            ReadyTime[i] = FMath::Max(ReadyTime[i], Other.ReadyTime[*Found]);
+            LastUsedTime[i] = FMath::Max(LastUsedTime[i], Other.LastUsedTime[*Found]);
+        }
+    }
+}
+
+void FMCS_AttackMemory::MarkUsed(TConstArrayView<FMCS_AttackEntry> Entries, int32 Index, float WorldTime)
+{
+    if (!Entries.IsValidIndex(Index) || Index >= NumEntries)
+    {
+        return;
+    }
+
+    const FMCS_AttackEntry& Used = Entries[Index];
+    const float Ready = WorldTime + Used.Cooldown;
+
+    LastUsedTime[Index] = WorldTime;
+    ReadyTime[Index] = FMath::Max(ReadyTime[Index], Ready);
+
+    ApplyGroupCooldown(Entries, Used.CooldownGroup, Ready);
+}
+
+void FMCS_AttackMemory::ApplyGroupCooldown(TConstArrayView<FMCS_AttackEntry> Entries, FName CooldownGroup, float ReadyAt)
+{
+    if (CooldownGroup.IsNone())
+    {
+        return;
+    }
+
+    // Only runs when an attack starts, so a linear scan over the group is fine
+    const int32 Count = FMath::Min(NumEntries, Entries.Num());
+    for (int32 i = 0; i < Count; ++i)
+    {
+        if (Entries[i].CooldownGroup == CooldownGroup)
+        {
+            ReadyTime[i] = FMath::Max(ReadyTime[i], ReadyAt);
+        }
+    }
+}
+
+void FMCS_AttackMemory::ComputePenalties(float WorldTime, float RecencyPenalty, float RecencyWindow, TArray<float>& OutPenalties) const
+{
+    OutPenalties.SetNumUninitialized(ReadyTime.Num(), EAllowShrinking::No);
+
+    const VectorRegister4Float Zero = VectorZeroFloat();
+    const VectorRegister4Float One = VectorOneFloat();
+    const VectorRegister4Float Now = VectorSetFloat1(WorldTime);
+    const bool bHasWindow = RecencyWindow > 0.f;
+    const VectorRegister4Float Penalty = VectorSetFloat1(bHasWindow ? RecencyPenalty : 0.f);
+    const VectorRegister4Float InvWindow = VectorSetFloat1(bHasWindow ? 1.f / RecencyWindow : 0.f);
+    const VectorRegister4Float Blocked = VectorSetFloat1(MAX_flt);
+
+    // Arrays are padded to a multiple of 4; padding lanes are never read by the chooser
+    for (int32 i = 0; i < ReadyTime.Num(); i += 4)
+    {
+        // Recency: Penalty * max(0, 1 - (Now - LastUsed) / Window)
+        const VectorRegister4Float Age = VectorSubtract(Now, VectorLoad(&LastUsedTime[i]));
+        const VectorRegister4Float Fade = VectorMax(VectorSubtract(One, VectorMultiply(Age, InvWindow)), Zero);
+        const VectorRegister4Float Recency = VectorMultiply(Penalty, Fade);
+
+        // Cooldown: block entries whose ready time is still ahead
+        const VectorRegister4Float ReadyMask = VectorCompareLE(VectorLoad(&ReadyTime[i]), Now);
+
+        VectorStore(VectorSelect(ReadyMask, Recency, Blocked), &OutPenalties[i]);
+    }
+}
@@ -0,0 +1,242 @@
+/*
+ * ========================================================================
+ * Copyright © 2025 God's Studio
+ * All Rights Reserved.
+ *
+ * Free for all to use, copy, and distribute. I hope you learn from this as I learned creating it.
+ * =============================================================================
+ *
+ * Project: Motion Combat System
+ * This is a combat system inspired by Unreal Engine’s Motion Matching plugin.
+ * Author: Christopher D. Parker
+ * Date: 10-18-2026
+ * =============================================================================
+ * MCS_CompiledDefenseSet.cpp
+ * Builds compiled defense sets and the per-attacker threat geometry.
+ */
+
+#include <Structs/MCS_CompiledDefenseSet.h>
+#include "Engine/DataTable.h"
+#include "GameFramework/Actor.h"
+#include "GameplayTagAssetInterface.h"
+
+FMCS_DefenseThreat FMCS_DefenseThreat::Make(const AActor* Defender, const AActor* Attacker)
+{
+    FMCS_DefenseThreat Threat;
+    if (!IsValid(Defender) || !IsValid(Attacker))
+    {
+        return Threat;
+    }
+
+    const FVector ToAttacker = Attacker->GetActorLocation() - Defender->GetActorLocation();
+    const FVector Dir = ToAttacker.GetSafeNormal();
+
+    Threat.Distance = ToAttacker.Size();
+    Threat.FacingDot = FVector::DotProduct(Defender->GetActorForwardVector(), Dir);
+
+    // Same ~75° frontal cone the facing score has always used
+    EMCS_AttackDirection Side;
+    if (Threat.FacingDot > 0.25f)
+    {
+        Side = EMCS_AttackDirection::Forward;
+    }
+    else if (Threat.FacingDot < -0.25f)
+    {
+        Side = EMCS_AttackDirection::Backward;
+    }
+    else
+    {
+        Side = FVector::DotProduct(Defender->GetActorRightVector(), Dir) >= 0.f ? EMCS_AttackDirection::Right : EMCS_AttackDirection::Left;
+    }
+
+    Threat.DirectionBit = static_cast<uint8>(1u << static_cast<uint8>(Side));
+    Threat.bValid = true;
+    return Threat;
+}
+
+void FMCS_CompiledDefenseSet::Build(const UDataTable& Table)
+{
+    TArray<FMCS_DefenseEntry*> Rows;
+    Table.GetAllRows(TEXT("CompileDefenseSet"), Rows);
+
+    TArray<FMCS_DefenseEntry> Copied;
+    Copied.Reserve(Rows.Num());
+    for (const FMCS_DefenseEntry* Row : Rows)
+    {
+        if (Row)
+        {
+            Copied.Add(*Row);
+        }
+    }
+
+    Build(MoveTemp(Copied));
+}
+
+void FMCS_CompiledDefenseSet::Build(TConstArrayView<FMCS_DefenseEntry> InEntries)
+{
+    Build(TArray<FMCS_DefenseEntry>(InEntries));
+}
+
+void FMCS_CompiledDefenseSet::Build(TArray<FMCS_DefenseEntry>&& InEntries)
+{
+    Entries = MoveTemp(InEntries);
+
+    const int32 Count = Entries.Num();
+    const int32 Padded = Align(Count, 4);
+
+    RangeMid.Init(0.f, Padded);
+    RangeInvExtent.Init(0.f, Padded);
+    IntentBits.SetNumZeroed(Count);
+    DirectionBits.SetNumZeroed(Count);
+    RequiredTagBits.SetNumZeroed(Count);
+    ExcludedTagBits.SetNumZeroed(Count);
+    TagList.Reset();
+    bTagOverflow = false;
+
+    for (int32 i = 0; i < Count; ++i)
+    {
+        const FMCS_DefenseEntry& Entry = Entries[i];
+
+        //----------------------------------------
+        // Distance window
+        //----------------------------------------
+        const float Extent = (Entry.Range.Y - Entry.Range.X) * 0.5f;
+        RangeMid[i] = (Entry.Range.X + Entry.Range.Y) * 0.5f;
+        RangeInvExtent[i] = Extent > 1.f ? 1.f / Extent : 0.f; // no meaningful range scores 0
+
+        //----------------------------------------
+        // Intent / direction masks
+        //----------------------------------------
+        IntentBits[i] = static_cast<uint8>(1u << static_cast<uint8>(Entry.DefenseIntent));
+        DirectionBits[i] = Entry.ValidDirection == EMCS_AttackDirection::Omni
+            ? 0
+            : static_cast<uint8>(1u << static_cast<uint8>(Entry.ValidDirection));
+
+        //----------------------------------------
+        // Tag bitsets
+        //----------------------------------------
+        auto ToBits = [ this ] (const FGameplayTagContainer& Container) -> uint64
+            {
+                uint64 Bits = 0;
+                for (const FGameplayTag& Tag : Container)
+                {
+                    int32 Bit = TagList.IndexOfByKey(Tag);
+                    if (Bit == INDEX_NONE)
+                    {
+                        Bit = TagList.Add(Tag);
+                    }
+
+                    if (Bit < MaxTagBits)
+                    {
+                        Bits |= uint64(1) << Bit;
+                    }
+                    else
+                    {
+                        bTagOverflow = true;
+                    }
+                }
+                return Bits;
+            };
+
+        RequiredTagBits[i] = ToBits(Entry.RequiredTags);
+        ExcludedTagBits[i] = ToBits(Entry.ExcludedTags);
+    }
+}
+
+void FMCS_CompiledDefenseSet::SerializeDerived(FArchive& Ar)
+{
+    RangeMid.BulkSerialize(Ar);
+    RangeInvExtent.BulkSerialize(Ar);
+    IntentBits.BulkSerialize(Ar);
+    DirectionBits.BulkSerialize(Ar);
+    RequiredTagBits.BulkSerialize(Ar);
+    ExcludedTagBits.BulkSerialize(Ar);
+    Ar << bTagOverflow;
+
+    // Tags travel by name; bit positions stay those of TagList
+    int32 NumTags = TagList.Num();
+    Ar << NumTags;
+
+    if (Ar.IsLoading())
+    {
+        TagList.SetNum(NumTags);
+    }
+
+    for (FGameplayTag& Tag : TagList)
+    {
+        FName TagName = Tag.GetTagName();
+        Ar << TagName;
+
+        if (Ar.IsLoading())
+        {
+            Tag = FGameplayTag::RequestGameplayTag(TagName, false);
+        }
+    }
+}
+
+bool FMCS_CompiledDefenseSet::GatherOwnedTags(const AActor* Actor, uint64& OutOwnedBits, FGameplayTagContainer& OutOwnedTags) const
+{
+    OutOwnedBits = 0;
+    OutOwnedTags.Reset();
+
+    const IGameplayTagAssetInterface* TagInterface = Cast<IGameplayTagAssetInterface>(Actor);
+    if (!TagInterface)
+    {
+        return false;
+    }
+
+    TagInterface->GetOwnedGameplayTags(OutOwnedTags);
+
+    const int32 NumBits = FMath::Min(TagList.Num(), MaxTagBits);
+    for (int32 Bit = 0; Bit < NumBits; ++Bit)
+    {
+        // HasTag so owning a child tag satisfies a parent requirement, like the containers would
+        if (OutOwnedTags.HasTag(TagList[Bit]))
+        {
+            OutOwnedBits |= uint64(1) << Bit;
+        }
+    }
+
+    return true;
+}
+
+bool FMCS_CompiledDefenseSet::PassesTags(int32 Index, uint64 OwnedBits, const FGameplayTagContainer& OwnedTags) const
+{
+    if ((RequiredTagBits[Index] & ~OwnedBits) != 0 || (ExcludedTagBits[Index] & OwnedBits) != 0)
+    {
+        return false;
+    }
+
+    // Tags past the bitset width are checked the slow way
+    if (bTagOverflow)
+    {
+        const FMCS_DefenseEntry& Entry = Entries[Index];
+        return OwnedTags.HasAll(Entry.RequiredTags) && !OwnedTags.HasAny(Entry.ExcludedTags);
+    }
+
+    return true;
+}
+
+void FMCS_CompiledDefenseSet::ComputeDistanceScores(float Distance, TArray<float>& OutScores) const
+{
+    OutScores.SetNumUninitialized(RangeMid.Num(), EAllowShrinking::No);
+
+    const VectorRegister4Float Zero = VectorZeroFloat();
+    const VectorRegister4Float One = VectorOneFloat();
+    const VectorRegister4Float Dist = VectorSetFloat1(Distance);
+    const VectorRegister4Float Scale = VectorSetFloat1(50.f);
+    const VectorRegister4Float Offset = VectorSetFloat1(25.f);
+
+    for (int32 i = 0; i < RangeMid.Num(); i += 4)
+    {
+        const VectorRegister4Float InvExtent = VectorLoad(&RangeInvExtent[i]);
+
+        // Normalized factor (1 = perfect, 0 = far outside), mapped to -25..+25
+        const VectorRegister4Float Delta = VectorAbs(VectorSubtract(Dist, VectorLoad(&RangeMid[i])));
+        const VectorRegister4Float Normalized = VectorMin(VectorMax(VectorSubtract(One, VectorMultiply(Delta, InvExtent)), Zero), One);
+        const VectorRegister4Float Score = VectorSubtract(VectorMultiply(Normalized, Scale), Offset);
+
+        // Entries without a meaningful range contribute nothing
+        VectorStore(VectorSelect(VectorCompareGT(InvExtent, Zero), Score, Zero), &OutScores[i]);
+    }
+}
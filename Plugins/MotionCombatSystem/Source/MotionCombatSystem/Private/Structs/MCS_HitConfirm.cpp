@@ -0,0 +1,199 @@
+/*
+ * ========================================================================
+ * Copyright © 2025 God's Studio
+ * All Rights Reserved.
+ *
+ * Free for all to use, copy, and distribute. I hope you learn from this as I learned creating it.
+ * =============================================================================
+ *
+ * Project: Motion Combat System
+ * This is a combat system inspired by Unreal Engine’s Motion Matching plugin.
+ * Author: Christopher D. Parker
+ * Date: 10-18-2026
+ * =============================================================================
+ * MCS_HitConfirm.cpp
+ * Packing and net serialization of confirmed hit batches.
+ */
+
+#include <Structs/MCS_HitConfirm.h>
+#include "GameFramework/Actor.h"
+#include "GameFramework/Character.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Engine/NetSerialization.h"
+#include "UObject/CoreNet.h"
+
+namespace MCS_HitConfirm
+{
+    /* Severity (3 bits) and reaction level (2 bits) share one field */
+    constexpr int32 SeverityBits = 3;
+    constexpr int32 FlagBits = SeverityBits + 2;
+
+    static_assert(static_cast<int32>(EPGAS_HitSeverity::Death) < (1 << SeverityBits), "Hit severity no longer fits its bits");
+
+    /** Mesh the victim's bones are indexed on (the same lookup the hit reaction component plays montages on) */
+    const USkeletalMeshComponent* GetMesh(const AActor* Victim)
+    {
+        const ACharacter* Character = Cast<ACharacter>(Victim);
+        return Character ? Character->GetMesh() : nullptr;
+    }
+
+    /** Index of Value in Table, adding it if missing */
+    template<typename T, typename U>
+    int32 FindOrAdd(TArray<T>& Table, const U& Value)
+    {
+        const int32 Found = Table.IndexOfByKey(Value);
+        return Found != INDEX_NONE ? Found : Table.Add(Value);
+    }
+
+    /** Serializes a table index or count as a packed int, rejecting values above Limit when loading */
+    bool SerializeIndex(FArchive& Ar, int32& Value, int32 Limit)
+    {
+        uint32 Packed = static_cast<uint32>(FMath::Max(Value, 0));
+        Ar.SerializeIntPacked(Packed);
+
+        if (Ar.IsLoading())
+        {
+            if (Limit < 0 || Packed > static_cast<uint32>(Limit))
+            {
+                return false;
+            }
+            Value = static_cast<int32>(Packed);
+        }
+        return true;
+    }
+}
+
+void FMCS_HitConfirmBatch::Reset()
+{
+    Actors.Reset();
+    AttackNames.Reset();
+    Hits.Reset();
+}
+
+void FMCS_HitConfirmBatch::Add(AActor* Attacker, AActor* Victim, FName AttackName, const FVector& ImpactPoint, FName BoneName,
+    EPGAS_HitSeverity Severity, EMCS_HitReactionLevel Level)
+{
+    if (!IsValid(Victim))
+    {
+        return;
+    }
+
+    FEntry& Entry = Hits.AddDefaulted_GetRef();
+    Entry.Attacker = IsValid(Attacker) ? MCS_HitConfirm::FindOrAdd(Actors, Attacker) : INDEX_NONE;
+    Entry.Victim = MCS_HitConfirm::FindOrAdd(Actors, Victim);
+    Entry.Attack = MCS_HitConfirm::FindOrAdd(AttackNames, AttackName);
+    Entry.ImpactOffset = ImpactPoint - Victim->GetActorLocation();
+    Entry.Severity = Severity;
+    Entry.Level = Level;
+
+    const USkeletalMeshComponent* Mesh = MCS_HitConfirm::GetMesh(Victim);
+    Entry.BoneIndex = (Mesh && !BoneName.IsNone()) ? Mesh->GetBoneIndex(BoneName) : INDEX_NONE;
+}
+
+bool FMCS_HitConfirmBatch::Unpack(int32 Index, FMCS_ConfirmedHit& OutHit) const
+{
+    if (!Hits.IsValidIndex(Index))
+    {
+        return false;
+    }
+
+    const FEntry& Entry = Hits[Index];
+    AActor* Victim = Actors.IsValidIndex(Entry.Victim) ? Actors[Entry.Victim].Get() : nullptr;
+    if (!IsValid(Victim))
+    {
+        return false;
+    }
+
+    OutHit.Attacker = Actors.IsValidIndex(Entry.Attacker) ? Actors[Entry.Attacker].Get() : nullptr;
+    OutHit.Victim = Victim;
+    OutHit.AttackName = AttackNames.IsValidIndex(Entry.Attack) ? AttackNames[Entry.Attack] : NAME_None;
+    OutHit.ImpactPoint = Victim->GetActorLocation() + Entry.ImpactOffset;
+    OutHit.Severity = Entry.Severity;
+    OutHit.Level = Entry.Level;
+
+    const USkeletalMeshComponent* Mesh = MCS_HitConfirm::GetMesh(Victim);
+    OutHit.BoneName = (Mesh && Entry.BoneIndex != INDEX_NONE) ? Mesh->GetBoneName(Entry.BoneIndex) : NAME_None;
+    return true;
+}
+
+bool FMCS_HitConfirmBatch::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+    using namespace MCS_HitConfirm;
+
+    if (!Map)
+    {
+        bOutSuccess = false;
+        return false;
+    }
+
+    int32 NumActors = Actors.Num();
+    int32 NumAttacks = AttackNames.Num();
+    int32 NumHits = Hits.Num();
+
+    bOutSuccess = SerializeIndex(Ar, NumActors, MaxEntries)
+        && SerializeIndex(Ar, NumAttacks, MaxEntries)
+        && SerializeIndex(Ar, NumHits, MaxEntries);
+
+    if (!bOutSuccess)
+    {
+        Ar.SetError();
+        return false;
+    }
+
+    if (Ar.IsLoading())
+    {
+        Actors.SetNum(NumActors);
+        AttackNames.SetNum(NumAttacks);
+        Hits.SetNum(NumHits);
+    }
+
+    // Actors go out as network GUIDs; ones the client doesn't have resolve to null
+    for (TObjectPtr<AActor>& Actor : Actors)
+    {
+        UObject* Object = Actor.Get();
+        bOutSuccess &= Map->SerializeObject(Ar, AActor::StaticClass(), Object);
+        if (Ar.IsLoading())
+        {
+            Actor = Cast<AActor>(Object);
+        }
+    }
+
+    for (FName& AttackName : AttackNames)
+    {
+        Ar << AttackName;
+    }
+
+    for (FEntry& Entry : Hits)
+    {
+        // Attacker and bone are optional: store them shifted by one so INDEX_NONE packs as 0
+        int32 Attacker = Entry.Attacker + 1;
+        int32 Bone = Entry.BoneIndex + 1;
+
+        bOutSuccess &= SerializeIndex(Ar, Attacker, NumActors)
+            && SerializeIndex(Ar, Entry.Victim, NumActors - 1)
+            && SerializeIndex(Ar, Entry.Attack, NumAttacks - 1)
+            && SerializeIndex(Ar, Bone, MAX_uint16);
+
+        // Centimeter offset from the victim, with as few bits per component as it needs
+        bOutSuccess &= SerializePackedVector<1, 20>(Entry.ImpactOffset, Ar);
+
+        uint8 Flags = static_cast<uint8>(Entry.Severity) | (static_cast<uint8>(Entry.Level) << SeverityBits);
+        Ar.SerializeBits(&Flags, FlagBits);
+
+        if (Ar.IsLoading())
+        {
+            Entry.Attacker = Attacker - 1;
+            Entry.BoneIndex = Bone - 1;
+            Entry.Severity = static_cast<EPGAS_HitSeverity>(Flags & ((1 << SeverityBits) - 1));
+            Entry.Level = static_cast<EMCS_HitReactionLevel>(Flags >> SeverityBits);
+            bOutSuccess &= Entry.Severity <= EPGAS_HitSeverity::Death;
+            bOutSuccess &= Entry.Level <= EMCS_HitReactionLevel::Full;
+        }
+    }
+
+    if (!bOutSuccess)
+    {
+        Ar.SetError();
+    }
+    return bOutSuccess;
+}
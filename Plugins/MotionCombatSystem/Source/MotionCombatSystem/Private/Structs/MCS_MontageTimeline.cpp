@@ -0,0 +1,231 @@
+/*
+ * ========================================================================
+ * Copyright © 2025 God's Studio
+ * All Rights Reserved.
+ *
+ * Free for all to use, copy, and distribute. I hope you learn from this as I learned creating it.
+ * =============================================================================
+ *
+ * Project: Motion Combat System
+ * This is a combat system inspired by Unreal Engine’s Motion Matching plugin.
+ * Author: Christopher D. Parker
+ * Date: 10-18-2026
+ * =============================================================================
+ * MCS_MontageTimeline.cpp
+ * Extracts MCS notify windows from montages and bakes the reach of hitbox windows.
+ */
+
+#include <Structs/MCS_MontageTimeline.h>
+#include "Animation/AnimMontage.h"
+#include "Animation/AnimSequence.h"
+#include "Animation/Skeleton.h"
+#include "Engine/SkeletalMeshSocket.h"
+
+namespace MCS_Timeline
+{
+    /** Spacing of the pose samples taken over a hitbox window (montage seconds) */
+    constexpr float ReachSampleInterval = 1.f / 30.f;
+
+    /** Covers the arc a fast swing travels between two samples */
+    constexpr float ReachPadding = 25.f;
+
+    /** Slack when matching the montage position to a window that just opened (notifies fire a frame late) */
+    constexpr float ReachTolerance = 0.05f;
+
+    /** A hitbox socket resolved against the skeleton: the bone it follows and its offset from that bone */
+    struct FSocketBinding
+    {
+        int32 BoneIndex = INDEX_NONE;
+        FVector Offset = FVector::ZeroVector;
+    };
+
+    static FSocketBinding ResolveSocket(const USkeleton& Skeleton, FName SocketName)
+    {
+        FSocketBinding Binding;
+
+        if (const USkeletalMeshSocket* Socket = Skeleton.FindSocket(SocketName))
+        {
+            Binding.BoneIndex = Skeleton.GetReferenceSkeleton().FindBoneIndex(Socket->BoneName);
+            Binding.Offset = Socket->RelativeLocation;
+        }
+        else
+        {
+            // Sockets may name a bone directly
+            Binding.BoneIndex = Skeleton.GetReferenceSkeleton().FindBoneIndex(SocketName);
+        }
+
+        return Binding;
+    }
+
+    /** Component space location of a socket at a montage position; false if no sequence plays there */
+    static bool SampleSocket(const UAnimMontage& Montage, const FReferenceSkeleton& RefSkeleton, const FSocketBinding& Binding, float Position, FVector& OutLocation)
+    {
+        const FAnimSegment* Segment = Montage.SlotAnimTracks.IsEmpty() ? nullptr : Montage.SlotAnimTracks[0].AnimTrack.GetSegmentAtTime(Position);
+        const UAnimSequence* Sequence = Segment ? Cast<UAnimSequence>(Segment->GetAnimReference()) : nullptr;
+        if (!Sequence)
+        {
+            return false;
+        }
+
+        const FAnimExtractContext Context(static_cast<double>(Segment->ConvertTrackPosToAnimPos(Position)));
+
+        // Compose bone-local transforms up to the root. The root stays at its reference pose: its animated
+        // motion is root motion, which moves the actor the reach box is relative to, not the hitbox.
+        FTransform ComponentSpace(Binding.Offset);
+        for (int32 Bone = Binding.BoneIndex; Bone != INDEX_NONE; Bone = RefSkeleton.GetParentIndex(Bone))
+        {
+            FTransform Local = RefSkeleton.GetRefBonePose()[Bone];
+            if (RefSkeleton.GetParentIndex(Bone) != INDEX_NONE)
+            {
+                Sequence->GetBoneTransform(Local, FSkeletonPoseBoneIndex(Bone), Context, false);
+            }
+            ComponentSpace = ComponentSpace * Local;
+        }
+
+        OutLocation = ComponentSpace.GetLocation();
+        return true;
+    }
+
+    /** Box around both hitbox sockets sampled over [StartTime, EndTime], grown by the sweep radius */
+    static FBox BakeReach(const UAnimMontage& Montage, const FMCS_AttackHitbox& Hitbox, float StartTime, float EndTime)
+    {
+        const USkeleton* Skeleton = Montage.GetSkeleton();
+        if (!Skeleton || Hitbox.StartSocket.IsNone() || Hitbox.EndSocket.IsNone())
+        {
+            return FBox(ForceInit);
+        }
+
+        const FSocketBinding Start = ResolveSocket(*Skeleton, Hitbox.StartSocket);
+        const FSocketBinding End = ResolveSocket(*Skeleton, Hitbox.EndSocket);
+        if (Start.BoneIndex == INDEX_NONE || End.BoneIndex == INDEX_NONE)
+        {
+            UE_LOG(LogTemp, Verbose, TEXT("[MontageTimeline] %s: hitbox sockets %s / %s are not on the skeleton; window is never culled."),
+                *Montage.GetName(), *Hitbox.StartSocket.ToString(), *Hitbox.EndSocket.ToString());
+            return FBox(ForceInit);
+        }
+
+        const FReferenceSkeleton& RefSkeleton = Skeleton->GetReferenceSkeleton();
+        const int32 NumSamples = FMath::Max(FMath::CeilToInt((EndTime - StartTime) / ReachSampleInterval), 1);
+
+        FBox Reach(ForceInit);
+        for (int32 i = 0; i <= NumSamples; ++i)
+        {
+            const float Position = FMath::Lerp(StartTime, EndTime, static_cast<float>(i) / NumSamples);
+
+            FVector StartLocation;
+            FVector EndLocation;
+            if (!SampleSocket(Montage, RefSkeleton, Start, Position, StartLocation) || !SampleSocket(Montage, RefSkeleton, End, Position, EndLocation))
+            {
+                return FBox(ForceInit);
+            }
+
+            // The swept segment lies inside the box of its two ends
+            Reach += StartLocation;
+            Reach += EndLocation;
+        }
+
+        return Reach.ExpandBy(Hitbox.Radius + ReachPadding);
+    }
+}
+
+void FMCS_MontageTimeline::Build(const UAnimMontage& Montage)
+{
+    Windows.Reset();
+
+    for (const FAnimNotifyEvent& Event : Montage.Notifies)
+    {
+        const UAnimNotifyState_MCSWindow* Window = Cast<UAnimNotifyState_MCSWindow>(Event.NotifyStateClass);
+        if (!Window || Window->EventType == EMCS_AnimEventType::None)
+        {
+            continue;
+        }
+
+        FMCS_MontageWindow& Entry = Windows.AddDefaulted_GetRef();
+        Entry.EventType = Window->EventType;
+        Entry.Id = Window->Id;
+        Entry.StartTime = Event.GetTriggerTime();
+        Entry.EndTime = Event.GetEndTriggerTime();
+
+        if (Entry.EventType == EMCS_AnimEventType::HitboxWindow)
+        {
+            Entry.Reach = MCS_Timeline::BakeReach(Montage, Window->Hitbox, Entry.StartTime, Entry.EndTime);
+        }
+    }
+
+    Windows.Sort([] (const FMCS_MontageWindow& A, const FMCS_MontageWindow& B)
+        {
+            return A.StartTime < B.StartTime;
+        });
+}
+
+const FMCS_MontageWindow* FMCS_MontageTimeline::FindNextWindow(EMCS_AnimEventType EventType, float Position) const
+{
+    for (const FMCS_MontageWindow& Window : Windows)
+    {
+        if (Window.EventType == EventType && Window.EndTime > Position)
+        {
+            return &Window;
+        }
+    }
+    return nullptr;
+}
+
+const FMCS_MontageWindow* FMCS_MontageTimeline::FindNextImpact(float Position) const
+{
+    for (const FMCS_MontageWindow& Window : Windows)
+    {
+        if ((Window.EventType == EMCS_AnimEventType::HitboxWindow || Window.EventType == EMCS_AnimEventType::AreaOfEffect)
+            && Window.EndTime > Position)
+        {
+            return &Window;
+        }
+    }
+    return nullptr;
+}
+
+FBox FMCS_MontageTimeline::FindReach(float Position) const
+{
+    FBox Reach(ForceInit);
+
+    for (const FMCS_MontageWindow& Window : Windows)
+    {
+        if (Window.StartTime - MCS_Timeline::ReachTolerance > Position)
+        {
+            break; // sorted by start time
+        }
+
+        if (Window.EventType != EMCS_AnimEventType::HitboxWindow || Window.EndTime < Position)
+        {
+            continue;
+        }
+
+        if (!Window.Reach.IsValid)
+        {
+            return FBox(ForceInit);
+        }
+
+        Reach += Window.Reach;
+    }
+
+    return Reach;
+}
+
+void FMCS_MontageTimeline::Serialize(FArchive& Ar)
+{
+    int32 NumWindows = Windows.Num();
+    Ar << NumWindows;
+
+    if (Ar.IsLoading())
+    {
+        Windows.SetNum(NumWindows);
+    }
+
+    for (FMCS_MontageWindow& Window : Windows)
+    {
+        Ar << Window.EventType;
+        Ar << Window.Id;
+        Ar << Window.StartTime;
+        Ar << Window.EndTime;
+        Ar << Window.Reach;
+    }
+}
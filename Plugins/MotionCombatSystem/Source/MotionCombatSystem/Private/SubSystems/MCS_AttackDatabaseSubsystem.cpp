@@ -0,0 +1,647 @@
+/*
+ * ========================================================================
+ * Copyright © 2025 God's Studio
+ * All Rights Reserved.
+ *
+ * Free for all to use, copy, and distribute. I hope you learn from this as I learned creating it.
+ * =============================================================================
+ *
+ * Project: Motion Combat System
+ * This is a combat system inspired by Unreal Engine’s Motion Matching plugin.
+ * Author: Christopher D. Parker
+ * Date: 10-18-2026
+ * =============================================================================
+ * MCS_AttackDatabaseSubsystem.cpp
+ * Implementation for the compiled attack/defense set and montage timeline cache.
+ */
+
+#include <SubSystems/MCS_AttackDatabaseSubsystem.h>
+#include <Data/MCS_CombatDatabase.h>
+#include <Stats/MCS_Stats.h>
+#include <Components/MCS_CombatCoreComponent.h>
+#include <Components/MCS_CombatDefenseComponent.h>
+#include <Components/MCS_CombatHitReactionComponent.h>
+#include "Engine/DataTable.h"
+#include "Animation/AnimMontage.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "GameFramework/GameModeBase.h"
+#include "Async/ParallelFor.h"
+
+DECLARE_CYCLE_STAT(TEXT("Database Prewarm"), STAT_MCS_DatabasePrewarm, STATGROUP_MotionCombat);
+
+namespace MCS_AttackDatabase
+{
+    /** First registered cooked database containing the asset at Path, through one of its Find* lookups */
+    template <typename ValueType>
+    static TSharedPtr<const ValueType> FindCooked(TConstArrayView<TObjectPtr<UMCS_CombatDatabase>> Databases, const FSoftObjectPath& Path,
+        TSharedPtr<const ValueType> (UMCS_CombatDatabase::*Find)(const FSoftObjectPath&) const)
+    {
+        for (const UMCS_CombatDatabase* Database : Databases)
+        {
+            if (TSharedPtr<const ValueType> Cooked = (Database->*Find)(Path))
+            {
+                return Cooked;
+            }
+        }
+        return nullptr;
+    }
+
+    /** Copies the rows of a DataTable (game thread only: the table's row map is not guarded) */
+    template <typename RowType>
+    static TArray<RowType> ReadRows(const UDataTable& Table, const TCHAR* Context)
+    {
+        TArray<RowType*> Rows;
+        Table.GetAllRows(Context, Rows);
+
+        TArray<RowType> Copied;
+        Copied.Reserve(Rows.Num());
+        for (const RowType* Row : Rows)
+        {
+            if (Row)
+            {
+                Copied.Add(*Row);
+            }
+        }
+        return Copied;
+    }
+
+    /** Copies the rows of a hit reaction table */
+    static TSharedRef<TArray<FMCS_HitReaction>> ReadReactions(const UDataTable& Table)
+    {
+        return MakeShared<TArray<FMCS_HitReaction>>(ReadRows<FMCS_HitReaction>(Table, TEXT("GetHitReactions")));
+    }
+
+    /** Tables referenced by the combat components of the actors about to begin play */
+    struct FPrewarmTables
+    {
+        TArray<TSoftObjectPtr<UDataTable>> Attack;
+        TArray<TSoftObjectPtr<UDataTable>> Defense;
+        TArray<TSoftObjectPtr<UDataTable>> Reaction;
+
+        void Gather(const UActorComponent* Component)
+        {
+            if (const UMCS_CombatCoreComponent* Core = Cast<UMCS_CombatCoreComponent>(Component))
+            {
+                for (const TPair<FGameplayTag, FMCS_AttackSetData>& Pair : Core->AttackSets)
+                {
+                    if (!Pair.Value.AttackDataTable.IsNull())
+                    {
+                        Attack.AddUnique(Pair.Value.AttackDataTable);
+                    }
+                }
+            }
+            else if (const UMCS_CombatDefenseComponent* DefenseComponent = Cast<UMCS_CombatDefenseComponent>(Component))
+            {
+                for (const TPair<FGameplayTag, FMCS_DefenseSetData>& Pair : DefenseComponent->DefenseSets)
+                {
+                    if (!Pair.Value.DefenseDataTable.IsNull())
+                    {
+                        Defense.AddUnique(Pair.Value.DefenseDataTable);
+                    }
+                }
+            }
+            else if (const UMCS_CombatHitReactionComponent* ReactionComponent = Cast<UMCS_CombatHitReactionComponent>(Component))
+            {
+                if (!ReactionComponent->HitReactionDataTable.IsNull())
+                {
+                    Reaction.AddUnique(ReactionComponent->HitReactionDataTable);
+                }
+            }
+        }
+    };
+}
+
+bool UMCS_AttackDatabaseSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+    // Only create for PIE/Game worlds; ignore Editor worlds.
+    const UWorld* World = Cast<UWorld>(Outer);
+    return (World && World->IsGameWorld());
+}
+
+void UMCS_AttackDatabaseSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    ActorsInitializedHandle = FWorldDelegates::OnWorldInitializedActors.AddUObject(this, &UMCS_AttackDatabaseSubsystem::HandleWorldActorsInitialized);
+
+#if WITH_EDITOR
+    if (GIsEditor && !bUseCookedDatabasesInEditor)
+    {
+        return;
+    }
+#endif
+
+    LLM_SCOPE_BYTAG(MotionCombat_Databases);
+
+    for (const TSoftObjectPtr<UMCS_CombatDatabase>& Cooked : CookedDatabases)
+    {
+        if (UMCS_CombatDatabase* Database = Cooked.LoadSynchronous())
+        {
+            AddCookedDatabase(Database);
+        }
+        else if (!Cooked.IsNull())
+        {
+            UE_LOG(LogTemp, Warning, TEXT("[AttackDatabase] Cooked database %s could not be loaded."), *Cooked.ToString());
+        }
+    }
+}
+
+void UMCS_AttackDatabaseSubsystem::AddCookedDatabase(UMCS_CombatDatabase* Database)
+{
+    if (Database && !Databases.Contains(Database))
+    {
+        Databases.Add(Database);
+        UE_LOG(LogTemp, Log, TEXT("[AttackDatabase] Using cooked database %s."), *Database->GetName());
+    }
+}
+
+void UMCS_AttackDatabaseSubsystem::HandleWorldActorsInitialized(const FActorsInitializedParams& Params)
+{
+    UWorld* InWorld = Params.World;
+    if (InWorld != GetWorld() || !bPrewarmOnLoad)
+    {
+        return;
+    }
+
+    // Runs while the map loads, before any actor's BeginPlay: combatants placed in the level, plus the classes spawned later
+    MCS_AttackDatabase::FPrewarmTables Tables;
+
+    for (TActorIterator<AActor> It(InWorld); It; ++It)
+    {
+        for (const UActorComponent* Component : It->GetComponents())
+        {
+            Tables.Gather(Component);
+        }
+    }
+
+    TArray<TSubclassOf<AActor>> SpawnedClasses;
+    if (const AGameModeBase* GameMode = InWorld->GetAuthGameMode())
+    {
+        if (GameMode->DefaultPawnClass)
+        {
+            SpawnedClasses.Add(GameMode->DefaultPawnClass);
+        }
+    }
+    for (const TSoftClassPtr<AActor>& SpawnedClass : PrewarmActorClasses)
+    {
+        if (UClass* Class = SpawnedClass.LoadSynchronous())
+        {
+            SpawnedClasses.AddUnique(Class);
+        }
+    }
+    for (const TSubclassOf<AActor>& Class : SpawnedClasses)
+    {
+        AActor::ForEachComponentOfActorClassDefault(Class, UActorComponent::StaticClass(), [ &Tables ] (const UActorComponent* Component)
+            {
+                Tables.Gather(Component);
+                return true;
+            });
+    }
+
+    Prewarm(Tables.Attack, Tables.Defense, Tables.Reaction);
+}
+
+void UMCS_AttackDatabaseSubsystem::Prewarm(TConstArrayView<TSoftObjectPtr<UDataTable>> AttackTables,
+    TConstArrayView<TSoftObjectPtr<UDataTable>> DefenseTables, TConstArrayView<TSoftObjectPtr<UDataTable>> ReactionTables)
+{
+    SCOPE_CYCLE_COUNTER(STAT_MCS_DatabasePrewarm);
+    LLM_SCOPE_BYTAG(MotionCombat_Databases);
+
+    const double StartTime = FPlatformTime::Seconds();
+
+    // Cached and cooked data is taken as is (cooked tables are never loaded); only the rest is loaded and compiled
+    TArray<const UDataTable*> PendingAttack;
+    for (const TSoftObjectPtr<UDataTable>& TableRef : AttackTables)
+    {
+        const FSoftObjectPath Path = TableRef.ToSoftObjectPath();
+        if (Path.IsNull() || CompiledSets.Contains(Path))
+        {
+            continue;
+        }
+
+        if (TSharedPtr<const FMCS_CompiledAttackSet> Cooked = MCS_AttackDatabase::FindCooked(Databases, Path, &UMCS_CombatDatabase::FindAttackSet))
+        {
+            CompiledSets.Add(Path, Cooked);
+        }
+        else if (const UDataTable* Table = TableRef.LoadSynchronous())
+        {
+            PendingAttack.AddUnique(Table);
+        }
+    }
+
+    TArray<const UDataTable*> PendingDefense;
+    for (const TSoftObjectPtr<UDataTable>& TableRef : DefenseTables)
+    {
+        const FSoftObjectPath Path = TableRef.ToSoftObjectPath();
+        if (Path.IsNull() || CompiledDefenseSets.Contains(Path))
+        {
+            continue;
+        }
+
+        if (TSharedPtr<const FMCS_CompiledDefenseSet> Cooked = MCS_AttackDatabase::FindCooked(Databases, Path, &UMCS_CombatDatabase::FindDefenseSet))
+        {
+            CompiledDefenseSets.Add(Path, Cooked);
+        }
+        else if (const UDataTable* Table = TableRef.LoadSynchronous())
+        {
+            PendingDefense.AddUnique(Table);
+        }
+    }
+
+    TArray<const UDataTable*> PendingReaction;
+    for (const TSoftObjectPtr<UDataTable>& TableRef : ReactionTables)
+    {
+        const FSoftObjectPath Path = TableRef.ToSoftObjectPath();
+        if (Path.IsNull() || ReactionSets.Contains(Path))
+        {
+            continue;
+        }
+
+        if (TSharedPtr<const TArray<FMCS_HitReaction>> Cooked = MCS_AttackDatabase::FindCooked(Databases, Path, &UMCS_CombatDatabase::FindReactions))
+        {
+            ReactionSets.Add(Path, Cooked);
+        }
+        else if (const UDataTable* Table = TableRef.LoadSynchronous())
+        {
+            PendingReaction.AddUnique(Table);
+        }
+    }
+
+    //----------------------------------------
+    // Game thread: copy the rows out of the tables (UObject reads), and take reactions as is
+    //----------------------------------------
+    TArray<TArray<FMCS_AttackEntry>> AttackRows;
+    TArray<FName> AttackSetIds;
+    AttackRows.Reserve(PendingAttack.Num());
+    AttackSetIds.Reserve(PendingAttack.Num());
+    for (const UDataTable* Table : PendingAttack)
+    {
+        AttackRows.Add(MCS_AttackDatabase::ReadRows<FMCS_AttackEntry>(*Table, TEXT("CompileAttackSet")));
+        AttackSetIds.Add(FName(*Table->GetPathName()));
+    }
+
+    TArray<TArray<FMCS_DefenseEntry>> DefenseRows;
+    DefenseRows.Reserve(PendingDefense.Num());
+    for (const UDataTable* Table : PendingDefense)
+    {
+        DefenseRows.Add(MCS_AttackDatabase::ReadRows<FMCS_DefenseEntry>(*Table, TEXT("CompileDefenseSet")));
+    }
+
+    for (const UDataTable* Table : PendingReaction)
+    {
+        ReactionSets.Add(FSoftObjectPath(Table), MCS_AttackDatabase::ReadReactions(*Table));
+    }
+
+    //----------------------------------------
+    // Workers: compile the plain row copies; one task per table, no UObject access
+    //----------------------------------------
+    TArray<TSharedPtr<FMCS_CompiledAttackSet>> BuiltAttack;
+    TArray<TSharedPtr<FMCS_CompiledDefenseSet>> BuiltDefense;
+    BuiltAttack.SetNum(PendingAttack.Num());
+    BuiltDefense.SetNum(PendingDefense.Num());
+
+    ParallelFor(PendingAttack.Num() + PendingDefense.Num(), [ & ] (int32 Task)
+        {
+            LLM_SCOPE_BYTAG(MotionCombat_Databases);
+
+            if (Task < PendingAttack.Num())
+            {
+                BuiltAttack[Task] = MakeShared<FMCS_CompiledAttackSet>();
+                BuiltAttack[Task]->Build(MoveTemp(AttackRows[Task]));
+                BuiltAttack[Task]->SetId = AttackSetIds[Task];
+                return;
+            }
+            Task -= PendingAttack.Num();
+
+            BuiltDefense[Task] = MakeShared<FMCS_CompiledDefenseSet>();
+            BuiltDefense[Task]->Build(MoveTemp(DefenseRows[Task]));
+        });
+
+    for (int32 Index = 0; Index < PendingAttack.Num(); ++Index)
+    {
+        AddCompiledSet(PendingAttack[Index], BuiltAttack[Index].ToSharedRef());
+    }
+    for (int32 Index = 0; Index < PendingDefense.Num(); ++Index)
+    {
+        AddCompiledDefenseSet(PendingDefense[Index], BuiltDefense[Index].ToSharedRef());
+    }
+
+    // Notify timelines of every montage the sets can play (the rows hold the montages, so they are already loaded)
+    TArray<const UAnimMontage*> PendingMontages;
+    auto AddMontage = [ this, &PendingMontages ] (const UAnimMontage* Montage)
+        {
+            if (Montage && !MontageTimelines.Contains(Montage) && !PendingMontages.Contains(Montage))
+            {
+                if (TSharedPtr<const FMCS_MontageTimeline> Cooked = MCS_AttackDatabase::FindCooked(Databases, FSoftObjectPath(Montage), &UMCS_CombatDatabase::FindMontageTimeline))
+                {
+                    MontageTimelines.Add(Montage, Cooked);
+                }
+                else
+                {
+                    PendingMontages.Add(Montage);
+                }
+            }
+        };
+
+    for (const TSoftObjectPtr<UDataTable>& TableRef : AttackTables)
+    {
+        if (const TSharedPtr<const FMCS_CompiledAttackSet>* Set = CompiledSets.Find(TableRef.ToSoftObjectPath()))
+        {
+            for (const FMCS_AttackEntry& Entry : (*Set)->Entries)
+            {
+                AddMontage(Entry.AttackMontage);
+            }
+        }
+    }
+    for (const TSoftObjectPtr<UDataTable>& TableRef : DefenseTables)
+    {
+        if (const TSharedPtr<const FMCS_CompiledDefenseSet>* Set = CompiledDefenseSets.Find(TableRef.ToSoftObjectPath()))
+        {
+            for (const FMCS_DefenseEntry& Entry : (*Set)->Entries)
+            {
+                AddMontage(Entry.DefenseMontage);
+            }
+        }
+    }
+
+    // Baking reads the montage's notifies, slot tracks and skeleton pose, so it stays on the game thread
+    for (const UAnimMontage* Montage : PendingMontages)
+    {
+        TSharedRef<FMCS_MontageTimeline> Timeline = MakeShared<FMCS_MontageTimeline>();
+        Timeline->Build(*Montage);
+        MontageTimelines.Add(Montage, Timeline);
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("[AttackDatabase] Prewarmed %d attack, %d defense, %d reaction tables and %d montage timelines in %.2f ms."),
+        PendingAttack.Num(), PendingDefense.Num(), PendingReaction.Num(), PendingMontages.Num(), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+}
+
+void UMCS_AttackDatabaseSubsystem::Deinitialize()
+{
+    FWorldDelegates::OnWorldInitializedActors.Remove(ActorsInitializedHandle);
+    ActorsInitializedHandle.Reset();
+
+#if WITH_EDITOR
+    for (const TPair<FSoftObjectPath, TSharedPtr<const FMCS_CompiledAttackSet>>& Pair : CompiledSets)
+    {
+        if (UDataTable* Table = Cast<UDataTable>(Pair.Key.ResolveObject()))
+        {
+            Table->OnDataTableChanged().RemoveAll(this);
+        }
+    }
+    for (const TPair<FSoftObjectPath, TSharedPtr<const FMCS_CompiledDefenseSet>>& Pair : CompiledDefenseSets)
+    {
+        if (UDataTable* Table = Cast<UDataTable>(Pair.Key.ResolveObject()))
+        {
+            Table->OnDataTableChanged().RemoveAll(this);
+        }
+    }
+#endif
+
+    CompiledSets.Empty();
+    CompiledDefenseSets.Empty();
+    MontageTimelines.Empty();
+    ReactionSets.Empty();
+    Databases.Empty();
+
+    Super::Deinitialize();
+}
+
+UMCS_AttackDatabaseSubsystem* UMCS_AttackDatabaseSubsystem::Get(const UObject* WorldContextObject)
+{
+    const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+    return World ? World->GetSubsystem<UMCS_AttackDatabaseSubsystem>() : nullptr;
+}
+
+TSharedPtr<const FMCS_CompiledAttackSet> UMCS_AttackDatabaseSubsystem::GetCompiledSet(const TSoftObjectPtr<UDataTable>& TableRef)
+{
+    const FSoftObjectPath Path = TableRef.ToSoftObjectPath();
+    if (Path.IsNull())
+    {
+        return nullptr;
+    }
+
+    if (const TSharedPtr<const FMCS_CompiledAttackSet>* Existing = CompiledSets.Find(Path))
+    {
+        return *Existing;
+    }
+
+    if (TSharedPtr<const FMCS_CompiledAttackSet> Cooked = MCS_AttackDatabase::FindCooked(Databases, Path, &UMCS_CombatDatabase::FindAttackSet))
+    {
+        CompiledSets.Add(Path, Cooked);
+        return Cooked;
+    }
+
+    // Not cooked: only now is the table itself loaded
+    const UDataTable* Table = TableRef.LoadSynchronous();
+    if (!Table)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("[AttackDatabase] Attack table %s could not be loaded."), *Path.ToString());
+        return nullptr;
+    }
+
+    LLM_SCOPE_BYTAG(MotionCombat_Databases);
+
+    TSharedRef<FMCS_CompiledAttackSet> Compiled = MakeShared<FMCS_CompiledAttackSet>();
+    Compiled->Build(*Table);
+
+    UE_LOG(LogTemp, Log, TEXT("[AttackDatabase] Compiled %s (%d entries)."), *Table->GetName(), Compiled->Num());
+
+    AddCompiledSet(Table, Compiled);
+    return Compiled;
+}
+
+void UMCS_AttackDatabaseSubsystem::AddCompiledSet(const UDataTable* Table, const TSharedRef<FMCS_CompiledAttackSet>& Compiled)
+{
+    CompiledSets.Add(FSoftObjectPath(Table), Compiled);
+
+#if WITH_EDITOR
+    const_cast<UDataTable*>(Table)->OnDataTableChanged().AddUObject(this, &UMCS_AttackDatabaseSubsystem::HandleAttackTableChanged, Table);
+#endif
+}
+
+#if WITH_EDITOR
+void UMCS_AttackDatabaseSubsystem::HandleAttackTableChanged(const UDataTable* Table)
+{
+    if (!Table || !CompiledSets.Contains(FSoftObjectPath(Table)))
+    {
+        return;
+    }
+
+    LLM_SCOPE_BYTAG(MotionCombat_Databases);
+
+    // Build a new set rather than mutating the shared one; choosers holding the old set keep a consistent view
+    TSharedRef<FMCS_CompiledAttackSet> Compiled = MakeShared<FMCS_CompiledAttackSet>();
+    Compiled->Build(*Table);
+    CompiledSets.Add(FSoftObjectPath(Table), Compiled);
+
+    UE_LOG(LogTemp, Log, TEXT("[AttackDatabase] Recompiled %s after edit (%d entries)."), *Table->GetName(), Compiled->Num());
+
+    OnAttackTableRecompiled.Broadcast(Table);
+}
+
+void UMCS_AttackDatabaseSubsystem::HandleDefenseTableChanged(const UDataTable* Table)
+{
+    if (!Table || !CompiledDefenseSets.Contains(FSoftObjectPath(Table)))
+    {
+        return;
+    }
+
+    LLM_SCOPE_BYTAG(MotionCombat_Databases);
+
+    // Same as attack tables: a new set, so choosers still holding the old one stay consistent
+    TSharedRef<FMCS_CompiledDefenseSet> Compiled = MakeShared<FMCS_CompiledDefenseSet>();
+    Compiled->Build(*Table);
+    CompiledDefenseSets.Add(FSoftObjectPath(Table), Compiled);
+
+    UE_LOG(LogTemp, Log, TEXT("[AttackDatabase] Recompiled defense set %s after edit (%d entries)."), *Table->GetName(), Compiled->Num());
+
+    OnDefenseTableRecompiled.Broadcast(Table);
+}
+#endif
+
+TSharedPtr<const FMCS_CompiledDefenseSet> UMCS_AttackDatabaseSubsystem::GetCompiledDefenseSet(const TSoftObjectPtr<UDataTable>& TableRef)
+{
+    const FSoftObjectPath Path = TableRef.ToSoftObjectPath();
+    if (Path.IsNull())
+    {
+        return nullptr;
+    }
+
+    if (const TSharedPtr<const FMCS_CompiledDefenseSet>* Existing = CompiledDefenseSets.Find(Path))
+    {
+        return *Existing;
+    }
+
+    if (TSharedPtr<const FMCS_CompiledDefenseSet> Cooked = MCS_AttackDatabase::FindCooked(Databases, Path, &UMCS_CombatDatabase::FindDefenseSet))
+    {
+        CompiledDefenseSets.Add(Path, Cooked);
+        return Cooked;
+    }
+
+    const UDataTable* Table = TableRef.LoadSynchronous();
+    if (!Table)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("[AttackDatabase] Defense table %s could not be loaded."), *Path.ToString());
+        return nullptr;
+    }
+
+    LLM_SCOPE_BYTAG(MotionCombat_Databases);
+
+    TSharedRef<FMCS_CompiledDefenseSet> Compiled = MakeShared<FMCS_CompiledDefenseSet>();
+    Compiled->Build(*Table);
+
+    UE_LOG(LogTemp, Log, TEXT("[AttackDatabase] Compiled defense set %s (%d entries, %d tags)."),
+        *Table->GetName(), Compiled->Num(), Compiled->TagList.Num());
+
+    AddCompiledDefenseSet(Table, Compiled);
+    return Compiled;
+}
+
+void UMCS_AttackDatabaseSubsystem::AddCompiledDefenseSet(const UDataTable* Table, const TSharedRef<FMCS_CompiledDefenseSet>& Compiled)
+{
+    CompiledDefenseSets.Add(FSoftObjectPath(Table), Compiled);
+
+#if WITH_EDITOR
+    const_cast<UDataTable*>(Table)->OnDataTableChanged().AddUObject(this, &UMCS_AttackDatabaseSubsystem::HandleDefenseTableChanged, Table);
+#endif
+}
+
+TSharedPtr<const FMCS_MontageTimeline> UMCS_AttackDatabaseSubsystem::GetMontageTimeline(const UAnimMontage* Montage)
+{
+    if (!Montage)
+    {
+        return nullptr;
+    }
+
+    if (const TSharedPtr<const FMCS_MontageTimeline>* Existing = MontageTimelines.Find(Montage))
+    {
+        return *Existing;
+    }
+
+    if (TSharedPtr<const FMCS_MontageTimeline> Cooked = MCS_AttackDatabase::FindCooked(Databases, FSoftObjectPath(Montage), &UMCS_CombatDatabase::FindMontageTimeline))
+    {
+        MontageTimelines.Add(Montage, Cooked);
+        return Cooked;
+    }
+
+    LLM_SCOPE_BYTAG(MotionCombat_Databases);
+
+    TSharedRef<FMCS_MontageTimeline> Timeline = MakeShared<FMCS_MontageTimeline>();
+    Timeline->Build(*Montage);
+
+    MontageTimelines.Add(Montage, Timeline);
+    return Timeline;
+}
+
+TSharedPtr<const TArray<FMCS_HitReaction>> UMCS_AttackDatabaseSubsystem::GetHitReactions(const TSoftObjectPtr<UDataTable>& TableRef)
+{
+    const FSoftObjectPath Path = TableRef.ToSoftObjectPath();
+    if (Path.IsNull())
+    {
+        return nullptr;
+    }
+
+    if (const TSharedPtr<const TArray<FMCS_HitReaction>>* Existing = ReactionSets.Find(Path))
+    {
+        return *Existing;
+    }
+
+    if (TSharedPtr<const TArray<FMCS_HitReaction>> Cooked = MCS_AttackDatabase::FindCooked(Databases, Path, &UMCS_CombatDatabase::FindReactions))
+    {
+        ReactionSets.Add(Path, Cooked);
+        return Cooked;
+    }
+
+    const UDataTable* Table = TableRef.LoadSynchronous();
+    if (!Table)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("[AttackDatabase] Hit reaction table %s could not be loaded."), *Path.ToString());
+        return nullptr;
+    }
+
+    LLM_SCOPE_BYTAG(MotionCombat_Databases);
+
+    TSharedRef<TArray<FMCS_HitReaction>> Reactions = MCS_AttackDatabase::ReadReactions(*Table);
+
+    ReactionSets.Add(Path, Reactions);
+    return Reactions;
+}
+
+SIZE_T UMCS_AttackDatabaseSubsystem::GetCompiledSetSize(const TSoftObjectPtr<UDataTable>& Table) const
+{
+    const TSharedPtr<const FMCS_CompiledAttackSet>* Found = CompiledSets.Find(Table.ToSoftObjectPath());
+    return Found && Found->IsValid() ? sizeof(FMCS_CompiledAttackSet) + (*Found)->GetAllocatedSize() : 0;
+}
+
+SIZE_T UMCS_AttackDatabaseSubsystem::GetCompiledDefenseSetSize(const TSoftObjectPtr<UDataTable>& Table) const
+{
+    const TSharedPtr<const FMCS_CompiledDefenseSet>* Found = CompiledDefenseSets.Find(Table.ToSoftObjectPath());
+    return Found && Found->IsValid() ? sizeof(FMCS_CompiledDefenseSet) + (*Found)->GetAllocatedSize() : 0;
+}
+
+SIZE_T UMCS_AttackDatabaseSubsystem::GetAllocatedSize() const
+{
+    SIZE_T Size = CompiledSets.GetAllocatedSize() + CompiledDefenseSets.GetAllocatedSize() + MontageTimelines.GetAllocatedSize()
+        + ReactionSets.GetAllocatedSize();
+
+    for (const TPair<FSoftObjectPath, TSharedPtr<const FMCS_CompiledAttackSet>>& Pair : CompiledSets)
+    {
+        Size += Pair.Value.IsValid() ? sizeof(FMCS_CompiledAttackSet) + Pair.Value->GetAllocatedSize() : 0;
+    }
+    for (const TPair<FSoftObjectPath, TSharedPtr<const FMCS_CompiledDefenseSet>>& Pair : CompiledDefenseSets)
+    {
+        Size += Pair.Value.IsValid() ? sizeof(FMCS_CompiledDefenseSet) + Pair.Value->GetAllocatedSize() : 0;
+    }
+    for (const TPair<TObjectKey<UAnimMontage>, TSharedPtr<const FMCS_MontageTimeline>>& Pair : MontageTimelines)
+    {
+        Size += Pair.Value.IsValid() ? sizeof(FMCS_MontageTimeline) + Pair.Value->GetAllocatedSize() : 0;
+    }
+    for (const TPair<FSoftObjectPath, TSharedPtr<const TArray<FMCS_HitReaction>>>& Pair : ReactionSets)
+    {
+        Size += Pair.Value.IsValid() ? sizeof(TArray<FMCS_HitReaction>) + Pair.Value->GetAllocatedSize() : 0;
+    }
+
+    return Size;
+}
@@ -0,0 +1,205 @@
+/*
+ * ========================================================================
+ * Copyright © 2025 God's Studio
+ * All Rights Reserved.
+ *
+ * Free for all to use, copy, and distribute. I hope you learn from this as I learned creating it.
+ * =============================================================================
+ *
+ * Project: Motion Combat System
+ * This is a combat system inspired by Unreal Engine’s Motion Matching plugin.
+ * Author: Christopher D. Parker
+ * Date: 10-18-2026
+ * =============================================================================
+ * MCS_CombatBudgetSubsystem.cpp
+ * Implementation of the combat frame-budget governor.
+ */
+
+#include <SubSystems/MCS_CombatBudgetSubsystem.h>
+#include <Stats/MCS_Stats.h>
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/PlatformTime.h"
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Degradation Level"), STAT_MCS_DegradationLevel, STATGROUP_MotionCombat);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Combat Cost (ms)"), STAT_MCS_CombatCost, STATGROUP_MotionCombat);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Combat Cost Smoothed (ms)"), STAT_MCS_CombatCostSmoothed, STATGROUP_MotionCombat);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Cost: Choosers (ms)"), STAT_MCS_CostChooser, STATGROUP_MotionCombat);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Cost: Sweeps (ms)"), STAT_MCS_CostSweeps, STATGROUP_MotionCombat);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Cost: Scans (ms)"), STAT_MCS_CostScans, STATGROUP_MotionCombat);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Cost: Reactions (ms)"), STAT_MCS_CostReactions, STATGROUP_MotionCombat);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Cost: Events (ms)"), STAT_MCS_CostEvents, STATGROUP_MotionCombat);
+
+bool UMCS_CombatBudgetSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+    // Only create for PIE/Game worlds; ignore Editor worlds.
+    const UWorld* World = Cast<UWorld>(Outer);
+    return (World && World->IsGameWorld());
+}
+
+TStatId UMCS_CombatBudgetSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UMCS_CombatBudgetSubsystem, STATGROUP_Tickables);
+}
+
+UMCS_CombatBudgetSubsystem* UMCS_CombatBudgetSubsystem::Get(const UObject* WorldContextObject)
+{
+    const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+    return World ? World->GetSubsystem<UMCS_CombatBudgetSubsystem>() : nullptr;
+}
+
+void UMCS_CombatBudgetSubsystem::Tick(float DeltaTime)
+{
+    Super::Tick(DeltaTime);
+
+    //----------------------------------------
+    // Close the frame's measurements
+    //----------------------------------------
+    float CategoryMs[static_cast<int32>(EMCS_BudgetCategory::MAX)];
+    float FrameMs = 0.f;
+
+    for (int32 i = 0; i < static_cast<int32>(EMCS_BudgetCategory::MAX); ++i)
+    {
+        CategoryMs[i] = static_cast<float>(FPlatformTime::ToMilliseconds64(FrameCycles[i]));
+        FrameMs += CategoryMs[i];
+        FrameCycles[i] = 0;
+    }
+
+    SmoothedCostMs = FMath::Lerp(SmoothedCostMs, FrameMs, CostSmoothing);
+    ReactionMontagesThisFrame = 0;
+
+    //----------------------------------------
+    // Step one level at a time, with separate down/up thresholds and frame counts
+    //----------------------------------------
+    if (!bEnabled)
+    {
+        OverBudgetFrames = 0;
+        UnderBudgetFrames = 0;
+        SetLevel(EMCS_DegradationLevel::None);
+    }
+    else if (SmoothedCostMs > FrameBudgetMs)
+    {
+        UnderBudgetFrames = 0;
+        if (++OverBudgetFrames >= StepDownFrames && Level < EMCS_DegradationLevel::DebugDraws)
+        {
+            OverBudgetFrames = 0;
+            SetLevel(static_cast<EMCS_DegradationLevel>(static_cast<uint8>(Level) + 1));
+        }
+    }
+    else if (SmoothedCostMs < FrameBudgetMs * RecoverFraction)
+    {
+        OverBudgetFrames = 0;
+        if (++UnderBudgetFrames >= StepUpFrames && Level > EMCS_DegradationLevel::None)
+        {
+            UnderBudgetFrames = 0;
+            SetLevel(static_cast<EMCS_DegradationLevel>(static_cast<uint8>(Level) - 1));
+        }
+    }
+    else
+    {
+        OverBudgetFrames = 0;
+        UnderBudgetFrames = 0;
+    }
+
+    //----------------------------------------
+    // Publish
+    //----------------------------------------
+    SET_DWORD_STAT(STAT_MCS_DegradationLevel, static_cast<uint32>(Level));
+    SET_FLOAT_STAT(STAT_MCS_CombatCost, FrameMs);
+    SET_FLOAT_STAT(STAT_MCS_CombatCostSmoothed, SmoothedCostMs);
+    SET_FLOAT_STAT(STAT_MCS_CostChooser, CategoryMs[static_cast<int32>(EMCS_BudgetCategory::Chooser)]);
+    SET_FLOAT_STAT(STAT_MCS_CostSweeps, CategoryMs[static_cast<int32>(EMCS_BudgetCategory::Sweeps)]);
+    SET_FLOAT_STAT(STAT_MCS_CostScans, CategoryMs[static_cast<int32>(EMCS_BudgetCategory::Scans)]);
+    SET_FLOAT_STAT(STAT_MCS_CostReactions, CategoryMs[static_cast<int32>(EMCS_BudgetCategory::Reactions)]);
+    SET_FLOAT_STAT(STAT_MCS_CostEvents, CategoryMs[static_cast<int32>(EMCS_BudgetCategory::Events)]);
+
+    CSV_CUSTOM_STAT(MotionCombat, DegradationLevel, static_cast<int32>(Level), ECsvCustomStatOp::Set);
+    CSV_CUSTOM_STAT(MotionCombat, CombatCostMs, FrameMs, ECsvCustomStatOp::Set);
+}
+
+void UMCS_CombatBudgetSubsystem::SetLevel(EMCS_DegradationLevel NewLevel)
+{
+    if (Level == NewLevel)
+    {
+        return;
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("[CombatBudget] Degradation %s -> %s (%.2f ms / %.2f ms budget)"),
+        *UEnum::GetValueAsString(Level), *UEnum::GetValueAsString(NewLevel), SmoothedCostMs, FrameBudgetMs);
+
+    Level = NewLevel;
+    OnDegradationChanged.Broadcast(Level);
+}
+
+int32 UMCS_CombatBudgetSubsystem::GetSubstepCount(int32 Requested) const
+{
+    return IsAtLeast(EMCS_DegradationLevel::HitboxSubsteps) ? FMath::Min(Requested, DegradedSubstepCount) : Requested;
+}
+
+float UMCS_CombatBudgetSubsystem::GetScanIntervalScale() const
+{
+    return IsAtLeast(EMCS_DegradationLevel::ScanFrequency) ? ScanIntervalScale : 1.f;
+}
+
+bool UMCS_CombatBudgetSubsystem::AdmitReactionMontage()
+{
+    if (!IsAtLeast(EMCS_DegradationLevel::ReactionAdmission))
+    {
+        return true;
+    }
+
+    if (ReactionMontagesThisFrame >= MaxReactionMontagesPerFrame)
+    {
+        return false;
+    }
+
+    ++ReactionMontagesThisFrame;
+    return true;
+}
+
+bool UMCS_CombatBudgetSubsystem::ShouldRunAIDecision(const AActor* Actor) const
+{
+    if (!IsAtLeast(EMCS_DegradationLevel::AIDecisionRate) || !Actor)
+    {
+        return true;
+    }
+
+    if (const APawn* Pawn = Cast<APawn>(Actor); Pawn && Pawn->IsPlayerControlled())
+    {
+        return true;
+    }
+
+    // Significant while near any player
+    const FVector Location = Actor->GetActorLocation();
+    for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
+    {
+        const APlayerController* Controller = It->Get();
+        const APawn* PlayerPawn = Controller ? Controller->GetPawn() : nullptr;
+        if (PlayerPawn && FVector::DistSquared(PlayerPawn->GetActorLocation(), Location) <= FMath::Square(LowSignificanceDistance))
+        {
+            return true;
+        }
+    }
+
+    // Staggered so low-significance combatants don't all decide on the same frame
+    return (GFrameCounter + GetTypeHash(Actor)) % static_cast<uint64>(FMath::Max(LowSignificanceDecisionInterval, 1)) == 0;
+}
+
+FMCS_BudgetScope::FMCS_BudgetScope(const UObject* WorldContextObject, EMCS_BudgetCategory InCategory)
+    : Governor(UMCS_CombatBudgetSubsystem::Get(WorldContextObject))
+    , Category(InCategory)
+{
+    if (Governor)
+    {
+        StartCycles = FPlatformTime::Cycles64();
+    }
+}
+
+FMCS_BudgetScope::~FMCS_BudgetScope()
+{
+    if (Governor)
+    {
+        Governor->AddCost(Category, FPlatformTime::Cycles64() - StartCycles);
+    }
+}
@@ -0,0 +1,194 @@
+/*
+ * ========================================================================
+ * Copyright © 2025 God's Studio
+ * All Rights Reserved.
+ *
+ * Free for all to use, copy, and distribute. I hope you learn from this as I learned creating it.
+ * =============================================================================
+ *
+ * Project: Motion Combat System
+ * This is a combat system inspired by Unreal Engine’s Motion Matching plugin.
+ * Author: Christopher D. Parker
+ * Date: 10-18-2026
+ * =============================================================================
+ * MCS_CombatGridSubsystem.cpp
+ * Implementation for the combatant spatial hash grid.
+ */
+
+#include <SubSystems/MCS_CombatGridSubsystem.h>
+#include <Stats/MCS_Stats.h>
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "GenericTeamAgentInterface.h"
+
+DECLARE_CYCLE_STAT(TEXT("Grid Rebuild"), STAT_MCS_GridRebuild, STATGROUP_MotionCombat);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Grid Combatants"), STAT_MCS_GridCombatants, STATGROUP_MotionCombat);
+
+bool UMCS_CombatGridSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+    // Only create for PIE/Game worlds; ignore Editor worlds.
+    const UWorld* World = Cast<UWorld>(Outer);
+    return (World && World->IsGameWorld());
+}
+
+void UMCS_CombatGridSubsystem::Deinitialize()
+{
+    Registered.Empty();
+    Actors.Empty();
+    ActorIndices.Empty();
+    CellRanges.Empty();
+
+    Super::Deinitialize();
+}
+
+void UMCS_CombatGridSubsystem::RegisterCombatant(AActor* Combatant)
+{
+    if (IsValid(Combatant))
+    {
+        LLM_SCOPE_BYTAG(MotionCombat_HitBuffers);
+        Registered.AddUnique(Combatant);
+        BuiltFrame = MAX_uint64;
+    }
+}
+
+void UMCS_CombatGridSubsystem::UnregisterCombatant(AActor* Combatant)
+{
+    Registered.RemoveSwap(Combatant);
+    BuiltFrame = MAX_uint64;
+}
+
+uint8 UMCS_CombatGridSubsystem::GetTeamOf(const AActor* Actor)
+{
+    const FGenericTeamId TeamId = FGenericTeamId::GetTeamIdentifier(Actor);
+    return TeamId == FGenericTeamId::NoTeam ? NoTeam : TeamId.GetId();
+}
+
+void UMCS_CombatGridSubsystem::RebuildIfStale()
+{
+    if (BuiltFrame != GFrameCounter)
+    {
+        Rebuild();
+    }
+}
+
+void UMCS_CombatGridSubsystem::Rebuild()
+{
+    SCOPE_CYCLE_COUNTER(STAT_MCS_GridRebuild);
+    LLM_SCOPE_BYTAG(MotionCombat_HitBuffers);
+
+    BuiltFrame = GFrameCounter;
+
+    Registered.RemoveAllSwap([] (const TWeakObjectPtr<AActor>& Actor) { return !Actor.IsValid(); });
+
+    const int32 Count = Registered.Num();
+    Actors.Reset(Count);
+    PosX.Reset(Count);
+    PosY.Reset(Count);
+    PosZ.Reset(Count);
+    Radii.Reset(Count);
+    HalfHeights.Reset(Count);
+    Teams.Reset(Count);
+    ActorIndices.Reset();
+    KeyScratch.Reset(Count);
+    MaxRadius = 0.f;
+    MaxHalfHeight = 0.f;
+
+    //----------------------------------------
+    // Snapshot
+    //----------------------------------------
+    for (const TWeakObjectPtr<AActor>& WeakActor : Registered)
+    {
+        const AActor* Actor = WeakActor.Get();
+        // Actors with collision disabled (e.g. dead or despawning) can't be hit
+        if (!Actor->GetActorEnableCollision())
+        {
+            continue;
+        }
+
+        float Radius = 0.f;
+        float HalfHeight = 0.f;
+        Actor->GetSimpleCollisionCylinder(Radius, HalfHeight);
+
+        const FVector Location = Actor->GetActorLocation();
+        const int32 Index = Actors.Add(WeakActor);
+        PosX.Add(Location.X);
+        PosY.Add(Location.Y);
+        PosZ.Add(Location.Z);
+        Radii.Add(Radius);
+        HalfHeights.Add(HalfHeight);
+        Teams.Add(GetTeamOf(Actor));
+        ActorIndices.Add(Actor, Index);
+
+        MaxRadius = FMath::Max(MaxRadius, Radius);
+        MaxHalfHeight = FMath::Max(MaxHalfHeight, HalfHeight);
+
+        KeyScratch.Emplace(MakeCellKey(GetCell(Location.X, Location.Y)), Index);
+    }
+
+    //----------------------------------------
+    // Sort by cell and record contiguous ranges
+    //----------------------------------------
+    KeyScratch.Sort([] (const TPair<uint64, int32>& A, const TPair<uint64, int32>& B) { return A.Key < B.Key; });
+
+    SortedIndices.Reset(KeyScratch.Num());
+    CellRanges.Reset();
+
+    for (int32 i = 0; i < KeyScratch.Num(); ++i)
+    {
+        SortedIndices.Add(KeyScratch[i].Value);
+
+        if (i == 0 || KeyScratch[i].Key != KeyScratch[i - 1].Key)
+        {
+            CellRanges.Add(KeyScratch[i].Key, FIntPoint(i, 1));
+        }
+        else
+        {
+            CellRanges.FindChecked(KeyScratch[i].Key).Y++;
+        }
+    }
+
+    SET_DWORD_STAT(STAT_MCS_GridCombatants, Actors.Num());
+}
+
+void UMCS_CombatGridSubsystem::GatherCandidates(const FBox& Bounds, TArray<int32>& OutIndices)
+{
+    RebuildIfStale();
+
+    if (Actors.Num() == 0)
+    {
+        return;
+    }
+
+    const FIntPoint MinCell = GetCell(Bounds.Min.X, Bounds.Min.Y);
+    const FIntPoint MaxCell = GetCell(Bounds.Max.X, Bounds.Max.Y);
+    const int64 CellCount = int64(MaxCell.X - MinCell.X + 1) * int64(MaxCell.Y - MinCell.Y + 1);
+
+    // Huge queries are cheaper as a straight scan than as a walk over mostly empty cells
+    if (CellCount > CellRanges.Num())
+    {
+        for (int32 Index = 0; Index < Actors.Num(); ++Index)
+        {
+            OutIndices.Add(Index);
+        }
+        return;
+    }
+
+    for (int32 X = MinCell.X; X <= MaxCell.X; ++X)
+    {
+        for (int32 Y = MinCell.Y; Y <= MaxCell.Y; ++Y)
+        {
+            if (const FIntPoint* Range = CellRanges.Find(MakeCellKey(FIntPoint(X, Y))))
+            {
+                OutIndices.Append(&SortedIndices[Range->X], Range->Y);
+            }
+        }
+    }
+}
+
+SIZE_T UMCS_CombatGridSubsystem::GetAllocatedSize() const
+{
+    return Registered.GetAllocatedSize() + Actors.GetAllocatedSize()
+        + PosX.GetAllocatedSize() + PosY.GetAllocatedSize() + PosZ.GetAllocatedSize()
+        + Radii.GetAllocatedSize() + HalfHeights.GetAllocatedSize() + Teams.GetAllocatedSize()
+        + ActorIndices.GetAllocatedSize() + SortedIndices.GetAllocatedSize() + CellRanges.GetAllocatedSize() + KeyScratch.GetAllocatedSize();
+}
@@ -0,0 +1,511 @@
+/*
+ * ========================================================================
+ * Copyright © 2025 God's Studio
+ * All Rights Reserved.
+ *
+ * Free for all to use, copy, and distribute. I hope you learn from this as I learned creating it.
+ * =============================================================================
+ *
+ * Project: Motion Combat System
+ * This is a combat system inspired by Unreal Engine’s Motion Matching plugin.
+ * Author: Christopher D. Parker
+ * Date: 10-18-2026
+ * =============================================================================
+ * MCS_CombatWorldSubsystem.cpp
+ * Runs the ordered combat phases of a world.
+ */
+
+#include <SubSystems/MCS_CombatWorldSubsystem.h>
+#include <SubSystems/MCS_CombatGridSubsystem.h>
+#include <SubSystems/MCS_CombatBudgetSubsystem.h>
+#include <SubSystems/MCS_EngagementSubsystem.h>
+#include <Components/MCS_CombatHitboxComponent.h>
+#include <Events/MCS_CombatEventBus.h>
+#include <Stats/MCS_Stats.h>
+#include "Engine/World.h"
+#include "Async/ParallelFor.h"
+#include "Algo/StableSort.h"
+
+DECLARE_CYCLE_STAT(TEXT("Phase: Snapshot"), STAT_MCS_PhaseSnapshot, STATGROUP_MotionCombat);
+DECLARE_CYCLE_STAT(TEXT("Phase: Decide"), STAT_MCS_PhaseDecide, STATGROUP_MotionCombat);
+DECLARE_CYCLE_STAT(TEXT("Phase: Sweep"), STAT_MCS_PhaseSweep, STATGROUP_MotionCombat);
+DECLARE_CYCLE_STAT(TEXT("Phase: Resolve Hits"), STAT_MCS_PhaseResolveHits, STATGROUP_MotionCombat);
+DECLARE_CYCLE_STAT(TEXT("Phase: Apply Damage"), STAT_MCS_PhaseApplyDamage, STATGROUP_MotionCombat);
+DECLARE_CYCLE_STAT(TEXT("Phase: Reactions"), STAT_MCS_PhaseReactions, STATGROUP_MotionCombat);
+DECLARE_CYCLE_STAT(TEXT("Phase: Publish Events"), STAT_MCS_PhasePublishEvents, STATGROUP_MotionCombat);
+DECLARE_CYCLE_STAT(TEXT("Build Islands"), STAT_MCS_BuildIslands, STATGROUP_MotionCombat);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Pipeline Hitboxes"), STAT_MCS_PipelineHitboxes, STATGROUP_MotionCombat);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Combat Islands"), STAT_MCS_CombatIslands, STATGROUP_MotionCombat);
+
+bool UMCS_CombatWorldSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+    // Only create for PIE/Game worlds; ignore Editor worlds.
+    const UWorld* World = Cast<UWorld>(Outer);
+    return (World && World->IsGameWorld());
+}
+
+TStatId UMCS_CombatWorldSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UMCS_CombatWorldSubsystem, STATGROUP_Tickables);
+}
+
+UMCS_CombatWorldSubsystem* UMCS_CombatWorldSubsystem::Get(const UObject* WorldContextObject)
+{
+    const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+    return World ? World->GetSubsystem<UMCS_CombatWorldSubsystem>() : nullptr;
+}
+
+void UMCS_CombatWorldSubsystem::Deinitialize()
+{
+    Hitboxes.Reset();
+    ActiveHitboxes.Reset();
+    HitsLanded.Reset();
+    Islands.Reset(0);
+    NodeActors.Reset();
+    HitboxContacts.Reset();
+
+    for (TArray<TUniqueFunction<void()>>& Work : Deferred)
+    {
+        Work.Reset();
+    }
+
+    Super::Deinitialize();
+}
+
+void UMCS_CombatWorldSubsystem::Defer(EMCS_CombatPhase Phase, TUniqueFunction<void()>&& Work)
+{
+    if (!ensure(Phase < EMCS_CombatPhase::MAX) || !Work)
+    {
+        return;
+    }
+
+    Deferred[static_cast<int32>(Phase)].Add(MoveTemp(Work));
+}
+
+void UMCS_CombatWorldSubsystem::RegisterHitbox(UMCS_CombatHitboxComponent* Hitbox)
+{
+    if (IsValid(Hitbox))
+    {
+        LLM_SCOPE_BYTAG(MotionCombat_HitBuffers);
+        Hitboxes.AddUnique(Hitbox);
+    }
+}
+
+void UMCS_CombatWorldSubsystem::RecordHitLanded(AActor* Attacker, AActor* Defender, const FMCS_AttackEntry& Attack)
+{
+    if (bPublishHitLanded)
+    {
+        LLM_SCOPE_BYTAG(MotionCombat_Events);
+        HitsLanded.Add({ Attacker, Defender, Attack });
+    }
+}
+
+void UMCS_CombatWorldSubsystem::Tick(float DeltaTime)
+{
+    Super::Tick(DeltaTime);
+
+    if (GetWorld()->bIsTearingDown)
+    {
+        return;
+    }
+
+    //----------------------------------------
+    // Hitboxes with nothing left to do leave the pipeline
+    //----------------------------------------
+    ActiveHitboxes.Reset();
+    for (const TWeakObjectPtr<UMCS_CombatHitboxComponent>& Weak : Hitboxes)
+    {
+        UMCS_CombatHitboxComponent* Hitbox = Weak.Get();
+        if (Hitbox && IsValid(Hitbox->GetOwner()) && Hitbox->HasActiveWork())
+        {
+            ActiveHitboxes.Add(Hitbox);
+        }
+    }
+
+    if (!bEnabled)
+    {
+        // Hand them back to their own tick
+        for (UMCS_CombatHitboxComponent* Hitbox : ActiveHitboxes)
+        {
+            Hitbox->ReleaseFromPipeline();
+        }
+        ActiveHitboxes.Reset();
+    }
+
+    Hitboxes.Reset();
+    Hitboxes.Append(ActiveHitboxes);
+
+    SET_DWORD_STAT(STAT_MCS_PipelineHitboxes, ActiveHitboxes.Num());
+
+    //----------------------------------------
+    // Phases, in order
+    //----------------------------------------
+    {
+        SCOPE_CYCLE_COUNTER(STAT_MCS_PhaseSnapshot);
+        CurrentPhase = EMCS_CombatPhase::Snapshot;
+        Snapshot();
+        FinishPhase(CurrentPhase, DeltaTime);
+    }
+    {
+        SCOPE_CYCLE_COUNTER(STAT_MCS_PhaseDecide);
+        CurrentPhase = EMCS_CombatPhase::Decide;
+        FinishPhase(CurrentPhase, DeltaTime);
+    }
+    {
+        SCOPE_CYCLE_COUNTER(STAT_MCS_PhaseSweep);
+        CurrentPhase = EMCS_CombatPhase::Sweep;
+        Sweep();
+        FinishPhase(CurrentPhase, DeltaTime);
+    }
+    {
+        SCOPE_CYCLE_COUNTER(STAT_MCS_PhaseResolveHits);
+        CurrentPhase = EMCS_CombatPhase::ResolveHits;
+        ResolveHits(DeltaTime);
+        FinishPhase(CurrentPhase, DeltaTime);
+    }
+    {
+        SCOPE_CYCLE_COUNTER(STAT_MCS_PhaseApplyDamage);
+        CurrentPhase = EMCS_CombatPhase::ApplyDamage;
+        ApplyDamage();
+        FinishPhase(CurrentPhase, DeltaTime);
+    }
+    {
+        SCOPE_CYCLE_COUNTER(STAT_MCS_PhaseReactions);
+        FMCS_BudgetScope BudgetScope(this, EMCS_BudgetCategory::Reactions);
+        CurrentPhase = EMCS_CombatPhase::Reactions;
+        FinishPhase(CurrentPhase, DeltaTime);
+    }
+    {
+        SCOPE_CYCLE_COUNTER(STAT_MCS_PhasePublishEvents);
+        FMCS_BudgetScope BudgetScope(this, EMCS_BudgetCategory::Events);
+        CurrentPhase = EMCS_CombatPhase::PublishEvents;
+        PublishEvents();
+        FinishPhase(CurrentPhase, DeltaTime);
+    }
+
+    CurrentPhase = EMCS_CombatPhase::MAX;
+    ActiveHitboxes.Reset();
+    HitboxOrder.Reset();
+    RunStarts.Reset();
+}
+
+void UMCS_CombatWorldSubsystem::FinishPhase(EMCS_CombatPhase Phase, float DeltaTime)
+{
+    OnPhase.Broadcast(Phase, DeltaTime);
+
+    // Work deferred into this phase while it runs waits for the next frame
+    TArray<TUniqueFunction<void()>> Work = MoveTemp(Deferred[static_cast<int32>(Phase)]);
+    for (TUniqueFunction<void()>& Item : Work)
+    {
+        Item();
+    }
+}
+
+void UMCS_CombatWorldSubsystem::ParallelForEachHitbox(TFunctionRef<void(int32 Index, UMCS_CombatHitboxComponent&)> Body) const
+{
+    // Deferred work of an earlier phase may have destroyed a hitbox this frame
+    auto Visit = [this, &Body] (int32 Index)
+        {
+            if (UMCS_CombatHitboxComponent* Hitbox = ActiveHitboxes[Index]; IsValid(Hitbox))
+            {
+                Body(Index, *Hitbox);
+            }
+        };
+
+    if (bParallel && ActiveHitboxes.Num() >= MinParallelHitboxes)
+    {
+        ParallelFor(ActiveHitboxes.Num(), Visit);
+        return;
+    }
+
+    for (int32 Index = 0; Index < ActiveHitboxes.Num(); ++Index)
+    {
+        Visit(Index);
+    }
+}
+
+int32 UMCS_CombatWorldSubsystem::GetIslandOf(const AActor* Actor) const
+{
+    if (!Actor || Islands.Num() == 0)
+    {
+        return INDEX_NONE;
+    }
+
+    const UMCS_CombatGridSubsystem* Grid = GetWorld()->GetSubsystem<UMCS_CombatGridSubsystem>();
+    int32 Node = Grid && NumGridNodes > 0 ? Grid->FindIndex(Actor) : INDEX_NONE;
+
+    // Owners outside the grid are the few nodes after it
+    for (int32 Extra = NumGridNodes; Node == INDEX_NONE && Extra < NodeActors.Num(); ++Extra)
+    {
+        if (NodeActors[Extra] == Actor)
+        {
+            Node = Extra;
+        }
+    }
+
+    return NodeActors.IsValidIndex(Node) ? Islands.GetIsland(Node) : INDEX_NONE;
+}
+
+void UMCS_CombatWorldSubsystem::BuildIslands(UMCS_CombatGridSubsystem* Grid)
+{
+    SCOPE_CYCLE_COUNTER(STAT_MCS_BuildIslands);
+
+    //----------------------------------------
+    // Nodes: every grid combatant, then hitbox owners the grid doesn't know
+    //----------------------------------------
+    NumGridNodes = Grid ? Grid->Num() : 0;
+
+    NodeActors.Reset();
+    for (int32 Index = 0; Index < NumGridNodes; ++Index)
+    {
+        NodeActors.Add(Grid->GetActor(Index));
+    }
+
+    HitboxNodes.SetNumUninitialized(ActiveHitboxes.Num());
+    for (int32 Index = 0; Index < ActiveHitboxes.Num(); ++Index)
+    {
+        AActor* Owner = ActiveHitboxes[Index]->GetOwner();
+        int32 Node = Grid ? Grid->FindIndex(Owner) : INDEX_NONE;
+
+        for (int32 Extra = NumGridNodes; Node == INDEX_NONE && Extra < NodeActors.Num(); ++Extra)
+        {
+            if (NodeActors[Extra] == Owner)
+            {
+                Node = Extra;
+            }
+        }
+
+        HitboxNodes[Index] = Node != INDEX_NONE ? Node : NodeActors.Add(Owner);
+    }
+
+    //----------------------------------------
+    // Links: what each hitbox can touch, and who engages whom
+    //----------------------------------------
+    Islands.Reset(NodeActors.Num());
+
+    for (int32 Index = 0; Index < ActiveHitboxes.Num(); ++Index)
+    {
+        for (const int32 Contact : HitboxContacts[Index])
+        {
+            Islands.Link(HitboxNodes[Index], Contact);
+        }
+    }
+
+    if (const UMCS_EngagementSubsystem* Engagement = Grid ? GetWorld()->GetSubsystem<UMCS_EngagementSubsystem>() : nullptr)
+    {
+        Engagement->ForEachEngagement([this, Grid] (AActor* Attacker, AActor* Target)
+            {
+                const int32 AttackerNode = Grid->FindIndex(Attacker);
+                const int32 TargetNode = Grid->FindIndex(Target);
+                if (AttackerNode != INDEX_NONE && TargetNode != INDEX_NONE)
+                {
+                    Islands.Link(AttackerNode, TargetNode);
+                }
+            });
+    }
+
+    Islands.Finalize();
+    SET_DWORD_STAT(STAT_MCS_CombatIslands, Islands.Num());
+
+    //----------------------------------------
+    // Hitboxes grouped by island (pipeline order within an island)
+    //----------------------------------------
+    HitboxOrder.SetNumUninitialized(ActiveHitboxes.Num());
+    for (int32 Index = 0; Index < ActiveHitboxes.Num(); ++Index)
+    {
+        HitboxOrder[Index] = Index;
+    }
+
+    Algo::StableSortBy(HitboxOrder, [this] (int32 Index) { return Islands.GetIsland(HitboxNodes[Index]); });
+
+    RunStarts.Reset();
+    for (int32 i = 0; i < HitboxOrder.Num(); ++i)
+    {
+        if (i == 0 || Islands.GetIsland(HitboxNodes[HitboxOrder[i]]) != Islands.GetIsland(HitboxNodes[HitboxOrder[i - 1]]))
+        {
+            RunStarts.Add(i);
+        }
+    }
+    RunStarts.Add(HitboxOrder.Num());
+}
+
+void UMCS_CombatWorldSubsystem::Snapshot()
+{
+    Islands.Reset(0);
+
+    if (ActiveHitboxes.IsEmpty())
+    {
+        return;
+    }
+
+    FMCS_BudgetScope BudgetScope(this, EMCS_BudgetCategory::Sweeps);
+
+    // Rebuilt once here so the reach tests on the workers only read it
+    UMCS_CombatGridSubsystem* Grid = GetWorld()->GetSubsystem<UMCS_CombatGridSubsystem>();
+    if (Grid)
+    {
+        Grid->RebuildIfStale();
+    }
+
+    const UMCS_CombatBudgetSubsystem* Governor = UMCS_CombatBudgetSubsystem::Get(this);
+
+    HitboxContacts.SetNum(ActiveHitboxes.Num());
+    for (TArray<int32>& Contacts : HitboxContacts)
+    {
+        Contacts.Reset();
+    }
+
+    ParallelForEachHitbox([this, Governor, Grid] (int32 Index, UMCS_CombatHitboxComponent& Hitbox)
+        {
+            if (Hitbox.IsDetecting())
+            {
+                const int32 Substeps = Governor ? Governor->GetSubstepCount(Hitbox.SubstepCount) : Hitbox.SubstepCount;
+                Hitbox.PrepareSweep(FMath::Max(Substeps, 1));
+            }
+
+            // Combatants whose collision cylinder overlaps what the hitbox can touch this frame
+            TArray<int32>& Contacts = HitboxContacts[Index];
+            const FBox Bounds = Hitbox.GetFrameBounds();
+            if (!Grid || !Bounds.IsValid)
+            {
+                return;
+            }
+
+            Grid->GatherCandidates(Bounds.ExpandBy(FVector(Grid->GetMaxRadius(), Grid->GetMaxRadius(), Grid->GetMaxHalfHeight())), Contacts);
+
+            const TArray<float>& Radii = Grid->GetRadii();
+            const TArray<float>& HalfHeights = Grid->GetHalfHeights();
+
+            Contacts.RemoveAllSwap([Grid, &Bounds, &Radii, &HalfHeights] (int32 Candidate)
+                {
+                    const FVector Location = Grid->GetLocation(Candidate);
+                    const FVector Extent(Radii[Candidate], Radii[Candidate], HalfHeights[Candidate]);
+                    return !Bounds.Intersect(FBox(Location - Extent, Location + Extent));
+                }, EAllowShrinking::No);
+        });
+
+    BuildIslands(Grid);
+}
+
+void UMCS_CombatWorldSubsystem::Sweep()
+{
+    if (ActiveHitboxes.IsEmpty())
+    {
+        return;
+    }
+
+    FMCS_BudgetScope BudgetScope(this, EMCS_BudgetCategory::Sweeps);
+
+    // Scene queries only read the physics scene; each hitbox writes its own buffers
+    ParallelForEachHitbox([] (int32 Index, UMCS_CombatHitboxComponent& Hitbox)
+        {
+            Hitbox.RunSweepQueries();
+        });
+}
+
+void UMCS_CombatWorldSubsystem::ResolveHits(float DeltaTime)
+{
+    if (ActiveHitboxes.IsEmpty())
+    {
+        return;
+    }
+
+    FMCS_BudgetScope BudgetScope(this, EMCS_BudgetCategory::Sweeps);
+
+    // Sight traces issued last frame (trace results are read on the game thread)
+    for (UMCS_CombatHitboxComponent* Hitbox : ActiveHitboxes)
+    {
+        if (IsValid(Hitbox) && Hitbox->PendingSightChecks.Num() > 0)
+        {
+            Hitbox->ResolveSightChecks();
+        }
+    }
+
+    // Deferred work may have registered combatants since Snapshot; never let a worker rebuild the grid
+    if (UMCS_CombatGridSubsystem* Grid = GetWorld()->GetSubsystem<UMCS_CombatGridSubsystem>())
+    {
+        Grid->RebuildIfStale();
+    }
+
+    // Each island on its own worker: sweep hits, then areas, hitbox by hitbox
+    const int32 NumRuns = RunStarts.Num() - 1;
+    auto ResolveRun = [this, DeltaTime] (int32 Run)
+        {
+            for (int32 i = RunStarts[Run]; i < RunStarts[Run + 1]; ++i)
+            {
+                UMCS_CombatHitboxComponent* Hitbox = ActiveHitboxes[HitboxOrder[i]];
+                if (!IsValid(Hitbox))
+                {
+                    continue;
+                }
+
+                Hitbox->FilterSweepHits();
+
+                if (Hitbox->ActiveAreas.Num() > 0)
+                {
+                    Hitbox->TestAreas(DeltaTime);
+                }
+            }
+        };
+
+    if (bParallel && NumRuns >= MinParallelIslands)
+    {
+        ParallelFor(NumRuns, ResolveRun);
+    }
+    else
+    {
+        for (int32 Run = 0; Run < NumRuns; ++Run)
+        {
+            ResolveRun(Run);
+        }
+    }
+
+    // Merge in island order: new sight traces, debug draws, finished areas
+    for (const int32 Index : HitboxOrder)
+    {
+        if (UMCS_CombatHitboxComponent* Hitbox = ActiveHitboxes[Index]; IsValid(Hitbox))
+        {
+            Hitbox->FinishAreas();
+            Hitbox->DrawSweepDebug();
+        }
+    }
+}
+
+void UMCS_CombatWorldSubsystem::ApplyDamage()
+{
+    // Island order, so damage lands in the same order however the islands were scheduled
+    for (const int32 Index : HitboxOrder)
+    {
+        // Handlers may destroy actors, including the hitboxes still to come
+        if (UMCS_CombatHitboxComponent* Hitbox = ActiveHitboxes[Index]; IsValid(Hitbox))
+        {
+            Hitbox->DispatchPendingHits();
+        }
+    }
+}
+
+void UMCS_CombatWorldSubsystem::PublishEvents()
+{
+    if (HitsLanded.IsEmpty())
+    {
+        return;
+    }
+
+    const TArray<FHitLanded> Hits = MoveTemp(HitsLanded);
+
+    UMCS_CombatEventBus* Bus = UMCS_CombatEventBus::Get(GetWorld());
+    if (!Bus)
+    {
+        return;
+    }
+
+    for (const FHitLanded& Hit : Hits)
+    {
+        AActor* Attacker = Hit.Attacker.Get();
+        AActor* Defender = Hit.Defender.Get();
+        if (Attacker && Defender)
+        {
+            Bus->OnHitLanded.Broadcast(Attacker, Defender, Hit.Attack);
+        }
+    }
+}
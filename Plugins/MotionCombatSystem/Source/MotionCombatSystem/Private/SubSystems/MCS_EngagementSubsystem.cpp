@@ -0,0 +1,359 @@
+/*
+ * ========================================================================
+ * Copyright © 2025 God's Studio
+ * All Rights Reserved.
+ *
+ * Free for all to use, copy, and distribute. I hope you learn from this as I learned creating it.
+ * =============================================================================
+ *
+ * Project: Motion Combat System
+ * This is a combat system inspired by Unreal Engine’s Motion Matching plugin.
+ * Author: Christopher D. Parker
+ * Date: 10-18-2026
+ * =============================================================================
+ * MCS_EngagementSubsystem.cpp
+ * Implementation for the world subsystem that shares engagement slots around targets.
+ */
+
+#include <SubSystems/MCS_EngagementSubsystem.h>
+#include "Engine/World.h"
+#include "TimerManager.h"
+#include "GameFramework/Actor.h"
+#include "NavigationSystem.h"
+#include "NavigationData.h"
+#include "DrawDebugHelpers.h"
+#include <Components/MCS_CombatCoreComponent.h>
+
+bool UMCS_EngagementSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+    // Only create for PIE/Game worlds; ignore Editor worlds.
+    const UWorld* World = Cast<UWorld>(Outer);
+    return (World && World->IsGameWorld());
+}
+
+void UMCS_EngagementSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    RefreshRingRadii();
+}
+
+void UMCS_EngagementSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+    Super::OnWorldBeginPlay(InWorld);
+
+    // The navigation system is created after world subsystems, so bind here rather than in Initialize.
+    if (UNavigationSystemV1* NavSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(&InWorld))
+    {
+        NavSys->OnNavigationGenerationFinishedDelegate.AddDynamic(this, &UMCS_EngagementSubsystem::HandleNavigationGenerationFinished);
+    }
+
+    // Stale entries are swept on a timer, not per query: a swarm requesting slots every frame would pay O(N) each time
+    InWorld.GetTimerManager().SetTimer(PruneTimerHandle, this, &UMCS_EngagementSubsystem::PruneStaleEntries,
+        FMath::Max(StalePruneInterval, 0.1f), true);
+}
+
+void UMCS_EngagementSubsystem::Deinitialize()
+{
+    if (UWorld* World = GetWorld())
+    {
+        World->GetTimerManager().ClearTimer(PruneTimerHandle);
+
+        if (UNavigationSystemV1* NavSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(World))
+        {
+            NavSys->OnNavigationGenerationFinishedDelegate.RemoveDynamic(this, &UMCS_EngagementSubsystem::HandleNavigationGenerationFinished);
+        }
+    }
+
+    Rings.Empty();
+    Assignments.Empty();
+
+    Super::Deinitialize();
+}
+
+bool UMCS_EngagementSubsystem::RequestSlot(AActor* Attacker, AActor* Target, float PreferredRangeStart, float PreferredRangeEnd, FVector& OutLocation)
+{
+    if (!IsValid(Attacker) || !IsValid(Target))
+    {
+        return false;
+    }
+
+    FMCS_EngagementRing* Ring = GetOrBuildRing(Target);
+    if (!Ring)
+    {
+        return false;
+    }
+
+    //----------------------------------------
+    // Keep the current slot if the attacker already holds one on this target
+    //----------------------------------------
+    if (const TPair<TWeakObjectPtr<AActor>, int32>* Existing = Assignments.Find(Attacker))
+    {
+        if (Existing->Key.Get() == Target && Ring->Slots.IsValidIndex(Existing->Value))
+        {
+            const FMCS_EngagementSlot& Slot = Ring->Slots[Existing->Value];
+
+            // Only keep it while it is still reachable after the last re-projection
+            if (Slot.bIsReachable && Slot.Occupant.Get() == Attacker)
+            {
+                OutLocation = Slot.Location;
+                return true;
+            }
+        }
+
+        // Attacker switched target or lost its slot, free the old one
+        ReleaseSlot(Attacker);
+    }
+
+    //----------------------------------------
+    // Reserve a new slot
+    //----------------------------------------
+    const int32 SlotIndex = PickSlot(*Ring, Attacker->GetActorLocation(), PreferredRangeStart, PreferredRangeEnd);
+    if (SlotIndex == INDEX_NONE)
+    {
+        if (bDebug)
+        {
+            UE_LOG(LogTemp, Warning, TEXT("[MCS_EngagementSubsystem] No free slot around %s for %s."), *Target->GetName(), *Attacker->GetName());
+        }
+        return false;
+    }
+
+    FMCS_EngagementSlot& Slot = Ring->Slots[SlotIndex];
+    Slot.Occupant = Attacker;
+    Assignments.Add(Attacker, TPair<TWeakObjectPtr<AActor>, int32>(Target, SlotIndex));
+
+    OutLocation = Slot.Location;
+    return true;
+}
+
+bool UMCS_EngagementSubsystem::RequestSlotForActiveAttackSet(AActor* Attacker, AActor* Target, FVector& OutLocation)
+{
+    if (!IsValid(Attacker))
+    {
+        return false;
+    }
+
+    float RangeStart = 0.f;
+    float RangeEnd = SortedRingRadii.Num() > 0 ? FMath::Min(SortedRingRadii[0], 150.f) : 150.f;
+
+    if (const UMCS_CombatCoreComponent* CombatCore = Attacker->FindComponentByClass<UMCS_CombatCoreComponent>())
+    {
+        CombatCore->GetActiveAttackRange(RangeStart, RangeEnd);
+    }
+
+    return RequestSlot(Attacker, Target, RangeStart, RangeEnd, OutLocation);
+}
+
+void UMCS_EngagementSubsystem::ReleaseSlot(AActor* Attacker)
+{
+    TPair<TWeakObjectPtr<AActor>, int32> Assignment;
+    if (!Assignments.RemoveAndCopyValue(Attacker, Assignment))
+    {
+        return;
+    }
+
+    if (FMCS_EngagementRing* Ring = Rings.Find(Assignment.Key))
+    {
+        if (Ring->Slots.IsValidIndex(Assignment.Value) && Ring->Slots[Assignment.Value].Occupant.Get() == Attacker)
+        {
+            Ring->Slots[Assignment.Value].Occupant.Reset();
+        }
+    }
+}
+
+void UMCS_EngagementSubsystem::RemoveTarget(AActor* Target)
+{
+    Rings.Remove(Target);
+
+    for (auto It = Assignments.CreateIterator(); It; ++It)
+    {
+        if (It->Value.Key.Get() == Target)
+        {
+            It.RemoveCurrent();
+        }
+    }
+}
+
+void UMCS_EngagementSubsystem::InvalidateAllRings()
+{
+    RefreshRingRadii();
+
+    for (TPair<TWeakObjectPtr<AActor>, FMCS_EngagementRing>& Pair : Rings)
+    {
+        Pair.Value.bDirty = true;
+    }
+}
+
+void UMCS_EngagementSubsystem::RefreshRingRadii()
+{
+    // Sorted once here instead of on every rebuild, so the designer's Ring Radii are never rewritten
+    SortedRingRadii = RingRadii;
+    SortedRingRadii.Sort();
+}
+
+#if WITH_EDITOR
+void UMCS_EngagementSubsystem::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+    Super::PostEditChangeProperty(PropertyChangedEvent);
+
+    if (PropertyChangedEvent.GetMemberPropertyName() == GET_MEMBER_NAME_CHECKED(UMCS_EngagementSubsystem, RingRadii))
+    {
+        InvalidateAllRings();
+    }
+}
+#endif
+
+void UMCS_EngagementSubsystem::ForEachEngagement(TFunctionRef<void(AActor* Attacker, AActor* Target)> Visit) const
+{
+    for (const TPair<TWeakObjectPtr<AActor>, TPair<TWeakObjectPtr<AActor>, int32>>& Pair : Assignments)
+    {
+        AActor* Attacker = Pair.Key.Get();
+        AActor* Target = Pair.Value.Key.Get();
+        if (Attacker && Target)
+        {
+            Visit(Attacker, Target);
+        }
+    }
+}
+
+void UMCS_EngagementSubsystem::HandleNavigationGenerationFinished(ANavigationData* NavData)
+{
+    // Navmesh tiles changed; cached projections may now be off-mesh or newly reachable
+    InvalidateAllRings();
+
+    if (bDebug)
+    {
+        UE_LOG(LogTemp, Log, TEXT("[MCS_EngagementSubsystem] Navmesh rebuilt, invalidated %d rings."), Rings.Num());
+    }
+}
+
+FMCS_EngagementRing* UMCS_EngagementSubsystem::GetOrBuildRing(AActor* Target)
+{
+    UWorld* World = GetWorld();
+    if (!World || SortedRingRadii.IsEmpty())
+    {
+        return nullptr;
+    }
+
+    const FVector TargetLocation = Target->GetActorLocation();
+    FMCS_EngagementRing& Ring = Rings.FindOrAdd(Target);
+
+    const int32 NumSlots = SortedRingRadii.Num() * FMath::Max(SlotsPerRing, 1);
+    const bool bMoved = FVector::DistSquared2D(Ring.Origin, TargetLocation) > FMath::Square(RebuildDistanceThreshold);
+
+    if (!Ring.bDirty && !bMoved && Ring.Slots.Num() == NumSlots)
+    {
+        return &Ring;
+    }
+
+    //----------------------------------------
+    // (Re)generate slots. Occupants are kept by index so attackers hold their angle around the target.
+    //----------------------------------------
+    TArray<TWeakObjectPtr<AActor>> PreviousOccupants;
+    if (Ring.Slots.Num() == NumSlots)
+    {
+        PreviousOccupants.Reserve(NumSlots);
+        for (const FMCS_EngagementSlot& Slot : Ring.Slots)
+        {
+            PreviousOccupants.Add(Slot.Occupant);
+        }
+    }
+
+    Ring.Origin = TargetLocation;
+    Ring.Slots.SetNum(NumSlots);
+    Ring.bDirty = false;
+
+    UNavigationSystemV1* NavSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(World);
+    const int32 PerRing = FMath::Max(SlotsPerRing, 1);
+
+    for (int32 RingIdx = 0; RingIdx < SortedRingRadii.Num(); ++RingIdx)
+    {
+        // Offset every other ring by half a step so slots on neighbouring rings don't line up
+        const float AngleOffset = (RingIdx % 2) * (PI / PerRing);
+
+        for (int32 i = 0; i < PerRing; ++i)
+        {
+            const int32 SlotIndex = RingIdx * PerRing + i;
+            const float Angle = AngleOffset + (2.f * PI * i) / PerRing;
+            const FVector Desired = TargetLocation + FVector(FMath::Cos(Angle), FMath::Sin(Angle), 0.f) * SortedRingRadii[RingIdx];
+
+            FMCS_EngagementSlot& Slot = Ring.Slots[SlotIndex];
+            Slot.RingIndex = RingIdx;
+            Slot.Occupant = PreviousOccupants.IsValidIndex(SlotIndex) ? PreviousOccupants[SlotIndex] : nullptr;
+
+            FNavLocation NavLocation;
+            Slot.bIsReachable = NavSys && NavSys->ProjectPointToNavigation(Desired, NavLocation, ProjectionExtent);
+            Slot.Location = Slot.bIsReachable ? NavLocation.Location : Desired;
+
+            // Unreachable slots can't be held
+            if (!Slot.bIsReachable)
+            {
+                Slot.Occupant.Reset();
+            }
+        }
+    }
+
+#if WITH_EDITORONLY_DATA || UE_BUILD_DEVELOPMENT
+    if (bDebug)
+    {
+        for (const FMCS_EngagementSlot& Slot : Ring.Slots)
+        {
+            DrawDebugSphere(World, Slot.Location, 20.f, 8, Slot.bIsReachable ? FColor::Green : FColor::Red, false, 1.0f);
+        }
+    }
+#endif
+
+    return &Ring;
+}
+
+int32 UMCS_EngagementSubsystem::PickSlot(const FMCS_EngagementRing& Ring, const FVector& AttackerLocation, float RangeStart, float RangeEnd) const
+{
+    const float PreferredRadius = (RangeStart + RangeEnd) * 0.5f;
+
+    int32 BestIndex = INDEX_NONE;
+    float BestCost = TNumericLimits<float>::Max();
+
+    for (int32 i = 0; i < Ring.Slots.Num(); ++i)
+    {
+        const FMCS_EngagementSlot& Slot = Ring.Slots[i];
+        if (!Slot.bIsReachable || Slot.Occupant.IsValid())
+        {
+            continue;
+        }
+
+        const float Radius = SortedRingRadii[Slot.RingIndex];
+
+        // Rings inside the window are preferred; rings outside it pay a heavy penalty so they are only a fallback
+        const bool bInWindow = Radius >= RangeStart && Radius <= RangeEnd;
+        const float RadiusCost = FMath::Abs(Radius - PreferredRadius) * (bInWindow ? 1.f : 10.f);
+        const float TravelCost = FVector::Dist2D(AttackerLocation, Slot.Location);
+
+        const float Cost = RadiusCost + TravelCost;
+        if (Cost < BestCost)
+        {
+            BestCost = Cost;
+            BestIndex = i;
+        }
+    }
+
+    return BestIndex;
+}
+
+void UMCS_EngagementSubsystem::PruneStaleEntries()
+{
+    for (auto It = Rings.CreateIterator(); It; ++It)
+    {
+        if (!It->Key.IsValid())
+        {
+            It.RemoveCurrent();
+        }
+    }
+
+    for (auto It = Assignments.CreateIterator(); It; ++It)
+    {
+        if (!It->Key.IsValid() || !It->Value.Key.IsValid())
+        {
+            It.RemoveCurrent();
+        }
+    }
+}
@@ -0,0 +1,206 @@
+/*
+ * ========================================================================
+ * Copyright © 2025 God's Studio
+ * All Rights Reserved.
+ *
+ * Free for all to use, copy, and distribute. I hope you learn from this as I learned creating it.
+ * =============================================================================
+ *
+ * Project: Motion Combat System
+ * This is a combat system inspired by Unreal Engine’s Motion Matching plugin.
+ * Author: Christopher D. Parker
+ * Date: 10-18-2026
+ * =============================================================================
+ * MCS_HitConfirmSubsystem.cpp
+ * Batches the server's confirmed hits per frame and connection.
+ */
+
+#include <SubSystems/MCS_HitConfirmSubsystem.h>
+#include <SubSystems/MCS_CombatWorldSubsystem.h>
+#include <Components/MCS_HitConfirmComponent.h>
+#include <Components/MCS_CombatHitboxComponent.h>
+#include <Stats/MCS_Stats.h>
+#include "Engine/World.h"
+#include "Engine/NetConnection.h"
+#include "GameFramework/PlayerController.h"
+
+DECLARE_CYCLE_STAT(TEXT("Hit Confirm Flush"), STAT_MCS_HitConfirmFlush, STATGROUP_MotionCombat);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Hit Confirm Batches"), STAT_MCS_HitConfirmBatches, STATGROUP_MotionCombat);
+
+bool UMCS_HitConfirmSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+    // Only create for PIE/Game worlds; ignore Editor worlds.
+    const UWorld* World = Cast<UWorld>(Outer);
+    return (World && World->IsGameWorld());
+}
+
+TStatId UMCS_HitConfirmSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UMCS_HitConfirmSubsystem, STATGROUP_Tickables);
+}
+
+UMCS_HitConfirmSubsystem* UMCS_HitConfirmSubsystem::Get(const UObject* WorldContextObject)
+{
+    const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+    return World ? World->GetSubsystem<UMCS_HitConfirmSubsystem>() : nullptr;
+}
+
+void UMCS_HitConfirmSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    if (UMCS_CombatWorldSubsystem* Pipeline = Collection.InitializeDependency<UMCS_CombatWorldSubsystem>())
+    {
+        PhaseHandle = Pipeline->OnPhase.AddUObject(this, &UMCS_HitConfirmSubsystem::HandlePhase);
+    }
+}
+
+void UMCS_HitConfirmSubsystem::Deinitialize()
+{
+    if (UMCS_CombatWorldSubsystem* Pipeline = UMCS_CombatWorldSubsystem::Get(this))
+    {
+        Pipeline->OnPhase.Remove(PhaseHandle);
+    }
+    PhaseHandle.Reset();
+
+    Pending.Reset();
+    Receivers.Reset();
+    Batch.Reset();
+
+    Super::Deinitialize();
+}
+
+void UMCS_HitConfirmSubsystem::Tick(float DeltaTime)
+{
+    // Hits confirmed outside the pipeline (or after its Publish Events phase)
+    Flush();
+}
+
+void UMCS_HitConfirmSubsystem::HandlePhase(EMCS_CombatPhase Phase, float DeltaTime)
+{
+    if (Phase == EMCS_CombatPhase::PublishEvents)
+    {
+        Flush();
+    }
+}
+
+void UMCS_HitConfirmSubsystem::RegisterReceiver(UMCS_HitConfirmComponent* Receiver)
+{
+    if (IsValid(Receiver))
+    {
+        Receivers.AddUnique(Receiver);
+    }
+}
+
+void UMCS_HitConfirmSubsystem::UnregisterReceiver(UMCS_HitConfirmComponent* Receiver)
+{
+    Receivers.Remove(Receiver);
+}
+
+/*
+ * Queues a hit for the next flush. Nothing is kept without a remote connection to send it to.
+ */
+void UMCS_HitConfirmSubsystem::ConfirmHit(const FHitResult& Hit, AActor* Attacker, AActor* Victim, const FMCS_AttackEntry& Attack, EMCS_HitReactionLevel Level)
+{
+    if (!bEnabled || Receivers.IsEmpty() || !IsValid(Victim))
+    {
+        return;
+    }
+
+    FPendingConfirm& Confirm = Pending.AddDefaulted_GetRef();
+    Confirm.Attacker = Attacker;
+    Confirm.Victim = Victim;
+    Confirm.AttackName = Attack.AttackName;
+    Confirm.ImpactPoint = Hit.ImpactPoint;
+    Confirm.BoneName = Hit.BoneName;
+    Confirm.Severity = Attack.HitSeverity;
+    Confirm.Level = Level;
+
+    // An autonomous proxy whose hitbox detects (see its Net Execution) has seen this hit already
+    if (IsValid(Attacker) && Attacker->GetRemoteRole() == ROLE_AutonomousProxy)
+    {
+        const UMCS_CombatHitboxComponent* Hitbox = Attacker->FindComponentByClass<UMCS_CombatHitboxComponent>();
+        if (Hitbox && (Hitbox->NetExecution & static_cast<int32>(EMCS_NetRoleFlags::AutonomousProxy)))
+        {
+            Confirm.PredictingConnection = Attacker->GetNetConnection();
+        }
+    }
+}
+
+/*
+ * Sends every queued hit to each registered connection whose view the victim is relevant to,
+ * as few batches as Max Hits Per Batch allows (one for most frames).
+ */
+void UMCS_HitConfirmSubsystem::Flush()
+{
+    if (Pending.IsEmpty())
+    {
+        SET_DWORD_STAT(STAT_MCS_HitConfirmBatches, 0);
+        return;
+    }
+
+    SCOPE_CYCLE_COUNTER(STAT_MCS_HitConfirmFlush);
+
+    const int32 BatchLimit = FMath::Clamp(MaxHitsPerBatch, 1, FMCS_HitConfirmBatch::MaxEntries / 2);
+    int32 NumBatches = 0;
+
+    Receivers.RemoveAll([](const TWeakObjectPtr<UMCS_HitConfirmComponent>& Receiver) { return !Receiver.IsValid(); });
+
+    for (const TWeakObjectPtr<UMCS_HitConfirmComponent>& WeakReceiver : Receivers)
+    {
+        UMCS_HitConfirmComponent* Receiver = WeakReceiver.Get();
+        APlayerController* Controller = Cast<APlayerController>(Receiver->GetOwner());
+        UNetConnection* Connection = Controller ? Controller->GetNetConnection() : nullptr;
+        if (!Connection)
+        {
+            continue;
+        }
+
+        // The same view the net driver uses for this connection's relevancy
+        FVector ViewLocation;
+        FRotator ViewRotation;
+        Controller->GetPlayerViewPoint(ViewLocation, ViewRotation);
+        const AActor* ViewTarget = Controller->GetViewTarget();
+
+        Batch.Reset();
+
+        for (const FPendingConfirm& Confirm : Pending)
+        {
+            AActor* Victim = Confirm.Victim.Get();
+            if (!IsValid(Victim))
+            {
+                continue;
+            }
+
+            if (bSkipPredictingClient && Confirm.PredictingConnection.Get() == Connection)
+            {
+                continue;
+            }
+
+            if (!Victim->IsNetRelevantFor(Controller, ViewTarget, ViewLocation))
+            {
+                continue;
+            }
+
+            Batch.Add(Confirm.Attacker.Get(), Victim, Confirm.AttackName, Confirm.ImpactPoint, Confirm.BoneName, Confirm.Severity, Confirm.Level);
+
+            if (Batch.Num() >= BatchLimit)
+            {
+                Receiver->ClientReceiveHitConfirms(Batch);
+                Batch.Reset();
+                ++NumBatches;
+            }
+        }
+
+        if (Batch.Num() > 0)
+        {
+            Receiver->ClientReceiveHitConfirms(Batch);
+            ++NumBatches;
+        }
+    }
+
+    Batch.Reset();
+    Pending.Reset();
+
+    SET_DWORD_STAT(STAT_MCS_HitConfirmBatches, NumBatches);
+}
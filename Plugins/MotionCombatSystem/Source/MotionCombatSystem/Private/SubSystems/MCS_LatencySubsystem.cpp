@@ -0,0 +1,360 @@
+/*
+ * ========================================================================
+ * Copyright © 2025 God's Studio
+ * All Rights Reserved.
+ *
+ * Free for all to use, copy, and distribute. I hope you learn from this as I learned creating it.
+ * =============================================================================
+ *
+ * Project: Motion Combat System
+ * This is a combat system inspired by Unreal Engine’s Motion Matching plugin.
+ * Author: Christopher D. Parker
+ * Date: 10-18-2026
+ * =============================================================================
+ * MCS_LatencySubsystem.cpp
+ * Implementation of the combat input latency tracker.
+ */
+
+#include <SubSystems/MCS_LatencySubsystem.h>
+#include <Stats/MCS_Stats.h>
+#include "Engine/World.h"
+#include "Engine/Engine.h"
+#include "Animation/AnimInstance.h"
+#include "Animation/AnimMontage.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/DateTime.h"
+
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Input->Dispatch p50 (ms)"), STAT_MCS_Latency_Dispatch_P50, STATGROUP_MotionCombat);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Input->Dispatch p95 (ms)"), STAT_MCS_Latency_Dispatch_P95, STATGROUP_MotionCombat);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Input->Dispatch p99 (ms)"), STAT_MCS_Latency_Dispatch_P99, STATGROUP_MotionCombat);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Input->Dispatch p50 (frames)"), STAT_MCS_Latency_Dispatch_P50_Frames, STATGROUP_MotionCombat);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Input->Dispatch p95 (frames)"), STAT_MCS_Latency_Dispatch_P95_Frames, STATGROUP_MotionCombat);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Input->Dispatch p99 (frames)"), STAT_MCS_Latency_Dispatch_P99_Frames, STATGROUP_MotionCombat);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Input->Pose p50 (ms)"), STAT_MCS_Latency_Pose_P50, STATGROUP_MotionCombat);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Input->Pose p95 (ms)"), STAT_MCS_Latency_Pose_P95, STATGROUP_MotionCombat);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Input->Pose p99 (ms)"), STAT_MCS_Latency_Pose_P99, STATGROUP_MotionCombat);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Input->Pose p50 (frames)"), STAT_MCS_Latency_Pose_P50_Frames, STATGROUP_MotionCombat);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Input->Pose p95 (frames)"), STAT_MCS_Latency_Pose_P95_Frames, STATGROUP_MotionCombat);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Input->Pose p99 (frames)"), STAT_MCS_Latency_Pose_P99_Frames, STATGROUP_MotionCombat);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Input->Hitbox p50 (ms)"), STAT_MCS_Latency_Hitbox_P50, STATGROUP_MotionCombat);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Input->Hitbox p95 (ms)"), STAT_MCS_Latency_Hitbox_P95, STATGROUP_MotionCombat);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Input->Hitbox p99 (ms)"), STAT_MCS_Latency_Hitbox_P99, STATGROUP_MotionCombat);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Input->Hitbox p50 (frames)"), STAT_MCS_Latency_Hitbox_P50_Frames, STATGROUP_MotionCombat);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Input->Hitbox p95 (frames)"), STAT_MCS_Latency_Hitbox_P95_Frames, STATGROUP_MotionCombat);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Input->Hitbox p99 (frames)"), STAT_MCS_Latency_Hitbox_P99_Frames, STATGROUP_MotionCombat);
+
+namespace MCS_Latency
+{
+    static const TCHAR* StageNames[] = { TEXT("Dispatch"), TEXT("Pose"), TEXT("Hitbox") };
+    static const float Percentiles[] = { 0.5f, 0.95f, 0.99f };
+
+    static float ComputePercentile(const TArray<float>& Values, float Percentile)
+    {
+        if (Values.IsEmpty())
+        {
+            return 0.f;
+        }
+
+        TArray<float> Sorted = Values;
+        Sorted.Sort();
+
+        const int32 Index = FMath::Clamp(FMath::CeilToInt(Percentile * Sorted.Num()) - 1, 0, Sorted.Num() - 1);
+        return Sorted[Index];
+    }
+
+    static FAutoConsoleCommandWithWorld LatencyReportCommand(
+        TEXT("mcs.LatencyReport"),
+        TEXT("Logs Motion Combat input latency percentiles and writes the raw samples to Saved/Profiling/MotionCombat."),
+        FConsoleCommandWithWorldDelegate::CreateLambda([] (UWorld* World)
+            {
+                if (UMCS_LatencySubsystem* Latency = UMCS_LatencySubsystem::Get(World))
+                {
+                    Latency->WriteReport();
+                }
+            }));
+}
+
+bool UMCS_LatencySubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+    // Only create for PIE/Game worlds; ignore Editor worlds.
+    const UWorld* World = Cast<UWorld>(Outer);
+    return (World && World->IsGameWorld());
+}
+
+UMCS_LatencySubsystem* UMCS_LatencySubsystem::Get(const UObject* WorldContext)
+{
+    const UWorld* World = WorldContext ? WorldContext->GetWorld() : nullptr;
+    return World ? World->GetSubsystem<UMCS_LatencySubsystem>() : nullptr;
+}
+
+TStatId UMCS_LatencySubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UMCS_LatencySubsystem, STATGROUP_Tickables);
+}
+
+void UMCS_LatencySubsystem::MarkInput(AActor* Combatant)
+{
+    if (!Combatant)
+    {
+        return;
+    }
+
+    LLM_SCOPE_BYTAG(MotionCombat_Traces);
+
+    FPendingSample& Sample = Pending.FindOrAdd(Combatant);
+    Sample = FPendingSample();
+    Sample.InputTime = FPlatformTime::Seconds();
+    Sample.InputFrame = GFrameCounter;
+}
+
+SIZE_T UMCS_LatencySubsystem::GetAllocatedSize() const
+{
+    SIZE_T Size = Pending.GetAllocatedSize();
+    for (const FStageWindow& Window : Windows)
+    {
+        Size += Window.Ms.GetAllocatedSize() + Window.Frames.GetAllocatedSize();
+    }
+    return Size;
+}
+
+void UMCS_LatencySubsystem::MarkDispatch(const AActor* Combatant)
+{
+    if (FPendingSample* Sample = Pending.Find(Combatant))
+    {
+        RecordStage(*Sample, EMCS_LatencyStage::Dispatch);
+    }
+}
+
+void UMCS_LatencySubsystem::MarkMontageStarted(const AActor* Combatant, UAnimInstance* AnimInstance, UAnimMontage* Montage)
+{
+    if (FPendingSample* Sample = Pending.Find(Combatant))
+    {
+        if (!Sample->bHasStage[(int32)EMCS_LatencyStage::Pose])
+        {
+            Sample->AnimInstance = AnimInstance;
+            Sample->Montage = Montage;
+        }
+    }
+}
+
+void UMCS_LatencySubsystem::MarkHitboxActive(const AActor* Combatant)
+{
+    if (FPendingSample* Sample = Pending.Find(Combatant))
+    {
+        RecordStage(*Sample, EMCS_LatencyStage::Hitbox);
+
+        // Hitbox is the last stage, the sample is complete
+        Pending.Remove(Combatant);
+    }
+}
+
+void UMCS_LatencySubsystem::RecordStage(FPendingSample& Sample, EMCS_LatencyStage Stage)
+{
+    const int32 StageIndex = (int32)Stage;
+    if (Sample.bHasStage[StageIndex])
+    {
+        return;
+    }
+
+    Sample.bHasStage[StageIndex] = true;
+
+    const float Ms = static_cast<float>((FPlatformTime::Seconds() - Sample.InputTime) * 1000.0);
+    const float Frames = static_cast<float>(GFrameCounter - Sample.InputFrame);
+
+    FStageWindow& Window = Windows[StageIndex];
+    const int32 Capacity = FMath::Max(WindowSize, 16);
+
+    if (Window.Ms.Num() < Capacity)
+    {
+        LLM_SCOPE_BYTAG(MotionCombat_Traces);
+        Window.Ms.Add(Ms);
+        Window.Frames.Add(Frames);
+    }
+    else
+    {
+        Window.Ms[Window.Next] = Ms;
+        Window.Frames[Window.Next] = Frames;
+    }
+    Window.Next = (Window.Next + 1) % Capacity;
+
+    switch (Stage)
+    {
+        case EMCS_LatencyStage::Dispatch:
+            CSV_CUSTOM_STAT(MotionCombat, LatencyDispatchMs, Ms, ECsvCustomStatOp::Max);
+            CSV_CUSTOM_STAT(MotionCombat, LatencyDispatchFrames, Frames, ECsvCustomStatOp::Max);
+            break;
+        case EMCS_LatencyStage::Pose:
+            CSV_CUSTOM_STAT(MotionCombat, LatencyPoseMs, Ms, ECsvCustomStatOp::Max);
+            CSV_CUSTOM_STAT(MotionCombat, LatencyPoseFrames, Frames, ECsvCustomStatOp::Max);
+            break;
+        case EMCS_LatencyStage::Hitbox:
+            CSV_CUSTOM_STAT(MotionCombat, LatencyHitboxMs, Ms, ECsvCustomStatOp::Max);
+            CSV_CUSTOM_STAT(MotionCombat, LatencyHitboxFrames, Frames, ECsvCustomStatOp::Max);
+            break;
+        default: break;
+    }
+}
+
+void UMCS_LatencySubsystem::Tick(float DeltaTime)
+{
+    Super::Tick(DeltaTime);
+
+    //----------------------------------------
+    // Stamp the first frame each watched montage contributes to the pose.
+    // Tickables run after actor/anim ticks, so a non-zero weight here means it was blended in this frame.
+    //----------------------------------------
+    const double Now = FPlatformTime::Seconds();
+
+    for (auto It = Pending.CreateIterator(); It; ++It)
+    {
+        FPendingSample& Sample = It->Value;
+
+        if (!It->Key.IsValid() || Now - Sample.InputTime > SampleTimeout)
+        {
+            It.RemoveCurrent();
+            continue;
+        }
+
+        if (!Sample.bHasStage[(int32)EMCS_LatencyStage::Pose] && Sample.AnimInstance.IsValid() && Sample.Montage.IsValid())
+        {
+            if (Sample.AnimInstance->Montage_GetWeight(Sample.Montage.Get()) > 0.f)
+            {
+                RecordStage(Sample, EMCS_LatencyStage::Pose);
+            }
+        }
+    }
+
+    // Percentiles sort the window, so only refresh the stat readout a few times per second
+    if (++FramesSincePublish >= 15)
+    {
+        FramesSincePublish = 0;
+        PublishStats();
+    }
+
+    WriteCsvStats();
+}
+
+bool UMCS_LatencySubsystem::GetPercentile(EMCS_LatencyStage Stage, float Percentile, float& OutMs, float& OutFrames) const
+{
+    if (Stage >= EMCS_LatencyStage::MAX)
+    {
+        return false;
+    }
+
+    const FStageWindow& Window = Windows[(int32)Stage];
+    if (Window.Ms.IsEmpty())
+    {
+        return false;
+    }
+
+    OutMs = MCS_Latency::ComputePercentile(Window.Ms, Percentile);
+    OutFrames = MCS_Latency::ComputePercentile(Window.Frames, Percentile);
+    return true;
+}
+
+void UMCS_LatencySubsystem::PublishStats()
+{
+    for (int32 StageIndex = 0; StageIndex < (int32)EMCS_LatencyStage::MAX; ++StageIndex)
+    {
+        for (int32 i = 0; i < 3; ++i)
+        {
+            FPublishedPercentile& Published = PublishedPercentiles[StageIndex][i];
+            Published.bValid = GetPercentile((EMCS_LatencyStage)StageIndex, MCS_Latency::Percentiles[i], Published.Ms, Published.Frames);
+        }
+    }
+
+#if STATS
+#define MCS_SET_LATENCY_STATS(StageName, Pct, Index) \
+    if (const FPublishedPercentile& P = PublishedPercentiles[(int32)EMCS_LatencyStage::StageName][Index]; P.bValid) \
+    { \
+        SET_FLOAT_STAT(STAT_MCS_Latency_##StageName##_P##Pct, P.Ms); \
+        SET_FLOAT_STAT(STAT_MCS_Latency_##StageName##_P##Pct##_Frames, P.Frames); \
+    }
+
+    MCS_SET_LATENCY_STATS(Dispatch, 50, 0) MCS_SET_LATENCY_STATS(Dispatch, 95, 1) MCS_SET_LATENCY_STATS(Dispatch, 99, 2)
+    MCS_SET_LATENCY_STATS(Pose, 50, 0)     MCS_SET_LATENCY_STATS(Pose, 95, 1)     MCS_SET_LATENCY_STATS(Pose, 99, 2)
+    MCS_SET_LATENCY_STATS(Hitbox, 50, 0)   MCS_SET_LATENCY_STATS(Hitbox, 95, 1)   MCS_SET_LATENCY_STATS(Hitbox, 99, 2)
+
+#undef MCS_SET_LATENCY_STATS
+#endif
+}
+
+void UMCS_LatencySubsystem::WriteCsvStats() const
+{
+#if CSV_PROFILER
+    // Every frame, so the percentile columns stay continuous between refreshes
+#define MCS_CSV_LATENCY_STATS(StageName, Pct, Index) \
+    if (const FPublishedPercentile& P = PublishedPercentiles[(int32)EMCS_LatencyStage::StageName][Index]; P.bValid) \
+    { \
+        CSV_CUSTOM_STAT(MotionCombat, Latency##StageName##P##Pct##Ms, P.Ms, ECsvCustomStatOp::Set); \
+        CSV_CUSTOM_STAT(MotionCombat, Latency##StageName##P##Pct##Frames, P.Frames, ECsvCustomStatOp::Set); \
+    }
+
+    MCS_CSV_LATENCY_STATS(Dispatch, 50, 0) MCS_CSV_LATENCY_STATS(Dispatch, 95, 1) MCS_CSV_LATENCY_STATS(Dispatch, 99, 2)
+    MCS_CSV_LATENCY_STATS(Pose, 50, 0)     MCS_CSV_LATENCY_STATS(Pose, 95, 1)     MCS_CSV_LATENCY_STATS(Pose, 99, 2)
+    MCS_CSV_LATENCY_STATS(Hitbox, 50, 0)   MCS_CSV_LATENCY_STATS(Hitbox, 95, 1)   MCS_CSV_LATENCY_STATS(Hitbox, 99, 2)
+
+#undef MCS_CSV_LATENCY_STATS
+#endif
+}
+
+void UMCS_LatencySubsystem::WriteReport() const
+{
+    //----------------------------------------
+    // Percentile table to the log
+    //----------------------------------------
+    UE_LOG(LogTemp, Log, TEXT("[MCS_Latency] Stage      | Samples | p50 ms (fr) | p95 ms (fr) | p99 ms (fr)"));
+
+    for (int32 StageIndex = 0; StageIndex < (int32)EMCS_LatencyStage::MAX; ++StageIndex)
+    {
+        const EMCS_LatencyStage Stage = (EMCS_LatencyStage)StageIndex;
+        float P50 = 0.f, P95 = 0.f, P99 = 0.f, F50 = 0.f, F95 = 0.f, F99 = 0.f;
+        GetPercentile(Stage, 0.5f, P50, F50);
+        GetPercentile(Stage, 0.95f, P95, F95);
+        GetPercentile(Stage, 0.99f, P99, F99);
+
+        UE_LOG(LogTemp, Log, TEXT("[MCS_Latency] %-10s | %7d | %6.1f (%2.0f) | %6.1f (%2.0f) | %6.1f (%2.0f)"),
+            MCS_Latency::StageNames[StageIndex], Windows[StageIndex].Ms.Num(), P50, F50, P95, F95, P99, F99);
+    }
+
+    //----------------------------------------
+    // Raw samples to CSV
+    //----------------------------------------
+    FString Csv = TEXT("Stage,Ms,Frames\n");
+    for (int32 StageIndex = 0; StageIndex < (int32)EMCS_LatencyStage::MAX; ++StageIndex)
+    {
+        const FStageWindow& Window = Windows[StageIndex];
+        for (int32 i = 0; i < Window.Ms.Num(); ++i)
+        {
+            Csv += FString::Printf(TEXT("%s,%.3f,%.0f\n"), MCS_Latency::StageNames[StageIndex], Window.Ms[i], Window.Frames[i]);
+        }
+    }
+
+    const FString FilePath = FPaths::Combine(FPaths::ProfilingDir(), TEXT("MotionCombat"),
+        FString::Printf(TEXT("Latency_%s.csv"), *FDateTime::Now().ToString()));
+
+    if (FFileHelper::SaveStringToFile(Csv, *FilePath))
+    {
+        UE_LOG(LogTemp, Log, TEXT("[MCS_Latency] Wrote samples to %s"), *FilePath);
+    }
+}
+
+void UMCS_LatencySubsystem::ResetSamples()
+{
+    Pending.Reset();
+    for (FStageWindow& Window : Windows)
+    {
+        Window = FStageWindow();
+    }
+
+    for (auto& StagePercentiles : PublishedPercentiles)
+    {
+        for (FPublishedPercentile& Published : StagePercentiles)
+        {
+            Published = FPublishedPercentile();
+        }
+    }
+}
@@ -0,0 +1,395 @@
+/*
+ * ========================================================================
+ * Copyright © 2025 God's Studio
+ * All Rights Reserved.
+ *
+ * Free for all to use, copy, and distribute. I hope you learn from this as I learned creating it.
+ * =============================================================================
+ *
+ * Project: Motion Combat System
+ * This is a combat system inspired by Unreal Engine’s Motion Matching plugin.
+ * Author: Christopher D. Parker
+ * Date: 10-18-2026
+ * =============================================================================
+ * MCS_NavQuerySubsystem.cpp
+ * Implementation for the subsystem that batches and caches random-location navigation queries.
+ */
+
+#include <SubSystems/MCS_NavQuerySubsystem.h>
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "NavigationSystem.h"
+#include "NavigationData.h"
+#include "NavFilters/NavigationQueryFilter.h"
+
+bool UMCS_NavQuerySubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+    // Only create for PIE/Game worlds; ignore Editor worlds.
+    const UWorld* World = Cast<UWorld>(Outer);
+    return (World && World->IsGameWorld());
+}
+
+void UMCS_NavQuerySubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+    Super::OnWorldBeginPlay(InWorld);
+
+    if (UNavigationSystemV1* NavSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(&InWorld))
+    {
+        NavSys->OnNavigationGenerationFinishedDelegate.AddDynamic(this, &UMCS_NavQuerySubsystem::HandleNavigationGenerationFinished);
+    }
+}
+
+void UMCS_NavQuerySubsystem::Deinitialize()
+{
+    if (UWorld* World = GetWorld())
+    {
+        if (UNavigationSystemV1* NavSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(World))
+        {
+            NavSys->OnNavigationGenerationFinishedDelegate.RemoveDynamic(this, &UMCS_NavQuerySubsystem::HandleNavigationGenerationFinished);
+        }
+    }
+
+    Regions.Empty();
+    RegionFillQueue.Empty();
+    Queries.Empty();
+    SubmitQueue.Empty();
+
+    Super::Deinitialize();
+}
+
+TStatId UMCS_NavQuerySubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UMCS_NavQuerySubsystem, STATGROUP_Tickables);
+}
+
+FIntVector UMCS_NavQuerySubsystem::GetRegionKey(const FVector& Location) const
+{
+    const float Size = FMath::Max(RegionSize, 100.f);
+    return FIntVector(
+        FMath::FloorToInt(Location.X / Size),
+        FMath::FloorToInt(Location.Y / Size),
+        FMath::FloorToInt(Location.Z / Size));
+}
+
+int32 UMCS_NavQuerySubsystem::SubmitRandomLocationQuery(AActor* Querier, const FVector& Origin, float Radius)
+{
+    if (!IsValid(Querier) || Radius <= 0.f)
+    {
+        return 0;
+    }
+
+    const int32 Handle = NextHandle++;
+    if (NextHandle <= 0)
+    {
+        NextHandle = 1;
+    }
+
+    FPendingQuery& Query = Queries.Add(Handle);
+    Query.Querier = Querier;
+    Query.Origin = Origin;
+    Query.Radius = Radius;
+    AddQueryRegions(Query);
+
+    SubmitQueue.Add(Handle);
+    return Handle;
+}
+
+void UMCS_NavQuerySubsystem::AddQueryRegions(FPendingQuery& Query)
+{
+    Query.Regions.Reset();
+
+    // Every cell the radius overlaps can hold a valid candidate, not just the origin's
+    const FIntVector Min = GetRegionKey(Query.Origin - FVector(Query.Radius, Query.Radius, 0.f));
+    const FIntVector Max = GetRegionKey(Query.Origin + FVector(Query.Radius, Query.Radius, 0.f));
+
+    const int64 NumCells = int64(Max.X - Min.X + 1) * int64(Max.Y - Min.Y + 1);
+    if (NumCells > MaxRegionsPerQuery)
+    {
+        // Too wide to be worth caching, sampled around its origin instead
+        return;
+    }
+
+    for (int32 Y = Min.Y; Y <= Max.Y; ++Y)
+    {
+        for (int32 X = Min.X; X <= Max.X; ++X)
+        {
+            const FIntVector Key(X, Y, Min.Z);
+            Query.Regions.Add(Key);
+
+            // Make sure the region is (being) cached
+            if (!Regions.Contains(Key))
+            {
+                Regions.Add(Key);
+                RegionFillQueue.Add(Key);
+            }
+        }
+    }
+}
+
+EMCS_NavQueryStatus UMCS_NavQuerySubsystem::ConsumeQueryResult(int32 Handle, FVector& OutLocation)
+{
+    const FPendingQuery* Query = Queries.Find(Handle);
+    if (!Query)
+    {
+        return EMCS_NavQueryStatus::Invalid;
+    }
+
+    const EMCS_NavQueryStatus Status = Query->Status;
+    if (Status == EMCS_NavQueryStatus::Succeeded)
+    {
+        OutLocation = Query->Candidate;
+    }
+
+    if (Status != EMCS_NavQueryStatus::Pending)
+    {
+        Queries.Remove(Handle);
+    }
+
+    return Status;
+}
+
+void UMCS_NavQuerySubsystem::CancelQuery(int32 Handle)
+{
+    // An in-flight async path result for this handle is simply ignored when it arrives
+    Queries.Remove(Handle);
+    SubmitQueue.Remove(Handle);
+}
+
+void UMCS_NavQuerySubsystem::InvalidateRegionCache()
+{
+    Regions.Reset();
+    RegionFillQueue.Reset();
+
+    // Re-queue regions still needed by pending queries
+    for (const TPair<int32, FPendingQuery>& Pair : Queries)
+    {
+        if (Pair.Value.Status != EMCS_NavQueryStatus::Pending)
+        {
+            continue;
+        }
+
+        for (const FIntVector& Key : Pair.Value.Regions)
+        {
+            if (!Regions.Contains(Key))
+            {
+                Regions.Add(Key);
+                RegionFillQueue.Add(Key);
+            }
+        }
+    }
+}
+
+void UMCS_NavQuerySubsystem::HandleNavigationGenerationFinished(ANavigationData* NavData)
+{
+    InvalidateRegionCache();
+}
+
+void UMCS_NavQuerySubsystem::Tick(float DeltaTime)
+{
+    Super::Tick(DeltaTime);
+
+    if (SubmitQueue.IsEmpty() && RegionFillQueue.IsEmpty())
+    {
+        return;
+    }
+
+    UNavigationSystemV1* NavSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(GetWorld());
+    if (!NavSys)
+    {
+        return;
+    }
+
+    //----------------------------------------
+    // 1. Precompute region points under a per-frame budget
+    //----------------------------------------
+    int32 SampleBudget = FillRegions(NavSys, MaxRegionSamplesPerFrame);
+
+    //----------------------------------------
+    // 2. Submit async path validations (the navigation system batches these off the game thread)
+    //----------------------------------------
+    ANavigationData* NavData = NavSys->GetDefaultNavDataInstance(FNavigationSystem::DontCreate);
+    int32 Submitted = 0;
+
+    for (int32 i = 0; i < SubmitQueue.Num() && Submitted < MaxQueriesPerFrame; )
+    {
+        const int32 Handle = SubmitQueue[i];
+        FPendingQuery* Query = Queries.Find(Handle);
+        AActor* Querier = Query ? Query->Querier.Get() : nullptr;
+
+        if (!Query || !Querier || !NavData)
+        {
+            if (Query)
+            {
+                Query->Status = EMCS_NavQueryStatus::Failed;
+            }
+            SubmitQueue.RemoveAt(i, EAllowShrinking::No);
+            continue;
+        }
+
+        if (Query->Attempts >= MaxAttemptsPerQuery)
+        {
+            Query->Status = EMCS_NavQueryStatus::Failed;
+            SubmitQueue.RemoveAt(i, EAllowShrinking::No);
+            continue;
+        }
+
+        // Regions still being generated, try again next frame
+        if (!AreRegionsComplete(*Query))
+        {
+            ++i;
+            continue;
+        }
+
+        const FSharedConstNavQueryFilter Filter = UNavigationQueryFilter::GetQueryFilter(*NavData, Querier, nullptr);
+
+        if (Query->bSampleOrigin || !PickCachedCandidate(*Query))
+        {
+            // The cache can't answer this query: sample around its own origin (budgeted like region points)
+            if (SampleBudget <= 0)
+            {
+                ++i;
+                continue;
+            }
+            --SampleBudget;
+
+            FNavLocation NavLocation;
+            if (!NavSys->GetRandomPointInNavigableRadius(Query->Origin, Query->Radius, NavLocation, NavData, Filter))
+            {
+                ++Query->Attempts;
+                ++i;
+                continue;
+            }
+            Query->Candidate = NavLocation.Location;
+        }
+
+        ++Query->Attempts;
+
+        FPathFindingQuery PathQuery(Querier, *NavData, Query->Origin, Query->Candidate, Filter);
+
+        Query->bAwaitingPath = true;
+        Query->PathQueryId = NavSys->FindPathAsync(
+            NavData->GetConfig(),
+            PathQuery,
+            FNavPathQueryDelegate::CreateUObject(this, &UMCS_NavQuerySubsystem::HandlePathQueryFinished, Handle));
+
+        SubmitQueue.RemoveAt(i, EAllowShrinking::No);
+        ++Submitted;
+    }
+}
+
+int32 UMCS_NavQuerySubsystem::FillRegions(UNavigationSystemV1* NavSys, int32 Budget)
+{
+    const float Size = FMath::Max(RegionSize, 100.f);
+
+    while (Budget > 0 && RegionFillQueue.Num() > 0)
+    {
+        const FIntVector Key = RegionFillQueue[0];
+        FRegionPoints* Region = Regions.Find(Key);
+        if (!Region || Region->bComplete)
+        {
+            RegionFillQueue.RemoveAt(0, EAllowShrinking::No);
+            continue;
+        }
+
+        const FVector Center = (FVector(Key) + FVector(0.5f)) * Size;
+        const int32 Target = FMath::Max(PointsPerRegion, 1);
+
+        // Sample the cell; samples that miss the navmesh still consume budget
+        while (Budget > 0 && !Region->bComplete)
+        {
+            --Budget;
+
+            FNavLocation NavLocation;
+            if (NavSys->GetRandomPointInNavigableRadius(Center, Size * 0.75f, NavLocation))
+            {
+                Region->Points.Add(NavLocation.Location);
+            }
+            else
+            {
+                ++Region->Misses;
+            }
+
+            // Done when full, when repeated misses show no navmesh, or when sparse navmesh wasted as many samples as it filled
+            const bool bFull = Region->Points.Num() >= Target;
+            const bool bEmpty = Region->Points.IsEmpty() && Region->Misses >= MaxRegionMisses;
+            const bool bSparse = Region->Points.Num() + Region->Misses >= Target * 2;
+
+            Region->bComplete = bFull || bEmpty || bSparse;
+        }
+
+        if (Region->bComplete)
+        {
+            RegionFillQueue.RemoveAt(0, EAllowShrinking::No);
+        }
+    }
+
+    return Budget;
+}
+
+bool UMCS_NavQuerySubsystem::AreRegionsComplete(const FPendingQuery& Query) const
+{
+    for (const FIntVector& Key : Query.Regions)
+    {
+        const FRegionPoints* Region = Regions.Find(Key);
+        if (!Region || !Region->bComplete)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool UMCS_NavQuerySubsystem::PickCachedCandidate(FPendingQuery& Query) const
+{
+    const float RadiusSq = FMath::Square(Query.Radius);
+    int32 NumInside = 0;
+
+    // Uniform pick among every cached point inside the radius (reservoir sampling across the regions)
+    for (const FIntVector& Key : Query.Regions)
+    {
+        const FRegionPoints* Region = Regions.Find(Key);
+        if (!Region)
+        {
+            continue;
+        }
+
+        for (const FVector& Point : Region->Points)
+        {
+            if (FVector::DistSquared2D(Point, Query.Origin) <= RadiusSq && FMath::RandRange(0, NumInside++) == 0)
+            {
+                Query.Candidate = Point;
+            }
+        }
+    }
+
+    return NumInside > 0;
+}
+
+void UMCS_NavQuerySubsystem::HandlePathQueryFinished(uint32 PathId, ENavigationQueryResult::Type Result, FNavPathSharedPtr Path, int32 Handle)
+{
+    FPendingQuery* Query = Queries.Find(Handle);
+    if (!Query || !Query->bAwaitingPath || Query->PathQueryId != PathId)
+    {
+        // Cancelled or superseded
+        return;
+    }
+
+    Query->bAwaitingPath = false;
+
+    if (Result == ENavigationQueryResult::Success && Path.IsValid() && !Path->IsPartial())
+    {
+        Query->Status = EMCS_NavQueryStatus::Succeeded;
+        return;
+    }
+
+    // Unreachable from this agent, retry with a point sampled around the origin if allowed
+    if (Query->Attempts < MaxAttemptsPerQuery)
+    {
+        Query->bSampleOrigin = true;
+        SubmitQueue.Add(Handle);
+    }
+    else
+    {
+        Query->Status = EMCS_NavQueryStatus::Failed;
+    }
+}
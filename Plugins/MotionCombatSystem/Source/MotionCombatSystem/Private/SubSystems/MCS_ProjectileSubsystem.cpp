@@ -0,0 +1,489 @@
+/*
+ * ========================================================================
+ * Copyright © 2025 God's Studio
+ * All Rights Reserved.
+ *
+ * Free for all to use, copy, and distribute. I hope you learn from this as I learned creating it.
+ * =============================================================================
+ *
+ * Project: Motion Combat System
+ * This is a combat system inspired by Unreal Engine’s Motion Matching plugin.
+ * Author: Christopher D. Parker
+ * Date: 10-18-2026
+ * =============================================================================
+ * MCS_ProjectileSubsystem.cpp
+ * Implementation for the batched projectile simulation.
+ */
+
+#include <SubSystems/MCS_ProjectileSubsystem.h>
+#include <SubSystems/MCS_CombatGridSubsystem.h>
+#include <Components/MCS_CombatHitboxComponent.h>
+#include <SubSystems/MCS_CombatBudgetSubsystem.h>
+#include <Stats/MCS_Stats.h>
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "Components/PrimitiveComponent.h"
+#include "DrawDebugHelpers.h"
+
+DECLARE_CYCLE_STAT(TEXT("Projectiles Tick"), STAT_MCS_ProjectilesTick, STATGROUP_MotionCombat);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Projectiles In Flight"), STAT_MCS_ProjectilesInFlight, STATGROUP_MotionCombat);
+
+namespace MCS_Projectile
+{
+    /** Debug draws are the last thing the frame-budget governor gives up */
+    static bool AllowDebugDraw(const UObject* WorldContextObject)
+    {
+        const UMCS_CombatBudgetSubsystem* Governor = UMCS_CombatBudgetSubsystem::Get(WorldContextObject);
+        return !Governor || Governor->AllowDebugDraw();
+    }
+}
+
+bool UMCS_ProjectileSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+    // Only create for PIE/Game worlds; ignore Editor worlds.
+    const UWorld* World = Cast<UWorld>(Outer);
+    return (World && World->IsGameWorld());
+}
+
+void UMCS_ProjectileSubsystem::Deinitialize()
+{
+    for (int32 i = 0; i < Visuals.Num(); ++i)
+    {
+        if (AActor* Visual = Visuals[i].Get())
+        {
+            Visual->Destroy();
+        }
+    }
+
+    for (TPair<TWeakObjectPtr<UClass>, TArray<TWeakObjectPtr<AActor>>>& Pair : VisualPool)
+    {
+        for (const TWeakObjectPtr<AActor>& Visual : Pair.Value)
+        {
+            if (Visual.IsValid())
+            {
+                Visual->Destroy();
+            }
+        }
+    }
+
+    VisualPool.Empty();
+    Attacks.Empty();
+
+    Super::Deinitialize();
+}
+
+TStatId UMCS_ProjectileSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UMCS_ProjectileSubsystem, STATGROUP_Tickables);
+}
+
+bool UMCS_ProjectileSubsystem::FireProjectile(AActor* Instigator, const FMCS_AttackEntry& Attack, const FVector& Origin, const FVector& Direction)
+{
+    LLM_SCOPE_BYTAG(MotionCombat_HitBuffers);
+
+    const FMCS_AttackProjectile& Params = Attack.Projectile;
+
+    if (!Params.bEnabled || !IsValid(Instigator))
+    {
+        return false;
+    }
+
+    if (Positions.Num() >= MaxProjectiles)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("[Projectile] Cap of %d projectiles reached, shot from %s dropped."), MaxProjectiles, *Instigator->GetName());
+        return false;
+    }
+
+    const FVector Velocity = Direction.GetSafeNormal() * Params.Speed;
+    const float WorldGravity = GetWorld() ? GetWorld()->GetGravityZ() : -980.f;
+
+    Positions.Add(Origin);
+    PrevPositions.Add(Origin);
+    Velocities.Add(Velocity);
+    Gravity.Add(WorldGravity * Params.GravityScale);
+    Radii.Add(Params.Radius);
+    TimeLeft.Add(Params.MaxLifetime > 0.f ? Params.MaxLifetime : MAX_flt);
+    RangeLeft.Add(Params.MaxRange > 0.f ? Params.MaxRange : MAX_flt);
+    HitsLeft.Add(FMath::Clamp(Params.MaxHits, 1, 8));
+    AttackIndices.Add(FindOrAddAttack(Attack));
+    Teams.Add(UMCS_CombatGridSubsystem::GetTeamOf(Instigator));
+    bFriendlyFire.Add(Params.bFriendlyFire);
+    bAlive.Add(true);
+    TraceHandles.AddDefaulted();
+    Instigators.Add(Instigator);
+    AlreadyHit.AddDefaulted();
+    Visuals.Add(Params.VisualClass ? AcquireVisual(Params.VisualClass, Origin, Velocity.Rotation()) : nullptr);
+
+    return true;
+}
+
+void UMCS_ProjectileSubsystem::CancelProjectiles(AActor* Instigator)
+{
+    for (int32 i = 0; i < Instigators.Num(); ++i)
+    {
+        if (Instigators[i] == Instigator)
+        {
+            bAlive[i] = false;
+        }
+    }
+
+    RemoveDeadProjectiles();
+}
+
+int32 UMCS_ProjectileSubsystem::FindOrAddAttack(const FMCS_AttackEntry& Attack)
+{
+    // Projectile attacks are few; a linear search keeps the table dense and cheap.
+    // operator== only compares name, montage and tag, and a layered set can shadow a row by name with
+    // other projectile params or damage, so an entry is only shared when every property matches.
+    const UScriptStruct* EntryStruct = FMCS_AttackEntry::StaticStruct();
+    const int32 Existing = Attacks.IndexOfByPredicate([&Attack, EntryStruct](const FMCS_AttackEntry& Entry)
+        {
+            return Entry == Attack && EntryStruct->CompareScriptStruct(&Entry, &Attack, PPF_None);
+        });
+    return Existing != INDEX_NONE ? Existing : Attacks.Add(Attack);
+}
+
+void UMCS_ProjectileSubsystem::Tick(float DeltaTime)
+{
+    Super::Tick(DeltaTime);
+
+    SCOPE_CYCLE_COUNTER(STAT_MCS_ProjectilesTick);
+    FMCS_BudgetScope BudgetScope(this, EMCS_BudgetCategory::Sweeps);
+    LLM_SCOPE_BYTAG(MotionCombat_HitBuffers);
+
+    const int32 Count = Positions.Num();
+    SET_DWORD_STAT(STAT_MCS_ProjectilesInFlight, Count);
+
+    if (Count == 0)
+    {
+        return;
+    }
+
+    UMCS_CombatGridSubsystem* Grid = GetWorld()->GetSubsystem<UMCS_CombatGridSubsystem>();
+    if (Grid)
+    {
+        Grid->RebuildIfStale();
+    }
+
+    //----------------------------------------
+    // 1. Resolve the segment travelled last tick
+    //----------------------------------------
+    for (int32 i = 0; i < Count; ++i)
+    {
+        ResolveStep(i, Grid);
+    }
+
+    //----------------------------------------
+    // 2. Integrate and issue this tick's world traces
+    //----------------------------------------
+    for (int32 i = 0; i < Count; ++i)
+    {
+        if (bAlive[i])
+        {
+            Integrate(i, DeltaTime);
+        }
+    }
+
+    //----------------------------------------
+    // 3. Compact and move visuals
+    //----------------------------------------
+    RemoveDeadProjectiles();
+    UpdateVisuals();
+}
+
+void UMCS_ProjectileSubsystem::ResolveStep(int32 Index, UMCS_CombatGridSubsystem* Grid)
+{
+    const FVector Start = PrevPositions[Index];
+    const FVector End = Positions[Index];
+    const FVector Segment = End - Start;
+    const float SegmentLength = Segment.Size();
+
+    if (SegmentLength <= KINDA_SMALL_NUMBER)
+    {
+        return;
+    }
+
+    //----------------------------------------
+    // World impact from the async trace issued last tick
+    //----------------------------------------
+    float BlockTime = 1.f;
+    FHitResult WorldHit;
+
+    if (TraceHandles[Index].IsValid())
+    {
+        FTraceDatum Datum;
+        if (GetWorld()->QueryTraceData(TraceHandles[Index], Datum))
+        {
+            if (const FHitResult* Hit = FHitResult::GetFirstBlockingHit(Datum.OutHits))
+            {
+                BlockTime = Hit->Time;
+                WorldHit = *Hit;
+            }
+        }
+        TraceHandles[Index] = FTraceHandle();
+    }
+
+    //----------------------------------------
+    // Combatants along the segment (grid broad phase, capsule narrow phase)
+    //----------------------------------------
+    if (Grid && Grid->Num() > 0)
+    {
+        const float Radius = Radii[Index];
+        const AActor* Instigator = Instigators[Index].Get();
+        const FBox Bounds = FBox(Start, End)
+            .ExpandBy(FVector(Radius + Grid->GetMaxRadius(), Radius + Grid->GetMaxRadius(), Radius + Grid->GetMaxHalfHeight()));
+
+        CandidateScratch.Reset();
+        HitScratch.Reset();
+        Grid->GatherCandidates(Bounds, CandidateScratch);
+
+        const TArray<float>& PosX = Grid->GetPositionsX();
+        const TArray<float>& PosY = Grid->GetPositionsY();
+        const TArray<float>& PosZ = Grid->GetPositionsZ();
+        const TArray<float>& CombatantRadii = Grid->GetRadii();
+        const TArray<float>& HalfHeights = Grid->GetHalfHeights();
+        const TArray<uint8>& CombatantTeams = Grid->GetTeams();
+
+        for (const int32 Candidate : CandidateScratch)
+        {
+            if (!UMCS_CombatGridSubsystem::CanAffectTeam(Teams[Index], CombatantTeams[Candidate], bFriendlyFire[Index]))
+            {
+                continue;
+            }
+
+            // Combatants are vertical capsules: segment-vs-segment distance against the capsule axis
+            const float CapsuleRadius = CombatantRadii[Candidate];
+            const float AxisHalf = FMath::Max(HalfHeights[Candidate] - CapsuleRadius, 0.f);
+            const FVector AxisA(PosX[Candidate], PosY[Candidate], PosZ[Candidate] - AxisHalf);
+            const FVector AxisB(PosX[Candidate], PosY[Candidate], PosZ[Candidate] + AxisHalf);
+
+            FVector OnSegment, OnAxis;
+            FMath::SegmentDistToSegmentSafe(Start, End, AxisA, AxisB, OnSegment, OnAxis);
+
+            const float Reach = Radius + CapsuleRadius;
+            if (FVector::DistSquared(OnSegment, OnAxis) > Reach * Reach)
+            {
+                continue;
+            }
+
+            const float Time = FVector::Dist(Start, OnSegment) / SegmentLength;
+            if (Time <= BlockTime)
+            {
+                HitScratch.Emplace(Time, Candidate);
+            }
+        }
+
+        // Dispatch nearest first so piercing consumes hits in travel order
+        HitScratch.Sort([] (const TPair<float, int32>& A, const TPair<float, int32>& B) { return A.Key < B.Key; });
+
+        for (const TPair<float, int32>& Hit : HitScratch)
+        {
+            AActor* HitActor = Grid->GetActor(Hit.Value);
+            if (!HitActor || HitActor == Instigator || AlreadyHit[Index].Contains(HitActor))
+            {
+                continue;
+            }
+
+            DispatchHit(Index, HitActor, Start + Segment * Hit.Key, Hit.Key);
+
+            if (--HitsLeft[Index] <= 0)
+            {
+                bAlive[Index] = false;
+                Positions[Index] = Start + Segment * Hit.Key;
+                return;
+            }
+        }
+    }
+
+    if (BlockTime < 1.f)
+    {
+        bAlive[Index] = false;
+        Positions[Index] = WorldHit.ImpactPoint;
+
+#if WITH_EDITORONLY_DATA || UE_BUILD_DEVELOPMENT
+        if (Attacks[AttackIndices[Index]].Projectile.bDebugDraw && MCS_Projectile::AllowDebugDraw(this))
+        {
+            DrawDebugPoint(GetWorld(), WorldHit.ImpactPoint, 8.f, FColor::Yellow, false, 1.f);
+        }
+#endif
+    }
+}
+
+void UMCS_ProjectileSubsystem::Integrate(int32 Index, float DeltaTime)
+{
+    // Checked before moving so the final segment is still resolved on the next tick
+    if (TimeLeft[Index] <= 0.f || RangeLeft[Index] <= 0.f)
+    {
+        bAlive[Index] = false;
+        return;
+    }
+
+    FVector& Velocity = Velocities[Index];
+    Velocity.Z += Gravity[Index] * DeltaTime;
+
+    const FVector Start = Positions[Index];
+    const FVector End = Start + Velocity * DeltaTime;
+
+    PrevPositions[Index] = Start;
+    Positions[Index] = End;
+
+    TimeLeft[Index] -= DeltaTime;
+    RangeLeft[Index] -= FVector::Dist(Start, End);
+
+    const FMCS_AttackProjectile& Params = Attacks[AttackIndices[Index]].Projectile;
+
+    if (Params.bCollideWithWorld)
+    {
+        FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(MCS_Projectile), false, Instigators[Index].Get());
+
+        FCollisionObjectQueryParams ObjectParams;
+        ObjectParams.AddObjectTypesToQuery(ECC_WorldStatic);
+        ObjectParams.AddObjectTypesToQuery(ECC_WorldDynamic);
+
+        TraceHandles[Index] = GetWorld()->AsyncLineTraceByObjectType(EAsyncTraceType::Single, Start, End, ObjectParams, QueryParams);
+    }
+
+#if WITH_EDITORONLY_DATA || UE_BUILD_DEVELOPMENT
+    if (Params.bDebugDraw && MCS_Projectile::AllowDebugDraw(this))
+    {
+        DrawDebugLine(GetWorld(), Start, End, FColor::Orange, false, 0.5f, 0, 1.f);
+    }
+#endif
+}
+
+void UMCS_ProjectileSubsystem::DispatchHit(int32 Index, AActor* HitActor, const FVector& ImpactPoint, float Time)
+{
+    AlreadyHit[Index].Add(HitActor);
+
+    AActor* Instigator = Instigators[Index].Get();
+    UMCS_CombatHitboxComponent* Hitbox = Instigator ? Instigator->FindComponentByClass<UMCS_CombatHitboxComponent>() : nullptr;
+
+    if (!Hitbox)
+    {
+        UE_LOG(LogTemp, Verbose, TEXT("[Projectile] Hit on %s dropped: instigator has no hitbox component."), *HitActor->GetName());
+        return;
+    }
+
+    const FVector Direction = Velocities[Index].GetSafeNormal();
+
+    FHitResult Hit(HitActor, Cast<UPrimitiveComponent>(HitActor->GetRootComponent()), ImpactPoint, -Direction);
+    Hit.TraceStart = PrevPositions[Index];
+    Hit.TraceEnd = Positions[Index];
+    Hit.Time = Time;
+    Hit.bBlockingHit = true;
+
+    Hitbox->DispatchHit(HitActor, Hit, Attacks[AttackIndices[Index]]);
+}
+
+void UMCS_ProjectileSubsystem::RemoveDeadProjectiles()
+{
+    for (int32 i = bAlive.Num() - 1; i >= 0; --i)
+    {
+        if (bAlive[i])
+        {
+            continue;
+        }
+
+        if (AActor* Visual = Visuals[i].Get())
+        {
+            ReleaseVisual(Visual);
+        }
+
+        Positions.RemoveAtSwap(i, 1, EAllowShrinking::No);
+        PrevPositions.RemoveAtSwap(i, 1, EAllowShrinking::No);
+        Velocities.RemoveAtSwap(i, 1, EAllowShrinking::No);
+        Gravity.RemoveAtSwap(i, 1, EAllowShrinking::No);
+        Radii.RemoveAtSwap(i, 1, EAllowShrinking::No);
+        TimeLeft.RemoveAtSwap(i, 1, EAllowShrinking::No);
+        RangeLeft.RemoveAtSwap(i, 1, EAllowShrinking::No);
+        HitsLeft.RemoveAtSwap(i, 1, EAllowShrinking::No);
+        AttackIndices.RemoveAtSwap(i, 1, EAllowShrinking::No);
+        Teams.RemoveAtSwap(i, 1, EAllowShrinking::No);
+        bFriendlyFire.RemoveAtSwap(i, 1, EAllowShrinking::No);
+        bAlive.RemoveAtSwap(i, 1, EAllowShrinking::No);
+        TraceHandles.RemoveAtSwap(i, 1, EAllowShrinking::No);
+        Instigators.RemoveAtSwap(i, 1, EAllowShrinking::No);
+        Visuals.RemoveAtSwap(i, 1, EAllowShrinking::No);
+        AlreadyHit.RemoveAtSwap(i, 1, EAllowShrinking::No);
+    }
+
+    if (Positions.Num() == 0)
+    {
+        Attacks.Reset();
+    }
+}
+
+void UMCS_ProjectileSubsystem::UpdateVisuals()
+{
+    for (int32 i = 0; i < Visuals.Num(); ++i)
+    {
+        if (AActor* Visual = Visuals[i].Get())
+        {
+            Visual->SetActorLocationAndRotation(Positions[i], Velocities[i].Rotation(), false, nullptr, ETeleportType::TeleportPhysics);
+        }
+    }
+}
+
+AActor* UMCS_ProjectileSubsystem::AcquireVisual(UClass* VisualClass, const FVector& Location, const FRotator& Rotation)
+{
+    if (TArray<TWeakObjectPtr<AActor>>* Free = VisualPool.Find(VisualClass))
+    {
+        while (Free->Num() > 0)
+        {
+            if (AActor* Visual = Free->Pop(EAllowShrinking::No).Get())
+            {
+                Visual->SetActorLocationAndRotation(Location, Rotation, false, nullptr, ETeleportType::TeleportPhysics);
+                Visual->SetActorHiddenInGame(false);
+                Visual->SetActorTickEnabled(true);
+                return Visual;
+            }
+        }
+    }
+
+    FActorSpawnParameters SpawnParams;
+    SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+    AActor* Visual = GetWorld()->SpawnActor<AActor>(VisualClass, Location, Rotation, SpawnParams);
+    if (Visual)
+    {
+        Visual->SetActorEnableCollision(false);
+    }
+    return Visual;
+}
+
+void UMCS_ProjectileSubsystem::ReleaseVisual(AActor* Visual)
+{
+    TArray<TWeakObjectPtr<AActor>>& Free = VisualPool.FindOrAdd(Visual->GetClass());
+
+    if (Free.Num() >= MaxPooledVisualsPerClass)
+    {
+        Visual->Destroy();
+        return;
+    }
+
+    Visual->SetActorHiddenInGame(true);
+    Visual->SetActorTickEnabled(false);
+    Free.Add(Visual);
+}
+
+SIZE_T UMCS_ProjectileSubsystem::GetAllocatedSize() const
+{
+    SIZE_T Size = Positions.GetAllocatedSize() + PrevPositions.GetAllocatedSize() + Velocities.GetAllocatedSize()
+        + Gravity.GetAllocatedSize() + Radii.GetAllocatedSize() + TimeLeft.GetAllocatedSize() + RangeLeft.GetAllocatedSize()
+        + HitsLeft.GetAllocatedSize() + AttackIndices.GetAllocatedSize() + Teams.GetAllocatedSize()
+        + bFriendlyFire.GetAllocatedSize() + bAlive.GetAllocatedSize() + TraceHandles.GetAllocatedSize()
+        + Instigators.GetAllocatedSize() + Visuals.GetAllocatedSize() + AlreadyHit.GetAllocatedSize()
+        + Attacks.GetAllocatedSize() + VisualPool.GetAllocatedSize()
+        + CandidateScratch.GetAllocatedSize() + HitScratch.GetAllocatedSize();
+
+    for (const FHitList& HitList : AlreadyHit)
+    {
+        Size += HitList.GetAllocatedSize();
+    }
+    for (const TPair<TWeakObjectPtr<UClass>, TArray<TWeakObjectPtr<AActor>>>& Pool : VisualPool)
+    {
+        Size += Pool.Value.GetAllocatedSize();
+    }
+
+    return Size;
+}
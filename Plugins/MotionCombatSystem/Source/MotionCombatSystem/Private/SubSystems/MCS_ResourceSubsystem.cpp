@@ -0,0 +1,254 @@
+/*
+ * ========================================================================
+ * Copyright © 2025 God's Studio
+ * All Rights Reserved.
+ *
+ * Free for all to use, copy, and distribute. I hope you learn from this as I learned creating it.
+ * =============================================================================
+ *
+ * Project: Motion Combat System
+ * This is a combat system inspired by Unreal Engine’s Motion Matching plugin.
+ * Author: Christopher D. Parker
+ * Date: 10-18-2026
+ * =============================================================================
+ * MCS_ResourceSubsystem.cpp
+ * Implementation for the batched combat resource store.
+ */
+
+#include <SubSystems/MCS_ResourceSubsystem.h>
+#include <Stats/MCS_Stats.h>
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+
+DECLARE_CYCLE_STAT(TEXT("Resources Tick"), STAT_MCS_ResourcesTick, STATGROUP_MotionCombat);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Resource Slots"), STAT_MCS_ResourceSlots, STATGROUP_MotionCombat);
+
+bool UMCS_ResourceSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+    // Only create for PIE/Game worlds; ignore Editor worlds.
+    const UWorld* World = Cast<UWorld>(Outer);
+    return (World && World->IsGameWorld());
+}
+
+void UMCS_ResourceSubsystem::Deinitialize()
+{
+    Owners.Empty();
+    OwnerSlots.Empty();
+    FreeSlots.Empty();
+
+    Super::Deinitialize();
+}
+
+TStatId UMCS_ResourceSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UMCS_ResourceSubsystem, STATGROUP_Tickables);
+}
+
+void UMCS_ResourceSubsystem::GrowStore()
+{
+    const int32 First = Owners.Num();
+
+    for (TArray<float>* Column : { &Stamina, &MaxStamina, &StaminaRegen, &StaminaDelay, &StaminaCooldown,
+                                   &Poise, &MaxPoise, &PoiseDecay, &PoiseDelay, &PoiseCooldown })
+    {
+        Column->AddZeroed(4);
+    }
+    Owners.AddDefaulted(4);
+
+    // Hand out the lowest new slot first
+    for (int32 Slot = First + 3; Slot >= First; --Slot)
+    {
+        FreeSlots.Add(Slot);
+    }
+}
+
+void UMCS_ResourceSubsystem::ClearSlot(int32 Slot)
+{
+    for (TArray<float>* Column : { &Stamina, &MaxStamina, &StaminaRegen, &StaminaDelay, &StaminaCooldown,
+                                   &Poise, &MaxPoise, &PoiseDecay, &PoiseDelay, &PoiseCooldown })
+    {
+        (*Column)[Slot] = 0.f;
+    }
+}
+
+int32 UMCS_ResourceSubsystem::AllocateSlot(AActor* Owner)
+{
+    if (!IsValid(Owner))
+    {
+        return INDEX_NONE;
+    }
+
+    if (const int32* Existing = OwnerSlots.Find(Owner))
+    {
+        return *Existing;
+    }
+
+    if (FreeSlots.Num() == 0)
+    {
+        GrowStore();
+    }
+
+    const int32 Slot = FreeSlots.Pop(EAllowShrinking::No);
+    ClearSlot(Slot);
+    Owners[Slot] = Owner;
+    OwnerSlots.Add(Owner, Slot);
+
+    SET_DWORD_STAT(STAT_MCS_ResourceSlots, OwnerSlots.Num());
+    return Slot;
+}
+
+void UMCS_ResourceSubsystem::ReleaseSlot(int32 Slot)
+{
+    if (!Owners.IsValidIndex(Slot))
+    {
+        return;
+    }
+
+    // Remove by slot so stale (already destroyed) owners are cleaned up too
+    for (auto It = OwnerSlots.CreateIterator(); It; ++It)
+    {
+        if (It.Value() == Slot)
+        {
+            It.RemoveCurrent();
+            break;
+        }
+    }
+
+    ClearSlot(Slot);
+    Owners[Slot].Reset();
+    FreeSlots.Add(Slot);
+
+    SET_DWORD_STAT(STAT_MCS_ResourceSlots, OwnerSlots.Num());
+}
+
+int32 UMCS_ResourceSubsystem::FindSlot(const AActor* Owner) const
+{
+    const int32* Slot = OwnerSlots.Find(Owner);
+    return Slot ? *Slot : INDEX_NONE;
+}
+
+void UMCS_ResourceSubsystem::ConfigureStamina(int32 Slot, float Max, float RegenRate, float RegenDelay)
+{
+    if (!IsValidSlot(Slot))
+    {
+        return;
+    }
+
+    MaxStamina[Slot] = FMath::Max(Max, 0.f);
+    Stamina[Slot] = MaxStamina[Slot];
+    StaminaRegen[Slot] = FMath::Max(RegenRate, 0.f);
+    StaminaDelay[Slot] = FMath::Max(RegenDelay, 0.f);
+    StaminaCooldown[Slot] = 0.f;
+}
+
+void UMCS_ResourceSubsystem::ConfigurePoise(int32 Slot, float Max, float DecayRate, float DecayDelay)
+{
+    if (!IsValidSlot(Slot))
+    {
+        return;
+    }
+
+    MaxPoise[Slot] = FMath::Max(Max, 0.f);
+    Poise[Slot] = 0.f;
+    PoiseDecay[Slot] = FMath::Max(DecayRate, 0.f);
+    PoiseDelay[Slot] = FMath::Max(DecayDelay, 0.f);
+    PoiseCooldown[Slot] = 0.f;
+}
+
+bool UMCS_ResourceSubsystem::ConsumeStamina(int32 Slot, float Cost)
+{
+    if (!IsValidSlot(Slot))
+    {
+        return false;
+    }
+
+    if (Cost <= 0.f)
+    {
+        return true;
+    }
+
+    if (Stamina[Slot] < Cost)
+    {
+        return false;
+    }
+
+    Stamina[Slot] -= Cost;
+    StaminaCooldown[Slot] = StaminaDelay[Slot];
+    return true;
+}
+
+void UMCS_ResourceSubsystem::RestoreStamina(int32 Slot, float Amount)
+{
+    if (IsValidSlot(Slot))
+    {
+        Stamina[Slot] = FMath::Clamp(Stamina[Slot] + Amount, 0.f, MaxStamina[Slot]);
+    }
+}
+
+float UMCS_ResourceSubsystem::AddPoise(int32 Slot, float Amount)
+{
+    if (!IsValidSlot(Slot))
+    {
+        return 0.f;
+    }
+
+    Poise[Slot] = FMath::Clamp(Poise[Slot] + Amount, 0.f, MaxPoise[Slot]);
+    PoiseCooldown[Slot] = PoiseDelay[Slot];
+    return Poise[Slot];
+}
+
+void UMCS_ResourceSubsystem::ResetPoise(int32 Slot)
+{
+    if (IsValidSlot(Slot))
+    {
+        Poise[Slot] = 0.f;
+        PoiseCooldown[Slot] = 0.f;
+    }
+}
+
+float UMCS_ResourceSubsystem::GetAvailableStamina(const AActor* Actor)
+{
+    const UWorld* World = Actor ? Actor->GetWorld() : nullptr;
+    const UMCS_ResourceSubsystem* Store = World ? World->GetSubsystem<UMCS_ResourceSubsystem>() : nullptr;
+    if (!Store)
+    {
+        return MAX_flt;
+    }
+
+    const int32 Slot = Store->FindSlot(Actor);
+    return Slot != INDEX_NONE ? Store->Stamina[Slot] : MAX_flt;
+}
+
+void UMCS_ResourceSubsystem::Tick(float DeltaTime)
+{
+    Super::Tick(DeltaTime);
+
+    SCOPE_CYCLE_COUNTER(STAT_MCS_ResourcesTick);
+
+    const VectorRegister4Float Zero = VectorZeroFloat();
+    const VectorRegister4Float Dt = VectorSetFloat1(DeltaTime);
+
+    // Arrays are always a multiple of 4 long; free slots have zero rates and stay at 0
+    for (int32 i = 0; i < Owners.Num(); i += 4)
+    {
+        //----------------------------------------
+        // Stamina: regenerate toward max once the post-spend delay has elapsed
+        //----------------------------------------
+        const VectorRegister4Float StaminaWait = VectorSubtract(VectorLoad(&StaminaCooldown[i]), Dt);
+        const VectorRegister4Float StaminaGain = VectorSelect(
+            VectorCompareLE(StaminaWait, Zero), VectorMultiply(VectorLoad(&StaminaRegen[i]), Dt), Zero);
+
+        VectorStore(VectorMin(VectorAdd(VectorLoad(&Stamina[i]), StaminaGain), VectorLoad(&MaxStamina[i])), &Stamina[i]);
+        VectorStore(VectorMax(StaminaWait, Zero), &StaminaCooldown[i]);
+
+        //----------------------------------------
+        // Poise: decay toward 0 once the post-hit delay has elapsed
+        //----------------------------------------
+        const VectorRegister4Float PoiseWait = VectorSubtract(VectorLoad(&PoiseCooldown[i]), Dt);
+        const VectorRegister4Float PoiseLoss = VectorSelect(
+            VectorCompareLE(PoiseWait, Zero), VectorMultiply(VectorLoad(&PoiseDecay[i]), Dt), Zero);
+
+        VectorStore(VectorMax(VectorSubtract(VectorLoad(&Poise[i]), PoiseLoss), Zero), &Poise[i]);
+        VectorStore(VectorMax(PoiseWait, Zero), &PoiseCooldown[i]);
+    }
+}
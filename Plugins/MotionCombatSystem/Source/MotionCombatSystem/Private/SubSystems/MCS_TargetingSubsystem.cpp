@@ -16,10 +16,12 @@
  */
 
 #include <SubSystems/MCS_TargetingSubsystem.h>
+#include <Stats/MCS_Stats.h>
 #include "EngineUtils.h"
 #include "Engine/World.h"
 #include "Engine/EngineTypes.h"
 #include "GameFramework/Actor.h"
+#include "GameFramework/Pawn.h"
 #include "Kismet/GameplayStatics.h"
 #include "CollisionQueryParams.h"
 #include "CollisionShape.h"
@@ -41,6 +43,8 @@ void UMCS_TargetingSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
     Super::Initialize(Collection);
 
+    UMCS_CombatBudgetSubsystem* Governor = Collection.InitializeDependency<UMCS_CombatBudgetSubsystem>();
+
     CachedWorld = GetWorld();
     if (!IsValid(CachedWorld))
     {
@@ -52,12 +56,12 @@ void UMCS_TargetingSubsystem::Initialize(FSubsystemCollectionBase& Collection)
     }
 
     // Start recurring scan timer
-    CachedWorld->GetTimerManager().SetTimer(
-        ScanTimerHandle,
-        this,
-        &UMCS_TargetingSubsystem::ScanForTargets,
-        TargetScanInterval,
-        true);
+    StartScanTimer();
+
+    if (Governor)
+    {
+        DegradationChangedHandle = Governor->OnDegradationChanged.AddUObject(this, &UMCS_TargetingSubsystem::HandleDegradationChanged);
+    }
 
     // Start with scanning enabled
     bIsScanningEnabled = true;
@@ -79,6 +83,12 @@ void UMCS_TargetingSubsystem::Deinitialize()
 
     ScanTimerHandle.Invalidate();
 
+    if (UMCS_CombatBudgetSubsystem* Governor = UMCS_CombatBudgetSubsystem::Get(this))
+    {
+        Governor->OnDegradationChanged.Remove(DegradationChangedHandle);
+    }
+    DegradationChangedHandle.Reset();
+
     // Clear delegates (prevents calls to destroyed objects)
     OnTargetsUpdated.Clear();
 
@@ -135,6 +145,8 @@ void UMCS_TargetingSubsystem::RegisterTarget(AActor* TargetActor)
             return;
     }
 
+    LLM_SCOPE_BYTAG(MotionCombat_Targeting);
+
     FMCS_TargetInfo NewTarget;
     NewTarget.TargetActor = TargetActor;
     NewTarget.bIsValid = true;
@@ -199,8 +211,12 @@ void UMCS_TargetingSubsystem::ScanForTargets()
     UWorld* World = CachedWorld.Get();
     if (!World) return;
 
+    FMCS_BudgetScope BudgetScope(World, EMCS_BudgetCategory::Scans);
+    LLM_SCOPE_BYTAG(MotionCombat_Targeting);
+
+    // Targets are for the local player; a server's player 0 is a remote client, whose own machine scans
     APawn* PlayerPawn = UGameplayStatics::GetPlayerPawn(World, 0);
-    if (!IsValid(PlayerPawn))
+    if (!IsValid(PlayerPawn) || !PlayerPawn->IsLocallyControlled())
         return;
 
     const FVector PlayerLocation = PlayerPawn->GetActorLocation();
@@ -248,7 +264,7 @@ void UMCS_TargetingSubsystem::ScanForTargets()
             continue;
 
         // Ignore player pawn
-        if (Actor == UGameplayStatics::GetPlayerPawn(World, 0))
+        if (Actor == PlayerPawn)
             continue;
 
         // Must implement the MCS combat character interface
@@ -368,12 +384,7 @@ void UMCS_TargetingSubsystem::SetTargetScanningEnabled(bool bEnable)
     if (bIsScanningEnabled)
     {
         // Start (or resume) scanning
-        TimerMgr.SetTimer(
-            ScanTimerHandle,
-            this,
-            &UMCS_TargetingSubsystem::ScanForTargets,
-            TargetScanInterval,
-            true);
+        StartScanTimer();
 
         UE_LOG(LogTemp, Log, TEXT("[MCS_TargetingSubsystem] Target scanning ENABLED."));
     }
@@ -387,4 +398,41 @@ void UMCS_TargetingSubsystem::SetTargetScanningEnabled(bool bEnable)
             UE_LOG(LogTemp, Log, TEXT("[MCS_TargetingSubsystem] Target scanning DISABLED."));
         }
     }
-}
\ No newline at end of file
+}
+
+float UMCS_TargetingSubsystem::GetScanInterval() const
+{
+    const UMCS_CombatBudgetSubsystem* Governor = UMCS_CombatBudgetSubsystem::Get(this);
+    return Governor ? TargetScanInterval * Governor->GetScanIntervalScale() : TargetScanInterval;
+}
+
+void UMCS_TargetingSubsystem::StartScanTimer()
+{
+    // A dedicated server has no local player to target for
+    if (!CachedWorld || CachedWorld->GetNetMode() == NM_DedicatedServer)
+    {
+        return;
+    }
+
+    CachedWorld->GetTimerManager().SetTimer(
+        ScanTimerHandle,
+        this,
+        &UMCS_TargetingSubsystem::ScanForTargets,
+        GetScanInterval(),
+        true);
+}
+
+void UMCS_TargetingSubsystem::HandleDegradationChanged(EMCS_DegradationLevel NewLevel)
+{
+    if (!bIsScanningEnabled || !CachedWorld)
+    {
+        return;
+    }
+
+    // Only re-arm when the interval actually changes, so level changes elsewhere don't keep resetting the countdown
+    const float Interval = GetScanInterval();
+    if (!FMath::IsNearlyEqual(CachedWorld->GetTimerManager().GetTimerRate(ScanTimerHandle), Interval))
+    {
+        StartScanTimer();
+    }
+}
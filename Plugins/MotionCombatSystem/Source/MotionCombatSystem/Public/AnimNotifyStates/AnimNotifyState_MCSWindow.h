@@ -38,7 +38,9 @@ enum class EMCS_AnimEventType : uint8
     AttackStart     UMETA(DisplayName = "Attack Start"),
     DefenseWindow   UMETA(DisplayName = "Defense Window"),
     ParryWindow     UMETA(DisplayName = "Parry Window"),
-    Custom          UMETA(DisplayName = "Custom (User Defined)")
+    Custom          UMETA(DisplayName = "Custom (User Defined)"),
+    ProjectileFire  UMETA(DisplayName = "Projectile Fire"),
+    AreaOfEffect    UMETA(DisplayName = "Area Of Effect")
 };
 
 
@@ -215,6 +217,8 @@ public:
             case EMCS_AnimEventType::ParryWindow:    return FLinearColor::Green;
             case EMCS_AnimEventType::DefenseWindow:  return FLinearColor::Yellow;
             case EMCS_AnimEventType::AttackStart:    return FLinearColor::Gray;
+            case EMCS_AnimEventType::ProjectileFire: return FLinearColor(1.f, 0.5f, 0.f);
+            case EMCS_AnimEventType::AreaOfEffect:   return FLinearColor(0.6f, 0.f, 1.f);
             default:                                 return FLinearColor::Black;
         }
     }
@@ -26,6 +26,8 @@
 #include <Structs/MCS_AttackEntry.h>
 #include <Structs/MCS_AttackSituation.h>
 #include <Structs/MCS_DebugInfo.h>
+#include <Structs/MCS_CompiledAttackSet.h>
+#include <Choosers/MCS_NativeScorer.h>
 #include <Enums/EMCS_AttackDirections.h>
 #include <Enums/EMCS_AttackSituations.h>
 #include "GameplayTagContainer.h"
@@ -33,6 +35,49 @@
 
 class AActor;
 
+/**
+ * Native per-query candidate filter for UMCS_AttackChooser::ChooseAttackIndex.
+ * Replaces copying filtered rows into the chooser before each query.
+ */
+struct FMCS_AttackQueryFilter
+{
+    /** Only consider entries of Type */
+    bool bFilterType = false;
+    EMCS_AttackType Type = EMCS_AttackType::Unknown;
+
+    /** When not empty, only consider entries with one of these names (combo continuations) */
+    TConstArrayView<FName> AllowedNames;
+};
+
+/**
+ * A compiled attack set registered on a chooser as a layer (e.g. "Unarmed base", "Rage stance",
+ * "Sword finishers"). Entries are addressed by a global index, FirstIndex + index in the set.
+ * Deactivating a layer only clears bActive; its rows and attack memory stay registered.
+ */
+struct FMCS_AttackLayer
+{
+    FGameplayTag Tag;
+    TSharedPtr<const FMCS_CompiledAttackSet> Set;
+
+    /** Higher priorities are evaluated first and hide same-named entries of lower layers */
+    int32 Priority = 0;
+
+    int32 FirstIndex = 0;
+    bool bActive = true;
+
+    /** Cooldown and recency timestamps aligned with Set->Entries */
+    FMCS_AttackMemory Memory;
+
+    /** Scorer generated from Set's table, if one is registered and still matches it */
+    FMCS_NativeScorer NativeScorer;
+
+    /** Entries hidden by a same-named entry in a higher-priority active layer (OR of the active ShadowMasks) */
+    TBitArray<> Shadowed;
+
+    /** ShadowMasks[j]: entries a same-named entry of layer j would hide, for every layer j above this one (built on registration) */
+    TArray<TBitArray<>> ShadowMasks;
+};
+
 /**
  * UMCS_AttackChooser
  *
@@ -55,7 +100,7 @@ public:
      * Configurable Data
      * ========================================================== */
 
-    /** Candidate attack entries (usually loaded from a DataTable). */
+    /** Candidate attack entries, used when no layers are registered (sets from a DataTable are added with AddLayer instead). */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MCS|AttackChooser")
     TArray<FMCS_AttackEntry> AttackEntries;
 
@@ -79,6 +124,36 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MCS|AttackChooser")
     bool bPreferTagInsteadOfFilter = false;
 
+    /** Score subtracted from an attack right after it was used, fading out over Recency Window. Discourages repeats. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MCS|AttackChooser|Memory", meta = (ClampMin = "0.0"))
+    float RecencyPenalty = 10.f;
+
+    /** Seconds for the recency penalty to fade out. 0 disables it. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MCS|AttackChooser|Memory", meta = (ClampMin = "0.0"))
+    float RecencyWindow = 3.f;
+
+    /**
+     * Typed queries only score the rows matching the desired direction and the active situations
+     * (plus Omni / Any rows), falling back to every row of the type when none of those is usable.
+     * Turn off if rows facing the wrong way or in an inactive situation should still compete on score.
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MCS|AttackChooser|Performance")
+    bool bUsePartitionedIndex = true;
+
+    /**
+     * Rows the closest target is beyond (RangeEnd plus 25%) are skipped before scoring instead of being
+     * disqualified by ComputeDistanceScore. A query where every row is out of range then chooses nothing.
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MCS|AttackChooser|Performance")
+    bool bCullOutOfRange = true;
+
+    /**
+     * Layers whose table has a generated scorer (GenerateAttackScorers commandlet) are scored by it instead of
+     * ScoreAttack. Same scores, no per-row logging. Not used with a Required Attack Tag or custom scoring (see UsesCustomScoring).
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MCS|AttackChooser|Performance")
+    bool bUseNativeScorers = true;
+
 #if WITH_EDITORONLY_DATA || UE_BUILD_DEVELOPMENT
     
     /** Debugging information for attack scoring. */
@@ -103,9 +178,53 @@ public:
         const FMCS_AttackSituation& CurrentSituation,
         FMCS_AttackEntry& OutAttack) const;
 
-    /** Returns a copy of all loaded attack entries. */
+    /** Returns a copy of all loaded attack entries (the merged view of the active layers). */
     UFUNCTION(BlueprintCallable, Category = "MCS|AttackChooser", meta= (DisplayName = "Get Attack Entries", ReturnDisplayName = "Attack Entries"))
-    TArray<FMCS_AttackEntry> GetAttackEntries() const { return AttackEntries; }
+    TArray<FMCS_AttackEntry> GetAttackEntries() const;
+
+    /**
+     * Native selection: scores the candidates of every active layer passing Filter and returns the
+     * winning entry index (see GetEntry), or INDEX_NONE. Entries on cooldown are skipped and recently
+     * used entries are penalized, both from one vectorized pass over each layer's attack memory.
+     */
+    int32 ChooseAttackIndex(
+        AActor* Instigator,
+        const TArray<AActor*>& Targets,
+        EMCS_AttackDirection DesiredDirection,
+        const FMCS_AttackSituation& CurrentSituation,
+        const FMCS_AttackQueryFilter& Filter) const;
+
+    /**
+     * Registers a shared compiled set as a layer and activates it (no row copies).
+     * Re-adding a registered layer just reactivates it and updates its priority, keeping its attack memory.
+     */
+    void AddLayer(const FGameplayTag& LayerTag, TSharedPtr<const FMCS_CompiledAttackSet> InCompiledSet, int32 Priority);
+
+    /** Activates or deactivates a registered layer. Returns false if the layer isn't registered. */
+    bool SetLayerActive(const FGameplayTag& LayerTag, bool bActive);
+
+    bool IsLayerActive(const FGameplayTag& LayerTag) const;
+
+    /** Unregisters every layer (the chooser falls back to AttackEntries) */
+    void ResetLayers();
+
+    /** Number of addressable entries (all registered layers, active or not) */
+    int32 NumEntries() const;
+
+    /** Entry at a global index, or nullptr */
+    const FMCS_AttackEntry* GetEntry(int32 EntryIndex) const;
+
+    /** Index of the entry named AttackName in the highest-priority active layer that has one, or INDEX_NONE */
+    int32 FindEntryIndex(FName AttackName) const;
+
+    /** Records that an entry started: starts its (group) cooldown and recency penalty */
+    void MarkAttackUsed(int32 EntryIndex, float WorldTime);
+
+    /** True when the entry is off cooldown */
+    bool IsAttackReady(int32 EntryIndex, float WorldTime) const;
+
+    /** Counts the chooser's own rows, layers and attack memory; shared compiled sets are reported per table */
+    virtual void GetResourceSizeEx(FResourceSizeEx& CumulativeResourceSize) override;
 
     /* ==========================================================
      * Scoring API (BlueprintPure helpers)
@@ -123,9 +242,12 @@ public:
     UFUNCTION(BlueprintPure, Category = "MCS|AttackChooser|Scoring", meta = (DisplayName = "Compute Directional Score", ReturnDisplayName = "Score"))
     float ComputeDirectionalScore(const FMCS_AttackEntry& Entry, EMCS_AttackDirection DesiredDirection) const;
 
-    /** Computes a score modifier based on the current combat situation. */
+    /**
+     * Computes a score modifier based on the current combat situation.
+     * Stamina conditions read the Instigator's stamina from the resource store (the situation's value without one).
+     */
     UFUNCTION(BlueprintPure, Category = "MCS|AttackChooser|Scoring", meta = (DisplayName = "Compute Situation Score", ReturnDisplayName = "Score"))
-    float ComputeSituationScore(const FMCS_AttackEntry& Entry, const FMCS_AttackSituation& CurrentSituation) const;
+    float ComputeSituationScore(const FMCS_AttackEntry& Entry, const FMCS_AttackSituation& CurrentSituation, AActor* Instigator = nullptr) const;
 
     /** Combines individual score components into a final result. */
     UFUNCTION(BlueprintPure, Category = "MCS|AttackChooser|Scoring", meta = (DisplayName = "Aggregate Score", ReturnDisplayName = "Score"))
@@ -156,6 +278,43 @@ protected:
     /** Is entry allowed by basic filters (distance & angle). */
     bool IsEntryAllowedByBasicFilters(const FMCS_AttackEntry& Entry, AActor* Instigator, const TArray<AActor*>& Targets) const;
 
-    /** Queries a specific attribute value from the current situation. */
-    float QueryAttributeValue(FName Attribute, const FMCS_AttackSituation& Situation) const;
+    /** Queries a specific attribute value from the current situation (Stamina from the Instigator's resource slot). */
+    float QueryAttributeValue(FName Attribute, const FMCS_AttackSituation& Situation, const AActor* Instigator) const;
+
+    /**
+     * True when ScoreAttack may be overridden: by a Blueprint, or by a native subclass (whose
+     * ScoreAttack_Implementation override reflection can't see). Such choosers score every row of the
+     * requested type since their ranking may not follow the direction / situation partitions or the range cut.
+     * Native subclasses that keep the base scoring can return false to get the fast paths back.
+     */
+    virtual bool UsesCustomScoring() const;
+
+private:
+
+    /** Registered layers, highest priority first (empty = use AttackEntries) */
+    TArray<FMCS_AttackLayer> Layers;
+
+    /** Cooldown and recency timestamps aligned with AttackEntries; resized lazily if AttackEntries is edited */
+    mutable FMCS_AttackMemory Memory;
+
+    /** Per-query penalties written by the vectorized memory pass */
+    mutable TArray<float> PenaltyScratch;
+
+    /** Merged bucket indices when several situations are active */
+    mutable TArray<int32> CandidateScratch;
+
+    /** Makes Memory match the AttackEntries count, keeping the timestamps of rows that survive */
+    void SyncMemory() const;
+
+    /** Builds the per-layer name masks; runs on registration changes only (hashes every row) */
+    void BuildShadowMasks();
+
+    /** ORs the masks of the active layers into each layer's Shadowed bits (no per-row work, runs on every toggle) */
+    void RefreshShadowing();
+
+    /** Layer holding a global entry index (OutLocalIndex = index in its set), or INDEX_NONE */
+    int32 FindLayerForIndex(int32 EntryIndex, int32& OutLocalIndex) const;
+
+    /** Recomputes FirstIndex of every layer after registration changes */
+    void SortLayers();
 };
@@ -25,9 +25,29 @@
 #include <Enums/EMCS_AttackDirections.h>
 #include <Structs/MCS_DefenseEntry.h>
 #include <Structs/MCS_DebugInfo.h>
+#include <Structs/MCS_CompiledDefenseSet.h>
 #include "MCS_DefenseChooser.generated.h"
 
 
+/**
+ * Defender-side inputs of a defense query, gathered once and reused for every attacker.
+ */
+struct FMCS_DefenseQueryContext
+{
+    AActor* Defender = nullptr;
+
+    /** Stamina read from the resource store (MAX_flt without a slot) */
+    float AvailableStamina = MAX_flt;
+
+    /** False when the defender exposes no gameplay tags; tag filters are skipped */
+    bool bHasTags = false;
+
+    /** Owned tags as bits of the compiled set's tag list, plus the container for overflow checks */
+    uint64 OwnedTagBits = 0;
+    FGameplayTagContainer OwnedTags;
+};
+
+
 /**
  * The Defense Chooser is responsible for selecting the optimal defensive action
  * based on contextual scoring, intent, and optional custom eligibility logic.
@@ -58,6 +78,44 @@ public:
         meta = (DisplayName = "Defense Entries", ToolTip = "List of available defensive actions to choose from. Each entry defines a block, dodge, roll, or parry option."))
     TArray<FMCS_DefenseEntry> DefenseEntries;
 
+    /**
+     * Uses a shared compiled set (e.g. from UMCS_AttackDatabaseSubsystem) instead of DefenseEntries.
+     * Pass null to go back to compiling DefenseEntries locally.
+     */
+    void SetCompiledSet(TSharedPtr<const FMCS_CompiledDefenseSet> InCompiledSet);
+
+    /**
+     * Recompiles DefenseEntries on the next query. Call after editing entries at runtime; the chooser
+     * only notices a change in the entry count by itself. Has no effect while a shared set is used.
+     */
+    UFUNCTION(BlueprintCallable, Category = "MCS|Defense")
+    void MarkEntriesDirty();
+
+#if WITH_EDITOR
+    virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
+    /** Entries currently being chosen from (the shared set, or DefenseEntries) */
+    TConstArrayView<FMCS_DefenseEntry> GetDefenseEntries() const;
+
+    /** Entry at an index returned by ChooseDefenseIndex, or null */
+    const FMCS_DefenseEntry* GetEntry(int32 Index) const;
+
+    /**
+     * Selects the best entry against one attacker without copying it.
+     * @return Index into GetDefenseEntries(), or INDEX_NONE.
+     */
+    int32 ChooseDefenseIndex(AActor* Defender, AActor* Attacker, EMCS_DefenseIntent Intent) const;
+
+    /**
+     * Selects the best entry against each of several attackers. Defender stamina and tags are
+     * gathered once; OutIndices[i] is the choice against Attackers[i] (INDEX_NONE if none).
+     */
+    void ChooseDefensesAgainst(AActor* Defender, TConstArrayView<AActor*> Attackers, EMCS_DefenseIntent Intent, TArray<int32>& OutIndices) const;
+
+    /** Counts the chooser's own rows and locally compiled set; a shared compiled set is reported per table */
+    virtual void GetResourceSizeEx(FResourceSizeEx& CumulativeResourceSize) override;
+
     /* ==========================================================
      * Public API
      * ========================================================== */
@@ -176,4 +234,34 @@ public:
      */
     UFUNCTION(BlueprintCallable, Category = "MCS|Defense|Debug")
     void DrawDebugDistanceScores(AActor* Defender, AActor* Attacker, float Duration = 1.5f) const;
+
+protected:
+
+    /**
+     * True when ScoreDefense or CanAttemptDefense must be called per entry. By default this is the case
+     * when a Blueprint overrides either, or for any native subclass (its _Implementation overrides can't be
+     * seen through reflection); native subclasses keeping the base scoring can return false.
+     * Otherwise the chooser scores the compiled columns directly with the same formula as ScoreDefense_Implementation.
+     */
+    virtual bool UsesCustomScoring() const;
+
+private:
+
+    /** Compiled rows being chosen from */
+    mutable TSharedPtr<const FMCS_CompiledDefenseSet> CompiledSet;
+
+    /** True when CompiledSet was assigned through SetCompiledSet rather than compiled from DefenseEntries */
+    bool bSharedCompiledSet = false;
+
+    /** Per-query distance scores written by the vectorized pass */
+    mutable TArray<float> DistanceScratch;
+
+    /** Returns the set to choose from, compiling DefenseEntries if it has no set, was marked dirty or the entry count changed */
+    const FMCS_CompiledDefenseSet& GetCompiledSet() const;
+
+    /** Gathers the defender-side inputs of a query */
+    void MakeQueryContext(const FMCS_CompiledDefenseSet& Set, AActor* Defender, FMCS_DefenseQueryContext& OutContext) const;
+
+    /** Best entry against one attacker */
+    int32 ChooseIndexAgainst(const FMCS_CompiledDefenseSet& Set, const FMCS_DefenseQueryContext& Context, AActor* Attacker, EMCS_DefenseIntent Intent) const;
 };
@@ -0,0 +1,174 @@
+/*
+ * ========================================================================
+ * Copyright © 2025 God's Studio
+ * All Rights Reserved.
+ *
+ * Free for all to use, copy, and distribute. I hope you learn from this as I learned creating it.
+ * =============================================================================
+ *
+ * Project: Motion Combat System
+ * This is a combat system inspired by Unreal Engine’s Motion Matching plugin.
+ * Author: Christopher D. Parker
+ * Date: 10-18-2026
+ * =============================================================================
+ * MCS_NativeScorer.h
+ *
+ * Description:
+ *  Native scorers generated from attack DataTables (the GenerateAttackScorers commandlet) and the
+ *  registry choosers bind them from. A generated scorer holds the set's hot fields as constexpr
+ *  rows and one specialized branch per row, reproducing UMCS_AttackChooser::ScoreAttack_Implementation.
+ *  The MCS_NativeScoring helpers are the arithmetic both paths share, so their scores match exactly.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include <Structs/MCS_AttackSituation.h>
+#include <Structs/MCS_CompiledAttackSet.h>
+#include <Enums/EMCS_AttackDirections.h>
+#include <Enums/EMCS_AttackSituations.h>
+#include <Enums/EMCS_ComparisonMethod.h>
+
+/** What a generated scorer reads besides its own rows */
+struct FMCS_NativeScoreQuery
+{
+    /** Distance to the closest valid target, or -1 without one (no distance score) */
+    float Distance = -1.f;
+
+    EMCS_AttackDirection Direction = EMCS_AttackDirection::Omni;
+
+    const FMCS_AttackSituation* Situation = nullptr;
+
+    /** Instigator's stamina from the resource store (Situation->Stamina without a resource slot) */
+    float Stamina = 0.f;
+};
+
+/** Hot fields of one row, as baked into generated code */
+struct FMCS_NativeAttackRow
+{
+    float Weight;
+    float RangeStart;
+    float RangeEnd;
+    EMCS_AttackDirection Direction;
+    EMCS_AttackSituations Situation;
+};
+
+/** Score of the row at EntryIndex (index in the compiled set) */
+using FMCS_NativeScoreFunc = float (*)(int32 EntryIndex, const FMCS_NativeScoreQuery& Query);
+
+/** A generated scorer and the rows it was generated from */
+struct FMCS_NativeScorer
+{
+    FMCS_NativeScoreFunc Score = nullptr;
+
+    /** Row count and FMCS_CompiledAttackSet::ComputeScoringHash of the set at generation time */
+    int32 NumEntries = 0;
+    uint32 ScoringHash = 0;
+
+    bool IsBound() const { return Score != nullptr; }
+};
+
+/**
+ * Generated scorers by set id (the path of the attack table). Generated modules register theirs on
+ * startup; choosers look them up when a set is added as a layer.
+ */
+class MOTIONCOMBATSYSTEM_API FMCS_NativeScorerRegistry
+{
+public:
+    static void Register(FName SetId, const FMCS_NativeScorer& Scorer);
+    static void Unregister(FName SetId);
+
+    /** Scorer generated for Set; unbound when there is none or its table changed since it was generated */
+    static FMCS_NativeScorer Find(const FMCS_CompiledAttackSet& Set);
+
+private:
+    static TMap<FName, FMCS_NativeScorer>& GetScorers();
+};
+
+/** Scoring arithmetic shared by UMCS_AttackChooser and generated scorers */
+namespace MCS_NativeScoring
+{
+    /** Score of a disqualified row */
+    constexpr float Disqualified = -TNumericLimits<float>::Max();
+
+    /** Distance score of a row for a target Distance away (-1: no target) */
+    FORCEINLINE float DistanceScore(float Distance, float RangeStart, float RangeEnd)
+    {
+        if (Distance < 0.f)
+            return 0.f;
+
+        // Disqualify if completely outside the valid attack window
+        if (Distance < RangeStart || Distance > RangeEnd)
+        {
+            // If too far beyond 25% buffer, treat as invalid (disqualified)
+            if (Distance > RangeEnd * FMCS_CompiledAttackSet::RangeSlack)
+                return Disqualified;
+
+            // Small soft penalty if near the edge of the valid window
+            const float Overshoot = FMath::Abs(Distance - (Distance < RangeStart ? RangeStart : RangeEnd));
+            return -(Overshoot * 0.1f);
+        }
+
+        // Inside valid range — apply smooth scoring curve centered in window
+        const float RangeMid = (RangeStart + RangeEnd) * 0.5f;
+        const float RangeDelta = FMath::Abs(Distance - RangeMid);
+        const float RangeTolerance = (RangeEnd - RangeStart) * 0.5f;
+
+        // Normalized 0 (edge) → 1 (perfect center), mapped to -10..+10
+        const float Normalized = 1.f - FMath::Clamp(RangeDelta / RangeTolerance, 0.f, 1.f);
+        return (Normalized * 20.f) - 10.f;
+    }
+
+    /** Direction score of a row facing EntryDirection */
+    FORCEINLINE float DirectionScore(EMCS_AttackDirection EntryDirection, EMCS_AttackDirection DesiredDirection)
+    {
+        if (EntryDirection == EMCS_AttackDirection::Omni)
+            return 5.f;
+        if (EntryDirection == DesiredDirection)
+            return 10.f;
+
+        // Opposite penalties
+        if ((EntryDirection == EMCS_AttackDirection::Forward && DesiredDirection == EMCS_AttackDirection::Backward) ||
+            (EntryDirection == EMCS_AttackDirection::Backward && DesiredDirection == EMCS_AttackDirection::Forward) ||
+            (EntryDirection == EMCS_AttackDirection::Left && DesiredDirection == EMCS_AttackDirection::Right) ||
+            (EntryDirection == EMCS_AttackDirection::Right && DesiredDirection == EMCS_AttackDirection::Left))
+        {
+            return -10.f;
+        }
+
+        return 0.f;
+    }
+
+    /** Situation score of a row before its conditions */
+    FORCEINLINE float SituationScore(EMCS_AttackSituations EntrySituation, const FMCS_AttackSituation& Situation)
+    {
+        switch (EntrySituation)
+        {
+            case EMCS_AttackSituations::Grounded:   return Situation.bIsGrounded ? 10.f : (Situation.bIsInAir ? -10.f : 0.f);
+            case EMCS_AttackSituations::Airborne:   return Situation.bIsInAir ? 15.f : -10.f;
+            case EMCS_AttackSituations::Running:    return Situation.bIsRunning ? 10.f : 0.f;
+            case EMCS_AttackSituations::Crouching:  return Situation.bIsCrouching ? 10.f : 0.f;
+            case EMCS_AttackSituations::Counter:    return Situation.bIsCountering ? 20.f : 0.f;
+            case EMCS_AttackSituations::Parry:      return Situation.bIsParrying ? 25.f : 0.f;
+            case EMCS_AttackSituations::Riposte:    return Situation.bIsRiposting ? 30.f : 0.f;
+            case EMCS_AttackSituations::Finisher:   return Situation.bIsFinishing ? 25.f : 0.f;
+            case EMCS_AttackSituations::Any:
+            default:                                return 5.f; // always somewhat valid
+        }
+    }
+
+    /** Whether a condition comparing Value against Threshold passes */
+    FORCEINLINE bool ConditionPasses(EMCS_ComparisonMethod Comparison, float Value, float Threshold)
+    {
+        switch (Comparison)
+        {
+            case EMCS_ComparisonMethod::Equal:          return FMath::IsNearlyEqual(Value, Threshold, 0.01f);
+            case EMCS_ComparisonMethod::NotEqual:       return !FMath::IsNearlyEqual(Value, Threshold, 0.01f);
+            case EMCS_ComparisonMethod::Greater:        return Value > Threshold;
+            case EMCS_ComparisonMethod::Less:           return Value < Threshold;
+            case EMCS_ComparisonMethod::GreaterOrEqual: return Value >= Threshold;
+            case EMCS_ComparisonMethod::LessOrEqual:    return Value <= Threshold;
+        }
+        return false;
+    }
+}
@@ -0,0 +1,181 @@
+/*
+ * ========================================================================
+ * Copyright © 2025 God's Studio
+ * All Rights Reserved.
+ *
+ * Free for all to use, copy, and distribute. I hope you learn from this as I learned creating it.
+ * =============================================================================
+ *
+ * Project: Motion Combat System
+ * This is a combat system inspired by Unreal Engine’s Motion Matching plugin.
+ * Author: Christopher D. Parker
+ * Date: 10-18-2026
+ * =============================================================================
+ * MCS_CombatCommandComponent.h
+ * Records timestamped player inputs and recognizes fighting-game style command sequences
+ * (e.g. Back-Forward-Heavy, double taps, charge releases), forwarding them to the combat core.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include <Enums/EMCS_CommandInput.h>
+#include <Enums/EMCS_NetRoleFlags.h>
+#include <Structs/MCS_CommandDefinition.h>
+#include <Structs/MCS_CommandAutomaton.h>
+#include <Structs/MCS_InputHistory.h>
+#include "MCS_CombatCommandComponent.generated.h"
+
+class UMCS_CombatCoreComponent;
+
+
+/*
+ * Delegates
+ */
+
+// Delegate broadcast when a command sequence is recognized
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnCommandRecognizedSignature, FName, CommandName);
+
+
+/**
+ * Command input component. Feed it from your Enhanced Input callbacks; it keeps a ring buffer
+ * of timestamped inputs, advances a compiled Aho-Corasick automaton in O(1) per input, and
+ * calls PerformAttack (or TryContinueCombo) on the combat core when a command completes.
+ */
+UCLASS(Blueprintable, ClassGroup = (MotionCombatSystem), meta = (BlueprintSpawnableComponent, DisplayName = "Motion Combat System Command Component"))
+class MOTIONCOMBATSYSTEM_API UMCS_CombatCommandComponent : public UActorComponent
+{
+    GENERATED_BODY()
+
+public:
+    // Constructor
+    UMCS_CombatCommandComponent();
+
+    /*
+     * Properties
+     */
+
+    /** Authored command sequences. Rebuilt into the automaton on BeginPlay or via RebuildCommands. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MCS|Command", meta = (DisplayName = "Commands", TitleProperty = "CommandName"))
+    TArray<FMCS_CommandDefinition> Commands;
+
+    /**
+     * If no command completes on a button press, perform a plain attack of that button's type.
+     * While the press may still continue a command (Heavy press ... Heavy release) the plain attack
+     * is held until that command completes (no plain attack), breaks, or runs out of time.
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MCS|Command", meta = (DisplayName = "Fallback To Plain Attack"))
+    bool bFallbackToPlainAttack = true;
+
+    /** Stick magnitude below which the directional input is considered neutral. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MCS|Command", meta = (DisplayName = "Direction Dead Zone", ClampMin = "0.0", ClampMax = "1.0"))
+    float DirectionDeadZone = 0.5f;
+
+    /** Net roles that record input and recognize commands; other roles ignore the Push calls */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MCS|Network",
+        meta = (Bitmask, BitmaskEnum = "/Script/MotionCombatSystem.EMCS_NetRoleFlags"))
+    int32 NetExecution = MCS_NetRole::Gameplay;
+
+    /** Log recognized commands */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MCS|Command|Debug")
+    bool bDebug = false;
+
+    /** Event triggered when a command sequence is recognized */
+    UPROPERTY(BlueprintAssignable, Category = "MCS|Command|Events", meta = (DisplayName = "On Command Recognized"))
+    FOnCommandRecognizedSignature OnCommandRecognized;
+
+    /*
+     * Functions
+     */
+
+    /**
+     * Feeds the current movement input. Only direction changes produce a command input, so
+     * Forward, Neutral, Forward registers as a double tap.
+     * @param MoveInput - 2D movement input (X=Right, Y=Forward)
+     */
+    UFUNCTION(BlueprintCallable, Category = "MCS|Command")
+    void PushDirectionalInput(const FVector2D& MoveInput);
+
+    /** Feeds a button press (Light, Heavy or Special) */
+    UFUNCTION(BlueprintCallable, Category = "MCS|Command")
+    void PushButtonPressed(EMCS_CommandInput Button);
+
+    /** Feeds a button release (Light, Heavy or Special); the hold time is measured from the matching press */
+    UFUNCTION(BlueprintCallable, Category = "MCS|Command")
+    void PushButtonReleased(EMCS_CommandInput Button);
+
+    /** Recompiles the Commands array into the automaton and resets the input history */
+    UFUNCTION(BlueprintCallable, Category = "MCS|Command")
+    void RebuildCommands();
+
+#if WITH_EDITOR
+    virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
+protected:
+    virtual void BeginPlay() override;
+
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+private:
+    /*
+     * Properties
+     */
+
+    /** Compiled command automaton */
+    FMCS_CommandAutomaton Automaton;
+
+    /** Timestamped input history (ring buffer) */
+    FMCS_InputHistory History;
+
+    /** Current automaton state */
+    int32 CurrentState = 0;
+
+    /** Last non-neutral direction fed (MAX when neutral) */
+    EMCS_CommandInput LastDirection = EMCS_CommandInput::MAX;
+
+    /** Press timestamps for Light/Heavy/Special, used to compute hold time on release */
+    double PressTimestamps[3] = { 0.0, 0.0, 0.0 };
+
+    /** Release inputs referenced by at least one command; others are kept out of the automaton */
+    bool bReleaseUsed[3] = { false, false, false };
+
+    /** Plain attack held back while its press may still be part of a command (INDEX_NONE when none) */
+    int32 HeldFallbackButton = INDEX_NONE;
+    EMCS_AttackDirection HeldFallbackDirection = EMCS_AttackDirection::Omni;
+
+    /** Longest MaxDuration of any command: how long a held fallback can wait for its command */
+    float MaxCommandDuration = 0.f;
+
+    FTimerHandle HeldFallbackTimer;
+
+    /** Cached combat core on the owner */
+    UPROPERTY(Transient)
+    TObjectPtr<UMCS_CombatCoreComponent> CombatCore;
+
+    /*
+     * Functions
+     */
+
+    /** Records the event, advances the automaton and executes a completed command if any */
+    bool ProcessInput(const FMCS_InputEvent& Event);
+
+    /** Checks the timing constraints of a matched command against the history */
+    bool IsCommandTimingValid(const FMCS_CommandDefinition& Command) const;
+
+    /** Holds the plain attack of ButtonIndex until the pending command resolves or times out */
+    void HoldFallback(int32 ButtonIndex);
+
+    /** Performs the held plain attack, if any */
+    void ReleaseHeldFallback();
+
+    /** Drops the held plain attack without performing it */
+    void ClearHeldFallback();
+
+    /** Forwards a recognized command (or plain attack) to the combat core */
+    void ExecuteAttack(EMCS_AttackType Type, EMCS_AttackDirection Direction, FName AttackName);
+
+    /** Current stick direction as an attack direction */
+    EMCS_AttackDirection GetHeldAttackDirection() const;
+};
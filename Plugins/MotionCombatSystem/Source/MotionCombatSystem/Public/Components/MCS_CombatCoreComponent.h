@@ -33,6 +33,7 @@
 #include <AnimNotifyStates/AnimNotifyState_MCSWindow.h>
 #include <Components/MCS_CombatHitboxComponent.h>
 #include <Events/MCS_CombatEventBus.h>
+#include <Enums/EMCS_NetRoleFlags.h>
 #include "MCS_CombatCoreComponent.generated.h"
 
 
@@ -89,6 +90,14 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MCS|Core", meta = (DisplayName = "Player Situation"))
     FMCS_AttackSituation PlayerSituation;
 
+    /**
+     * Net roles that choose and start attacks (chooser queries, named attacks, combos, projectiles).
+     * Simulated proxies play the montage replicated by the game and never run the chooser.
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MCS|Network",
+        meta = (Bitmask, BitmaskEnum = "/Script/MotionCombatSystem.EMCS_NetRoleFlags"))
+    int32 NetExecution = MCS_NetRole::Gameplay;
+
     /** Blueprint Event triggered whenever the TargetingSubsystem's target list is updated */
     UPROPERTY(BlueprintAssignable, Category = "MCS|Core|Events", meta = (DisplayName = "On Targeting Updated"))
     FOnTargetingUpdatedSignature OnTargetingUpdated;
@@ -141,6 +150,14 @@ public:
         meta = (DisplayName = "Perform Attack", ToolTip = "Selects and executes an attack. You do not need to call SelectAttack first."))
     void PerformAttack(EMCS_AttackType DesiredType, EMCS_AttackDirection DesiredDirection, const FMCS_AttackSituation& CurrentSituation);
 
+    /**
+     * Plays a specific row of the active attack set without running the chooser (e.g. from a command input)
+     * @param AttackName - AttackName of the row to play
+     * @return True if the row was found and played
+     */
+    UFUNCTION(BlueprintCallable, Category = "MCS|Core", meta = (DisplayName = "Perform Named Attack"))
+    bool PerformNamedAttack(FName AttackName, const FMCS_AttackSituation& CurrentSituation);
+
     /** Gets the closest valid target via TargetingSubsystem */
     UFUNCTION(BlueprintCallable, Category = "MCS|Core", meta = (DisplayName = "Get Closest Target"))
     AActor* GetClosestTarget(float MaxRange = 2500.f) const;
@@ -161,11 +178,39 @@ public:
     bool SetActiveAttackSet(const FGameplayTag& NewAttackSetTag);
 
     /**
-     * Gets the currently active attack DataTable (if any).
+     * Activates another attack set on top of the active (base) set, e.g. a stance or weapon-specific layer.
+     * The chooser evaluates all active sets in place; entries of higher-priority layers hide same-named entries below them.
+     * Re-adding a layer that was removed earlier is O(1) and keeps its cooldowns.
+     * @param AttackSetTag - key in AttackSets
+     * @param Priority - higher layers win name conflicts (the base set is 0; adding the base set itself as a layer sets its priority)
+     */
+    UFUNCTION(BlueprintCallable, Category = "MCS|Core", meta = (DisplayName = "Add Attack Layer"))
+    bool AddAttackLayer(const FGameplayTag& AttackSetTag, int32 Priority = 10);
+
+    /** Deactivates an attack set previously added with AddAttackLayer */
+    UFUNCTION(BlueprintCallable, Category = "MCS|Core", meta = (DisplayName = "Remove Attack Layer"))
+    bool RemoveAttackLayer(const FGameplayTag& AttackSetTag);
+
+    /** Attack sets currently active on top of the base set */
+    UFUNCTION(BlueprintPure, Category = "MCS|Core", meta = (DisplayName = "Get Active Attack Layers"))
+    TArray<FGameplayTag> GetActiveAttackLayers() const;
+
+    /**
+     * Gets the currently active attack DataTable (if any). Loads it if its rows came from a cooked database.
      */
     UFUNCTION(BlueprintPure, Category = "MCS|Core", meta = (DisplayName = "Get Active Attack Table"))
     UDataTable* GetActiveAttackTable() const;
 
+    /**
+     * Gets the preferred engagement range of the active attack set.
+     * This is the selection-weighted average of the rows' RangeStart/RangeEnd, cached on set activation.
+     * @param OutRangeStart - preferred minimum distance to the target
+     * @param OutRangeEnd - preferred maximum distance to the target
+     * @return True if an attack set is active
+     */
+    UFUNCTION(BlueprintPure, Category = "MCS|Core", meta = (DisplayName = "Get Active Attack Range"))
+    bool GetActiveAttackRange(float& OutRangeStart, float& OutRangeEnd) const;
+
     /**
      * Gets the currently selected attack (if any).
      */
@@ -205,7 +250,7 @@ private:
 
     /** DataTable containing FMCS_AttackEntry definitions */
     UPROPERTY()
-    TObjectPtr<UDataTable> AttackDataTable;
+    TSoftObjectPtr<UDataTable> AttackDataTable;
 
     /** Cached reference to the world’s targeting subsystem */
     UPROPERTY()
@@ -223,6 +268,17 @@ private:
     UPROPERTY()
     FGameplayTag ActiveAttackSetTag;
 
+    /** Additional active attack sets -> layer priority */
+    UPROPERTY()
+    TMap<FGameplayTag, int32> AttackLayers;
+
+    /** Layer priority of the base (active) attack set, unless it is also listed in AttackLayers */
+    static constexpr int32 BaseAttackLayerPriority = 0;
+
+    /** Preferred engagement range of the active attack set (see GetActiveAttackRange) */
+    float ActiveRangeStart = 0.f;
+    float ActiveRangeEnd = 150.f;
+
     /** Cached list of hitbox window data parsed from the current montage */
     TArray<FMCS_AttackHitbox> CachedHitboxWindows;
 
@@ -249,6 +305,9 @@ private:
     UPROPERTY(Transient)
     TArray<TObjectPtr<UMCS_AttackChooser>> ChooserPool;
 
+    /** Binding to the attack database's recompile notification */
+    FDelegateHandle AttackTableRecompiledHandle;
+
     /*
      * Functions
      */
@@ -267,6 +326,18 @@ private:
     UFUNCTION()
     void HandleMCSNotifyEnd(EMCS_AnimEventType EventType, UAnimNotifyState_MCSWindow* Notify);
 
+    /** Shared compiled rows of an attack DataTable (falls back to a private copy outside game worlds) */
+    TSharedPtr<const FMCS_CompiledAttackSet> GetCompiledAttackSet(const TSoftObjectPtr<UDataTable>& Table) const;
+
+    /** Re-registers the base set / layers built from a table the database recompiled */
+    void HandleAttackTableRecompiled(const UDataTable* Table);
+
+    /** Plays CurrentAttack's montage, binds its notifies and broadcasts the attack start */
+    void PlayCurrentAttack();
+
+    /** Fires CurrentAttack's projectile from its muzzle socket along the owner's aim */
+    void FireCurrentProjectile();
+
     /** Gets a reusable chooser instance or creates a new one if needed */
     UMCS_AttackChooser* GetPooledChooser(TSubclassOf<UMCS_AttackChooser> ChooserClass);
 
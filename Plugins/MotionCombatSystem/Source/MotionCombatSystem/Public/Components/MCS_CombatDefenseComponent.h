@@ -24,6 +24,9 @@
 #include <Events/MCS_CombatEventBus.h>
 #include <Structs/MCS_DefenseEntry.h>
 #include <Structs/MCS_DefenseSetData.h>
+#include <Structs/MCS_CompiledDefenseSet.h>
+#include <Structs/MCS_MontageTimeline.h>
+#include <Enums/EMCS_NetRoleFlags.h>
 #include <Engine/DataTable.h>
 #include "MCS_CombatDefenseComponent.generated.h"
 
@@ -37,8 +40,42 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnParrySuccessSignature);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnParryFailSignature);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnDefenseSuccessSignature);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnDefenseFailSignature);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnDefenseDueSignature, AActor*, Attacker, float, TimeToImpact, EMCS_DefenseIntent, Intent);
 
 
+/**
+ * An attack aimed at this defender, with its impact time predicted from the attacker's montage timeline.
+ */
+struct FMCS_IncomingThreat
+{
+    TWeakObjectPtr<AActor> Attacker;
+    TWeakObjectPtr<const UAnimMontage> Montage;
+
+    /** World time the first damaging window opens */
+    float ImpactTime = 0.f;
+
+    /** True when the attack has a parry window up to its impact */
+    bool bParryable = false;
+};
+
+/**
+ * A parry or defense window as an absolute world-time interval, taken from the montage timeline.
+ * Inputs are resolved against these intervals instead of against per-frame flags.
+ */
+struct FMCS_TimedWindow
+{
+    /** Actor whose montage owns the window (the attacker for parry windows) */
+    TWeakObjectPtr<AActor> Source;
+
+    /** Montage the window belongs to; null for windows reported without a timeline */
+    TWeakObjectPtr<const UAnimMontage> Montage;
+
+    float StartTime = 0.f;
+    float EndTime = MAX_flt;
+
+    bool Contains(float Time, float Grace) const { return Time >= StartTime - Grace && Time <= EndTime + Grace; }
+};
+
 
 /**
  * UMCS_CombatDefenseComponent
@@ -97,6 +134,50 @@ public:
     UPROPERTY(BlueprintReadOnly, Category = "MCS|Defense")
     TObjectPtr<AActor> LastParrySource = nullptr;
 
+    // ------------------------------
+    // Timing
+    // ------------------------------
+
+    /** Seconds a parry/block input may be early or late relative to the window and still count. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MCS|Defense|Timing", meta = (ClampMin = "0.0"))
+    float TimingGraceMargin = 0.05f;
+
+    /** Oldest input timestamp (seconds before now) Try Parry At / Try Block At will still resolve, e.g. for inputs from a client. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MCS|Defense|Timing", meta = (ClampMin = "0.0"))
+    float MaxInputAge = 0.25f;
+
+    // ------------------------------
+    // Incoming attack prediction
+    // ------------------------------
+
+    /**
+     * Track attacks aimed at this actor and choose a defense just before they land (On Defense Due).
+     * Meant for AI defenders; never runs for player-controlled pawns, whose defense comes from input.
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MCS|Defense|Prediction")
+    bool bPredictIncomingAttacks = false;
+
+    /** Seconds before the predicted impact at which the defense is chosen (time for the defense to start). */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MCS|Defense|Prediction", meta = (ClampMin = "0.0"))
+    float DefenseLeadTime = 0.15f;
+
+    /** Choose with Parry intent when the incoming attack has a parry window. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MCS|Defense|Prediction")
+    bool bParryWhenPossible = true;
+
+    /** Incoming attacks tracked at once; beyond this the latest-landing ones are dropped. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MCS|Defense|Prediction", meta = (ClampMin = "1"))
+    int32 MaxTrackedThreats = 4;
+
+    // ------------------------------
+    // Network
+    // ------------------------------
+
+    /** Net roles that resolve parry/block inputs, predict incoming attacks and query the defense chooser. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MCS|Network",
+        meta = (Bitmask, BitmaskEnum = "/Script/MotionCombatSystem.EMCS_NetRoleFlags"))
+    int32 NetExecution = MCS_NetRole::Gameplay;
+
     // ------------------------------
     // Blueprint Events
     // ------------------------------
@@ -121,6 +202,10 @@ public:
     UPROPERTY(BlueprintAssignable, Category = "MCS|Defense|Events", meta = (DisplayName = "On Block Fail"))
     FOnDefenseFailSignature OnDefenseFail;
 
+    /** Broadcast Defense Lead Time before a predicted impact, after Predicted Defense was chosen against the attacker */
+    UPROPERTY(BlueprintAssignable, Category = "MCS|Defense|Events", meta = (DisplayName = "On Defense Due"))
+    FOnDefenseDueSignature OnDefenseDue;
+
     /*
      * Functions
      */
@@ -133,12 +218,41 @@ public:
         meta = (DisplayName = "Try Block", ToolTip = "Attempts to block during a defense window. Returns true if successful."))
     bool TryDefense();
 
+    /**
+     * @brief Resolves a parry input pressed at InputTime (world seconds) against the known parry windows.
+     *
+     * The result does not depend on frame rate or on whether the window notify ticked before the input.
+     * An input slightly before any known window is held for Timing Grace Margin and resolved when a
+     * window is reported (On Parry Success / On Parry Fail); the call then returns false.
+     *
+     * @param InputTime  World time the input was pressed.
+     * @return True if the parry succeeded immediately.
+     */
+    UFUNCTION(BlueprintCallable, Category = "MCS|Defense",
+        meta = (DisplayName = "Try Parry At", ToolTip = "Resolves a parry input made at a given world time against the parry windows."))
+    bool TryParryAt(float InputTime);
+
+    /**
+     * @brief Resolves a block input pressed at InputTime (world seconds) against the defense windows.
+     * Same timing rules as Try Parry At.
+     */
+    UFUNCTION(BlueprintCallable, Category = "MCS|Defense",
+        meta = (DisplayName = "Try Block At", ToolTip = "Resolves a block input made at a given world time against the defense windows."))
+    bool TryDefenseAt(float InputTime);
+
     /**
      * Gets the currently selected attack (if any).
      */
     UFUNCTION(BlueprintPure, Category = "MCS|Core", meta = (DisplayName = "Get Current Defense"))
     FMCS_DefenseEntry GetCurrentDefense() const { return CurrentDefense; }
 
+    /**
+     * Gets the defense chosen by incoming attack prediction (see On Defense Due). Kept apart from the current
+     * defense: it is only a suggestion until Select Defense commits a choice.
+     */
+    UFUNCTION(BlueprintPure, Category = "MCS|Defense|Prediction", meta = (DisplayName = "Get Predicted Defense"))
+    FMCS_DefenseEntry GetPredictedDefense() const { return PredictedDefense; }
+
     /**
      * @brief Sets the active defense set tag and rebuilds the cached defensive pool.
      *
@@ -152,6 +266,31 @@ public:
             ToolTip = "Sets a new active defense set tag and rebuilds available defense options."))
     bool SetActiveDefenseSet(const FGameplayTag& NewDefenseSetTag);
 
+    /**
+     * @brief Chooses the best defense from the active set against an attacker and makes it the current defense.
+     *
+     * @param Attacker  The actor initiating the attack.
+     * @param Intent    Defense or Parry.
+     * @return True if a defense was selected.
+     */
+    UFUNCTION(BlueprintCallable, Category = "MCS|Defense",
+        meta = (DisplayName = "Select Defense",
+            ToolTip = "Chooses the best defense against an attacker from the active defense set."))
+    bool SelectDefense(AActor* Attacker, EMCS_DefenseIntent Intent);
+
+    /**
+     * @brief Gets the tracked incoming attack that lands first.
+     *
+     * @param OutAttacker      The attacking actor.
+     * @param OutTimeToImpact  Seconds until its first damaging window opens.
+     * @return False if no incoming attack is tracked.
+     */
+    UFUNCTION(BlueprintPure, Category = "MCS|Defense|Prediction", meta = (DisplayName = "Get Next Incoming Attack"))
+    bool GetNextIncomingAttack(AActor*& OutAttacker, float& OutTimeToImpact) const;
+
+    /** Counts tracked threats and timing windows (reported by mcs.memreport) */
+    virtual void GetResourceSizeEx(FResourceSizeEx& CumulativeResourceSize) override;
+
 protected:
 
     /*
@@ -172,24 +311,96 @@ private:
 
      /** DataTable containing FMCS_DefenseEntry definitions */
     UPROPERTY()
-    TObjectPtr<UDataTable> DefenseDataTable;
+    TSoftObjectPtr<UDataTable> DefenseDataTable;
 
     /** Runtime instance of the currently active defense chooser. */
     UPROPERTY(Transient)
     TObjectPtr<UMCS_DefenseChooser> ActiveDefenseChooser = nullptr;
 
+    /** Binding to the attack database's defense recompile notification */
+    FDelegateHandle DefenseTableRecompiledHandle;
+
     /** Currently selected defense (if any) */
     UPROPERTY()
     FMCS_DefenseEntry CurrentDefense;
 
+    /** Defense chosen against the last threat that came due; never charged or resolved against */
+    UPROPERTY()
+    FMCS_DefenseEntry PredictedDefense;
+
     /** Currently active defense set tag */
     UPROPERTY()
     FGameplayTag ActiveDefenseSetTag;
 
+    /** Tracked incoming attacks, earliest impact first */
+    TArray<FMCS_IncomingThreat> IncomingThreats;
+
+    /** Fires Defense Lead Time before the earliest impact */
+    FTimerHandle ThreatTimerHandle;
+
+    /** Known attacker parry windows and own defense windows (absolute world time) */
+    TArray<FMCS_TimedWindow> ParryWindows;
+    TArray<FMCS_TimedWindow> DefenseWindows;
+
+    /** Inputs waiting for a window reported within the grace margin (-1 = none) */
+    float PendingParryInputTime = -1.f;
+    float PendingDefenseInputTime = -1.f;
+
+    /** Fails pending inputs once their grace margin has passed */
+    FTimerHandle PendingInputTimerHandle;
+
     /*
      * Functions
      */
 
+    /** Shared compiled rows for a DataTable (private compile outside game worlds) */
+    TSharedPtr<const FMCS_CompiledDefenseSet> GetCompiledDefenseSet(const TSoftObjectPtr<UDataTable>& Table) const;
+
+    /** Points the chooser at the rebuilt rows of an edited defense table */
+    void HandleDefenseTableRecompiled(const UDataTable* Table);
+
+    /** Timeline, position and play rate of the montage an actor is playing; null if none */
+    TSharedPtr<const FMCS_MontageTimeline> GetPlayingTimeline(const AActor* Actor, const UAnimMontage*& OutMontage, float& OutPosition, float& OutPlayRate) const;
+
+    /** Predicts the impact of the attack the attacker is playing; false if it has no damaging window left */
+    bool PredictImpact(AActor* Attacker, FMCS_IncomingThreat& OutThreat) const;
+
+    /** Adds every remaining window of a type in the actor's playing montage as absolute intervals; false if none */
+    bool AddTimelineWindows(AActor* Source, EMCS_AnimEventType EventType, TArray<FMCS_TimedWindow>& OutWindows) const;
+
+    /** Drops windows too old to match any accepted input */
+    void PruneWindows(TArray<FMCS_TimedWindow>& Windows, float Now) const;
+
+    /** Window containing InputTime (within the grace margin) whose attack wasn't interrupted, or null */
+    const FMCS_TimedWindow* FindWindow(const TArray<FMCS_TimedWindow>& Windows, float InputTime, float Now) const;
+
+    /** Facing check and success/fail broadcasts for a parry against Attacker */
+    bool CompleteParry(AActor* Attacker);
+
+    /** Success broadcasts for a block */
+    bool CompleteDefense();
+
+    /** Chooses the best defense against an attacker from the active set into OutDefense */
+    bool ChooseDefense(AActor* Attacker, EMCS_DefenseIntent Intent, FMCS_DefenseEntry& OutDefense) const;
+
+    /** Spends the current defense's stamina cost; false if the defender can't afford it */
+    bool SpendDefenseStamina();
+
+    /** Resolves pending inputs against newly added windows */
+    void ResolvePendingInputs();
+
+    /** Arms the pending-input expiry timer */
+    void SchedulePendingExpiry();
+
+    /** Timer callback: fails pending inputs whose grace margin has passed */
+    void HandlePendingInputExpired();
+
+    /** Arms the threat timer for the earliest tracked impact */
+    void ScheduleNextThreat();
+
+    /** Timer callback: chooses defenses for every threat that is due */
+    void HandleThreatDue();
+
     UFUNCTION() void HandleParryWindowBegin(AActor* Attacker);
     UFUNCTION() void HandleParryWindowEnd(AActor* Attacker);
     UFUNCTION() void HandleDefenseWindowBegin(AActor* Defender);
@@ -22,8 +22,12 @@
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
 #include <Structs/MCS_HitReaction.h>
+#include <Structs/MCS_AttackEntry.h>
+#include <Enums/EMCS_HitReactionLevel.h>
 #include "MCS_CombatHitReactionComponent.generated.h"
 
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnPoiseBrokenSignature, AActor*, Attacker);
+
 UCLASS(Blueprintable, ClassGroup = (MotionCombatSystem), meta = (BlueprintSpawnableComponent, DisplayName = "Motion Combat System Hit Reaction Component"))
 class MOTIONCOMBATSYSTEM_API UMCS_CombatHitReactionComponent : public UActorComponent
 {
@@ -61,25 +65,101 @@ public:
             Tooltip_Severity = "The severity of the incoming attack."
             ))
     void PerformHitReaction(const FHitResult& Hit, AActor* TargetActor, EPGAS_HitSeverity Severity);
-   
+
+    /**
+     * Applies an attack's poise damage to the owner and reacts accordingly:
+     * a full reaction montage once accumulated poise reaches Full Reaction Threshold (poise break),
+     * an additive flinch above Flinch Threshold, and nothing below it (hyper armor).
+     * Without a resource component on the owner every hit gets a full reaction.
+     *
+     * @param Hit - The hit result data containing impact point and bone info.
+     * @param Attacker - The actor that landed the hit.
+     * @param Attack - The attack that landed (Poise Damage and Hit Severity are used).
+     * @return The reaction level that was played.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Hit Reaction", meta = (DisplayName = "React To Hit"))
+    EMCS_HitReactionLevel ReactToHit(const FHitResult& Hit, AActor* Attacker, const FMCS_AttackEntry& Attack);
+
+    /**
+     * Runs ReactToHit in the Reactions phase of the combat world pipeline, so reactions start after
+     * every hit of the frame has applied its damage. Runs it right away without the pipeline.
+     * Use from OnHitboxHit handlers that don't need the reaction level.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Hit Reaction", meta = (DisplayName = "Queue React To Hit"))
+    void QueueReactToHit(const FHitResult& Hit, AActor* Attacker, const FMCS_AttackEntry& Attack);
+
+    /**
+     * Plays a reaction level decided elsewhere, e.g. by the server for a confirmed hit, without touching poise.
+     *
+     * @param Hit - The hit result data containing impact point and bone info.
+     * @param Level - Full plays the reaction montage, Flinch the additive flinch, None nothing.
+     * @param Severity - The severity used to pick the full reaction montage.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Hit Reaction", meta = (DisplayName = "Play Reaction"))
+    void PlayReaction(const FHitResult& Hit, EMCS_HitReactionLevel Level, EPGAS_HitSeverity Severity);
+
+    /** Enables or disables hyper armor (e.g. from an anim notify state during a heavy swing). */
+    UFUNCTION(BlueprintCallable, Category = "Hit Reaction")
+    void SetHyperArmor(bool bEnabled) { bHyperArmor = bEnabled; }
+
+    UFUNCTION(BlueprintPure, Category = "Hit Reaction")
+    bool HasHyperArmor() const { return bHyperArmor; }
+
     /*
      * Properties
      */
 
-     /** DataTable containing FMCS_HitReaction definitions */
+     /** DataTable containing FMCS_HitReaction definitions (soft: never loaded when a cooked combat database covers it) */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MCS|Core", meta = (DisplayName = "Hit Reaction Data Table", RowType = "FMCS_HitReaction", Tooltip = "DataTable defining hit reaction montages based on direction and severity."))
-    TObjectPtr<UDataTable> HitReactionDataTable;
+    TSoftObjectPtr<UDataTable> HitReactionDataTable;
+
+    /** Accumulated poise at or above which a hit only plays an additive flinch. Below it the hit is absorbed. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MCS|Poise", meta = (ClampMin = "0.0", DisplayName = "Flinch Threshold"))
+    float FlinchThreshold = 0.f;
+
+    /** Accumulated poise at or above which a hit breaks poise and plays the full reaction montage. Poise then resets. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MCS|Poise", meta = (ClampMin = "0.0", DisplayName = "Full Reaction Threshold"))
+    float FullReactionThreshold = 100.f;
+
+    /** Hits of this severity or higher always get a full reaction, regardless of poise. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MCS|Poise", meta = (DisplayName = "Always Full Reaction Severity"))
+    EPGAS_HitSeverity AlwaysFullReactionSeverity = EPGAS_HitSeverity::Knockdown;
+
+    /** Multiplier on incoming poise damage while hyper armor is active. Hits that don't break poise are absorbed. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MCS|Poise", meta = (ClampMin = "0.0", DisplayName = "Hyper Armor Poise Scale"))
+    float HyperArmorPoiseScale = 0.5f;
+
+    /** Additive flinch montages by hit direction (None = fallback). Play them in an additive slot so locomotion and attacks continue. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MCS|Poise", meta = (DisplayName = "Flinch Montages"))
+    TMap<EMCS_Direction, TObjectPtr<UAnimMontage>> FlinchMontages;
+
+    /** Broadcast when a hit breaks the owner's poise */
+    UPROPERTY(BlueprintAssignable, Category = "MCS|Poise", meta = (DisplayName = "On Poise Broken"))
+    FOnPoiseBrokenSignature OnPoiseBroken;
 
 protected:
     // Called when the game starts
     virtual void BeginPlay() override;
 
+    // Called when the component is removed from play
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
 private:
 
+    /*
+     * Properties
+     */
+
+    /** Set while the owner is in a hyper armor window */
+    bool bHyperArmor = false;
+
     /*
      * Functions
      */
 
+    /** Helper: Plays an additive flinch montage without stopping the current montage */
+    void PlayFlinchInternal(EMCS_Direction Direction);
+
     /** Helper: Plays a montage on the owning actor's mesh if valid */
     void PlayMontageInternal(UAnimMontage* Montage, float InPlayRate = 1.0f);
 
@@ -13,15 +13,20 @@
  * =============================================================================
  * MCS_CombatHitboxComponent.h
  * Simple socket-driven hitbox (StartSocket → EndSocket).
- * Tick-based sphere sweep while detection is active.
+ * Sphere sweep every frame while detection is active, run by the combat world pipeline
+ * (UMCS_CombatWorldSubsystem) in game worlds, or by the component's own tick without it.
+ * Sweeps are skipped while no combatant is inside the window's baked reach volume.
+ * Also resolves area-of-effect shapes against the combat grid.
  */
 
 #pragma once
 
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
+#include "WorldCollision.h"
 #include <Structs/MCS_AttackEntry.h>
 #include <Structs/MCS_AttackHitbox.h>
+#include <Enums/EMCS_NetRoleFlags.h>
 #include "MCS_CombatHitboxComponent.generated.h"
 
 
@@ -42,6 +47,9 @@ class MOTIONCOMBATSYSTEM_API UMCS_CombatHitboxComponent : public UActorComponent
 {
     GENERATED_BODY()
 
+    // Runs the sweep, resolve and dispatch steps below in its phases
+    friend class UMCS_CombatWorldSubsystem;
+
 public:
     // Constructor
     UMCS_CombatHitboxComponent();
@@ -61,6 +69,17 @@ public:
     UFUNCTION(BlueprintCallable, Category = "MCS|Hitbox")
     void StopHitDetection();
 
+    /**
+     * Starts the attack's area shapes whose Notify Id matches (None matches any notify).
+     * Areas are resolved against the combat grid, not physics, and share the already-hit set.
+     */
+    UFUNCTION(BlueprintCallable, Category = "MCS|Hitbox")
+    void StartAreaDetection(const FMCS_AttackEntry& Attack, FName NotifyId);
+
+    /** Stops every active area and drops pending line-of-sight checks. */
+    UFUNCTION(BlueprintCallable, Category = "MCS|Hitbox")
+    void StopAreaDetection();
+
     /** Is currently detecting hits? */
     UFUNCTION(BlueprintPure, Category = "MCS|Hitbox")
     bool IsDetecting() const { return bIsDetecting; }
@@ -75,6 +94,18 @@ public:
         AlreadyHitActors.Reset();
     }
 
+    /**
+     * Registers a hit for this component's owner and broadcasts OnHitboxHit.
+     * Shared by the melee sweep and by ranged/area attacks resolved elsewhere.
+     */
+    void DispatchHit(AActor* HitActor, const FHitResult& Hit, const FMCS_AttackEntry& Attack);
+
+    /** True while a sweep, an area, a sight check or an undispatched hit is active */
+    bool HasActiveWork() const
+    {
+        return bIsDetecting || ActiveAreas.Num() > 0 || PendingSightChecks.Num() > 0 || PendingHits.Num() > 0;
+    }
+
     /*
      * Properties
      */
@@ -83,10 +114,29 @@ public:
     UPROPERTY(EditAnywhere, Category = "MCS|Hitbox")
     int32 SubstepCount = 2; // 2–4 is usually plenty
 
+    /**
+     * Skip the sweeps of a hitbox window while no combatant registered in the combat grid is inside the
+     * window's reach (baked into the montage timeline). Turn off if the hitbox must also hit actors outside
+     * the grid, such as props or destructibles.
+     */
+    UPROPERTY(EditAnywhere, Category = "MCS|Hitbox")
+    bool bCullByReach = true;
+
+    /**
+     * Net roles that run sweeps and areas. Simulated proxies leave detection to the server by default:
+     * their hits arrive replicated and only the cosmetic reaction plays locally.
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MCS|Network",
+        meta = (Bitmask, BitmaskEnum = "/Script/MotionCombatSystem.EMCS_NetRoleFlags"))
+    int32 NetExecution = MCS_NetRole::Gameplay;
+
     /** Broadcast when a hit is registered. */
     UPROPERTY(BlueprintAssignable, Category = "MCS|Hitbox")
     FMCS_OnSimpleHitSignature OnHitboxHit;
 
+    /** Counts the already-hit set, active areas and scratch buffers (reported by mcs.memreport) */
+    virtual void GetResourceSizeEx(FResourceSizeEx& CumulativeResourceSize) override;
+
 protected:
     /*
      * Functions
@@ -113,8 +163,66 @@ private:
         return nullptr;
     }
 
+    /** Prepare, query and resolve in one go (self-ticking path) */
     void PerformSweep();
 
+    /**
+     * Samples the sockets and lays out this frame's substeps, unless the reach test culls them.
+     * Safe off the game thread once the combat grid is current for the frame.
+     */
+    void PrepareSweep(int32 Substeps);
+
+    /** Sweeps the prepared substeps into SweepHits. Only reads the physics scene; safe off the game thread. */
+    void RunSweepQueries();
+
+    /** Filters SweepHits in substep order against the already-hit set. Safe off the game thread while pipeline driven. */
+    void FilterSweepHits();
+
+    /** Draws this frame's substeps and hits, then clears the sweep buffers */
+    void DrawSweepDebug();
+
+    /**
+     * World box around everything this hitbox can touch this frame: prepared substeps, active areas
+     * and pending sight checks. Invalid when there is nothing.
+     */
+    FBox GetFrameBounds() const;
+
+    /** Dispatches a hit now, or queues it for the pipeline's Apply Damage phase */
+    void RegisterHit(AActor* HitActor, const FHitResult& Hit, const FMCS_AttackEntry& Attack);
+
+    /** Dispatches the hits queued for the Apply Damage phase */
+    void DispatchPendingHits();
+
+    /** Returns the component to its own tick (the pipeline was disabled) */
+    void ReleaseFromPipeline();
+
+    /** Reach volume (mesh component space) of the hitbox window the attack's montage is in, or an invalid box */
+    FBox ResolveWindowReach(const FMCS_AttackEntry& Attack) const;
+
+    /** True if a combatant other than the owner, not yet hit, overlaps ActiveReach this frame */
+    bool IsAnyoneInReach(const USkeletalMeshComponent& Mesh);
+
+    /** Tests every active area against the grid and advances their timers */
+    void UpdateAreas(float DeltaTime);
+
+    /**
+     * Grid tests of UpdateAreas. Hits needing line of sight are queued without a trace.
+     * Safe off the game thread once the combat grid is current for the frame.
+     */
+    void TestAreas(float DeltaTime);
+
+    /** Game thread half of UpdateAreas: issues queued sight traces, draws and drops finished areas */
+    void FinishAreas();
+
+    /** Dispatches area hits whose line-of-sight trace came back clear */
+    void ResolveSightChecks();
+
+    /** Joins the combat world pipeline, or ticks itself without one, only while there is work */
+    void UpdateTickEnabled();
+
+    /** Current center of an area (socket / actor location plus local offset) */
+    FVector ResolveAreaCenter(const FMCS_AttackArea& Area) const;
+
     /*
      * Properties
      */
@@ -132,6 +240,76 @@ private:
     FVector PrevStartLoc = FVector::ZeroVector;
     FVector PrevEndLoc = FVector::ZeroVector;
 
+    // Reach of the active hitbox window (invalid: always sweep)
+    FBox ActiveReach = FBox(ForceInit);
+
     // Prevent hitting same actor multiple times in one swing
     TSet<TWeakObjectPtr<AActor>> AlreadyHitActors;
+
+    // Run by the combat world pipeline instead of the component tick
+    bool bPipelineDriven = false;
+
+    /** One substep of the swing */
+    struct FSweepStep
+    {
+        FVector Start;
+        FVector End;
+    };
+
+    /** A resolved hit waiting for the Apply Damage phase */
+    struct FPendingHit
+    {
+        TWeakObjectPtr<AActor> Actor;
+        FHitResult Hit;
+        FMCS_AttackEntry Attack;
+    };
+
+    // This frame's substeps and their raw hits, in substep order
+    TArray<FSweepStep> SweepSteps;
+    TArray<FHitResult> SweepHits;
+    TArray<FHitResult> StepHits;
+
+    // Impact points of this frame's new hits (debug draw)
+    TArray<FVector> DebugImpacts;
+
+    // Hits resolved by the pipeline, dispatched in its Apply Damage phase
+    TArray<FPendingHit> PendingHits;
+
+    /** An area shape currently being resolved */
+    struct FActiveArea
+    {
+        FMCS_AttackArea Area;
+        FVector Center = FVector::ZeroVector;
+        FVector Forward = FVector::ForwardVector;
+        float Elapsed = 0.f;
+        float PrevShellRadius = 0.f;
+
+        // Annulus tested this frame (debug draw)
+        float Inner = 0.f;
+        float Outer = 0.f;
+    };
+
+    /** Area hit waiting for its line-of-sight trace (an invalid handle: not issued yet) */
+    struct FPendingSightCheck
+    {
+        FTraceHandle Handle;
+        TWeakObjectPtr<AActor> Actor;
+        FHitResult Hit;
+    };
+
+    // Active areas and the attack they belong to
+    TArray<FActiveArea> ActiveAreas;
+    FMCS_AttackEntry AreaAttack;
+
+    // Line-of-sight traces issued last frame
+    TArray<FPendingSightCheck> PendingSightChecks;
+
+    // Scratch buffers for the grid tests (padded to a multiple of 4)
+    TArray<int32> ReachCandidates;
+    TArray<int32> AreaCandidates;
+    TArray<float> AreaDX;
+    TArray<float> AreaDY;
+    TArray<float> AreaDZ;
+    TArray<float> AreaRadius;
+    TArray<float> AreaHeight;
 };
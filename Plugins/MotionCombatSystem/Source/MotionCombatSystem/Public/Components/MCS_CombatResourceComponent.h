@@ -0,0 +1,110 @@
+/*
+ * ========================================================================
+ * Copyright © 2025 God's Studio
+ * All Rights Reserved.
+ *
+ * Free for all to use, copy, and distribute. I hope you learn from this as I learned creating it.
+ * =============================================================================
+ *
+ * Project: Motion Combat System
+ * This is a combat system inspired by Unreal Engine’s Motion Matching plugin.
+ * Author: Christopher D. Parker
+ * Date: 10-18-2026
+ * =============================================================================
+ * MCS_CombatResourceComponent.h
+ * Stamina and poise for a combatant. Values live in UMCS_ResourceSubsystem;
+ * this component only configures its slot and exposes it to gameplay and Blueprint.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "MCS_CombatResourceComponent.generated.h"
+
+class UMCS_ResourceSubsystem;
+
+
+/**
+ * Combat resource component (stamina, poise). Does not tick; the resource subsystem updates every slot in one pass.
+ */
+UCLASS(Blueprintable, ClassGroup = (MotionCombatSystem), meta = (BlueprintSpawnableComponent, DisplayName = "Motion Combat System Resource Component"))
+class MOTIONCOMBATSYSTEM_API UMCS_CombatResourceComponent : public UActorComponent
+{
+    GENERATED_BODY()
+
+public:
+    // Constructor
+    UMCS_CombatResourceComponent();
+
+    /*
+     * Properties
+     */
+
+    /** Maximum stamina. Attacks and defenses with a Stamina Cost above the current value are filtered out. */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "MCS|Resources|Stamina", meta = (ClampMin = "0.0"))
+    float MaxStamina = 100.f;
+
+    /** Stamina regenerated per second */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "MCS|Resources|Stamina", meta = (ClampMin = "0.0"))
+    float StaminaRegenRate = 25.f;
+
+    /** Seconds after spending stamina before it starts regenerating */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "MCS|Resources|Stamina", meta = (ClampMin = "0.0"))
+    float StaminaRegenDelay = 1.f;
+
+    /** Maximum accumulated poise damage */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "MCS|Resources|Poise", meta = (ClampMin = "0.0"))
+    float MaxPoise = 100.f;
+
+    /** Poise damage recovered per second */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "MCS|Resources|Poise", meta = (ClampMin = "0.0"))
+    float PoiseDecayRate = 20.f;
+
+    /** Seconds after a hit before poise starts recovering */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "MCS|Resources|Poise", meta = (ClampMin = "0.0"))
+    float PoiseDecayDelay = 1.5f;
+
+    /*
+     * Functions
+     */
+
+    UFUNCTION(BlueprintPure, Category = "MCS|Resources")
+    float GetStamina() const;
+
+    UFUNCTION(BlueprintPure, Category = "MCS|Resources")
+    float GetStaminaPercent() const;
+
+    /** Spends stamina; fails without spending if there isn't enough */
+    UFUNCTION(BlueprintCallable, Category = "MCS|Resources")
+    bool ConsumeStamina(float Cost);
+
+    UFUNCTION(BlueprintCallable, Category = "MCS|Resources")
+    void RestoreStamina(float Amount);
+
+    UFUNCTION(BlueprintPure, Category = "MCS|Resources")
+    float GetPoise() const;
+
+    /** Re-applies the properties above to the store (e.g. after changing them at runtime). Refills stamina. */
+    UFUNCTION(BlueprintCallable, Category = "MCS|Resources")
+    void ApplyConfiguration();
+
+    /** Slot in the resource store, INDEX_NONE before BeginPlay */
+    int32 GetResourceSlot() const { return ResourceSlot; }
+
+protected:
+    virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+private:
+    /*
+     * Properties
+     */
+
+    /** Cached store */
+    UPROPERTY(Transient)
+    TObjectPtr<UMCS_ResourceSubsystem> Store;
+
+    /** Slot owned in the store */
+    int32 ResourceSlot = INDEX_NONE;
+};
@@ -0,0 +1,66 @@
+/*
+ * ========================================================================
+ * Copyright © 2025 God's Studio
+ * All Rights Reserved.
+ *
+ * Free for all to use, copy, and distribute. I hope you learn from this as I learned creating it.
+ * =============================================================================
+ *
+ * Project: Motion Combat System
+ * This is a combat system inspired by Unreal Engine’s Motion Matching plugin.
+ * Author: Christopher D. Parker
+ * Date: 10-18-2026
+ * =============================================================================
+ * MCS_HitConfirmComponent.h
+ * Receives the server's confirmed hits on a client. Add it to the PlayerController class:
+ * on the server it registers its connection with UMCS_HitConfirmSubsystem, which sends it one
+ * batch per frame; on the client it plays the cosmetic reactions and broadcasts each hit.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include <Structs/MCS_HitConfirm.h>
+#include "MCS_HitConfirmComponent.generated.h"
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnMCSHitConfirmedSignature, const FMCS_ConfirmedHit&, Hit);
+
+
+/**
+ * Per-connection receiver of confirmed hit batches. Does not tick.
+ */
+UCLASS(Blueprintable, ClassGroup = (MotionCombatSystem), meta = (BlueprintSpawnableComponent, DisplayName = "Motion Combat System Hit Confirm Component"))
+class MOTIONCOMBATSYSTEM_API UMCS_HitConfirmComponent : public UActorComponent
+{
+    GENERATED_BODY()
+
+public:
+    // Constructor
+    UMCS_HitConfirmComponent();
+
+    /*
+     * Properties
+     */
+
+    /** Play the server's reaction on the victim's hit reaction component (poise is not touched on clients) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MCS|Hit Confirm")
+    bool bPlayReactions = true;
+
+    /** Broadcast on the client for every confirmed hit whose victim is replicated here (effects, sounds, hit markers) */
+    UPROPERTY(BlueprintAssignable, Category = "MCS|Hit Confirm", meta = (DisplayName = "On Hit Confirmed"))
+    FOnMCSHitConfirmedSignature OnHitConfirmed;
+
+    /*
+     * Functions
+     */
+
+    /** The frame's confirmed hits relevant to this connection, sent by the server's hit confirm subsystem */
+    UFUNCTION(Client, Unreliable)
+    void ClientReceiveHitConfirms(const FMCS_HitConfirmBatch& Batch);
+
+protected:
+    virtual void BeginPlay() override;
+
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+};
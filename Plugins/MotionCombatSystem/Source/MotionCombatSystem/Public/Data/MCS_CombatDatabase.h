@@ -0,0 +1,163 @@
+/*
+ * ========================================================================
+ * Copyright © 2025 God's Studio
+ * All Rights Reserved.
+ *
+ * Free for all to use, copy, and distribute. I hope you learn from this as I learned creating it.
+ * =============================================================================
+ *
+ * Project: Motion Combat System
+ * This is a combat system inspired by Unreal Engine’s Motion Matching plugin.
+ * Author: Christopher D. Parker
+ * Date: 10-18-2026
+ * =============================================================================
+ * MCS_CombatDatabase.h
+ *
+ * Description:
+ *  Cooked form of the attack, defense and hit reaction DataTables. DataTables stay the authoring
+ *  format; the database compiles them (every time it is saved, which includes cooking) into rows
+ *  plus one blob holding everything the runtime derives from them: partition buckets, reach order,
+ *  defense columns and tag bitsets, and the notify timelines of the montages the rows play.
+ *  The blob is read in a single bulk read, and the attack database subsystem hands the sets out
+ *  without ever parsing the source tables.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "UObject/SoftObjectPath.h"
+#include <Structs/MCS_AttackEntry.h>
+#include <Structs/MCS_DefenseEntry.h>
+#include <Structs/MCS_HitReaction.h>
+#include <Structs/MCS_CompiledAttackSet.h>
+#include <Structs/MCS_CompiledDefenseSet.h>
+#include <Structs/MCS_MontageTimeline.h>
+#include "MCS_CombatDatabase.generated.h"
+
+class UDataTable;
+
+
+/** Rows of one attack DataTable, as cooked */
+USTRUCT()
+struct MOTIONCOMBATSYSTEM_API FMCS_CookedAttackTable
+{
+    GENERATED_BODY()
+
+    /** Table the rows were compiled from (a path, so looking it up never loads the table) */
+    UPROPERTY(VisibleAnywhere, Category = "MCS|Database")
+    FSoftObjectPath Source;
+
+    UPROPERTY(VisibleAnywhere, Category = "MCS|Database")
+    TArray<FMCS_AttackEntry> Rows;
+};
+
+/** Rows of one defense DataTable, as cooked */
+USTRUCT()
+struct MOTIONCOMBATSYSTEM_API FMCS_CookedDefenseTable
+{
+    GENERATED_BODY()
+
+    UPROPERTY(VisibleAnywhere, Category = "MCS|Database")
+    FSoftObjectPath Source;
+
+    UPROPERTY(VisibleAnywhere, Category = "MCS|Database")
+    TArray<FMCS_DefenseEntry> Rows;
+};
+
+/** Rows of one hit reaction DataTable, as cooked */
+USTRUCT()
+struct MOTIONCOMBATSYSTEM_API FMCS_CookedReactionTable
+{
+    GENERATED_BODY()
+
+    UPROPERTY(VisibleAnywhere, Category = "MCS|Database")
+    FSoftObjectPath Source;
+
+    UPROPERTY(VisibleAnywhere, Category = "MCS|Database")
+    TArray<FMCS_HitReaction> Rows;
+};
+
+
+/**
+ * UMCS_CombatDatabase
+ * Attack, defense and hit reaction tables compiled ahead of time. Register it with the attack
+ * database subsystem (CookedDatabases in the Game config, or AddCookedDatabase at runtime).
+ * Make sure the cooker picks the asset up (Asset Manager or DirectoriesToAlwaysCook).
+ */
+UCLASS(BlueprintType, meta = (DisplayName = "Motion Combat Database"))
+class MOTIONCOMBATSYSTEM_API UMCS_CombatDatabase : public UDataAsset
+{
+    GENERATED_BODY()
+
+public:
+    /*
+     * Properties
+     */
+
+#if WITH_EDITORONLY_DATA
+    /** Authoring tables (FMCS_AttackEntry, FMCS_DefenseEntry or FMCS_HitReaction rows). Editor only; never cooked. */
+    UPROPERTY(EditAnywhere, Category = "MCS|Database")
+    TArray<TObjectPtr<UDataTable>> SourceTables;
+#endif
+
+    /*
+     * Functions
+     */
+
+#if WITH_EDITOR
+    /** Compiles every source table and the montages its rows play. Also runs on every save and cook. */
+    UFUNCTION(CallInEditor, Category = "MCS|Database")
+    void Rebuild();
+
+    virtual void PreSave(FObjectPreSaveContext SaveContext) override;
+#endif
+
+    virtual void Serialize(FArchive& Ar) override;
+
+    /** Compiled set of a source table, or null if this database does not contain it */
+    TSharedPtr<const FMCS_CompiledAttackSet> FindAttackSet(const FSoftObjectPath& Table) const;
+    TSharedPtr<const FMCS_CompiledDefenseSet> FindDefenseSet(const FSoftObjectPath& Table) const;
+    TSharedPtr<const TArray<FMCS_HitReaction>> FindReactions(const FSoftObjectPath& Table) const;
+
+    /** Cooked notify timeline of a montage played by the database's rows, or null */
+    TSharedPtr<const FMCS_MontageTimeline> FindMontageTimeline(const FSoftObjectPath& Montage) const;
+
+private:
+    /*
+     * Properties
+     */
+
+    /* Cooked rows (tagged serialization: they reference montages, tags and classes). Moved into the runtime sets on load in cooked builds. */
+    UPROPERTY(VisibleAnywhere, Category = "MCS|Database")
+    TArray<FMCS_CookedAttackTable> AttackTables;
+
+    UPROPERTY(VisibleAnywhere, Category = "MCS|Database")
+    TArray<FMCS_CookedDefenseTable> DefenseTables;
+
+    UPROPERTY(VisibleAnywhere, Category = "MCS|Database")
+    TArray<FMCS_CookedReactionTable> ReactionTables;
+
+    /** Montages with a cooked timeline, aligned with MontageTimelines */
+    UPROPERTY(VisibleAnywhere, Category = "MCS|Database")
+    TArray<FSoftObjectPath> Montages;
+
+    /* Runtime sets, aligned with the cooked arrays above (rebuilt from the derived blob on load) */
+    TArray<TSharedPtr<FMCS_CompiledAttackSet>> AttackSets;
+    TArray<TSharedPtr<FMCS_CompiledDefenseSet>> DefenseSets;
+    TArray<TSharedPtr<TArray<FMCS_HitReaction>>> ReactionSets;
+    TArray<TSharedPtr<FMCS_MontageTimeline>> MontageTimelines;
+
+    /*
+     * Functions
+     */
+
+    /** Writes or reads the derived blob; false if it is missing or out of date */
+    bool SerializeDerived(FArchive& Ar);
+
+    /** Hands the cooked rows to the runtime sets read from a valid blob */
+    void AdoptCookedRows();
+
+    /** Rebuilds the runtime sets from the cooked rows (fallback for a stale blob) */
+    void BuildFromRows();
+};
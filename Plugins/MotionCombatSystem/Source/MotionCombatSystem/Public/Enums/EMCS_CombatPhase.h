@@ -0,0 +1,33 @@
+/*
+ * ========================================================================
+ * Copyright © 2025 God's Studio
+ * All Rights Reserved.
+ *
+ * Free for all to use, copy, and distribute. I hope you learn from this as I learned creating it.
+ * =============================================================================
+ *
+ * Project: Motion Combat System
+ * This is a combat system inspired by Unreal Engine’s Motion Matching plugin.
+ * Author: Christopher D. Parker
+ * Date: 10-18-2026
+ * =============================================================================
+ * EMCS_CombatPhase.h
+ * Declares the EMCS_CombatPhase enum, the ordered phases of the combat world tick.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+UENUM(BlueprintType, meta = (DisplayName = "Motion Combat System Combat Phase"))
+enum class EMCS_CombatPhase : uint8
+{
+    Snapshot        UMETA(DisplayName = "Snapshot"),
+    Decide          UMETA(DisplayName = "Decide"),
+    Sweep           UMETA(DisplayName = "Sweep"),
+    ResolveHits     UMETA(DisplayName = "Resolve Hits"),
+    ApplyDamage     UMETA(DisplayName = "Apply Damage"),
+    Reactions       UMETA(DisplayName = "Reactions"),
+    PublishEvents   UMETA(DisplayName = "Publish Events"),
+    MAX             UMETA(Hidden)
+};
@@ -0,0 +1,42 @@
+/*
+ * ========================================================================
+ * Copyright © 2025 God's Studio
+ * All Rights Reserved.
+ *
+ * Free for all to use, copy, and distribute. I hope you learn from this as I learned creating it.
+ * =============================================================================
+ *
+ * Project: Motion Combat System
+ * This is a combat system inspired by Unreal Engine’s Motion Matching plugin.
+ * Author: Christopher D. Parker
+ * Date: 10-18-2026
+ * =============================================================================
+ * EMCS_CommandInput.h
+ * Declares the EMCS_CommandInput enum, the input alphabet used by command sequences.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+UENUM(BlueprintType, meta = (DisplayName = "Motion Combat System Command Input"))
+enum class EMCS_CommandInput : uint8
+{
+    // Directional inputs, relative to the character's facing
+    Forward         UMETA(DisplayName = "Forward"),
+    Back            UMETA(DisplayName = "Back"),
+    Left            UMETA(DisplayName = "Left"),
+    Right           UMETA(DisplayName = "Right"),
+
+    // Button presses
+    Light           UMETA(DisplayName = "Light Press"),
+    Heavy           UMETA(DisplayName = "Heavy Press"),
+    Special         UMETA(DisplayName = "Special Press"),
+
+    // Button releases (carry the hold time, used for charge commands)
+    LightRelease    UMETA(DisplayName = "Light Release"),
+    HeavyRelease    UMETA(DisplayName = "Heavy Release"),
+    SpecialRelease  UMETA(DisplayName = "Special Release"),
+
+    MAX             UMETA(Hidden)
+};
@@ -0,0 +1,28 @@
+/*
+ * ========================================================================
+ * Copyright © 2025 God's Studio
+ * All Rights Reserved.
+ *
+ * Free for all to use, copy, and distribute. I hope you learn from this as I learned creating it.
+ * =============================================================================
+ *
+ * Project: Motion Combat System
+ * This is a combat system inspired by Unreal Engine’s Motion Matching plugin.
+ * Author: Christopher D. Parker
+ * Date: 10-18-2026
+ * =============================================================================
+ * EMCS_HitReactionLevel.h
+ * Declares the EMCS_HitReactionLevel enum, the outcome of a hit after poise is applied.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+UENUM(BlueprintType, meta = (DisplayName = "Motion Combat System Hit Reaction Level"))
+enum class EMCS_HitReactionLevel : uint8
+{
+    None    UMETA(DisplayName = "None (Hyper Armor)"),
+    Flinch  UMETA(DisplayName = "Flinch (Additive)"),
+    Full    UMETA(DisplayName = "Full (Montage Interrupt)")
+};
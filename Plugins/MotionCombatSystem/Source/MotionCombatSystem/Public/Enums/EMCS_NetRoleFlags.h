@@ -0,0 +1,59 @@
+/*
+ * ========================================================================
+ * Copyright © 2025 God's Studio
+ * All Rights Reserved.
+ *
+ * Free for all to use, copy, and distribute. I hope you learn from this as I learned creating it.
+ * =============================================================================
+ *
+ * Project: Motion Combat System
+ * This is a combat system inspired by Unreal Engine’s Motion Matching plugin.
+ * Author: Christopher D. Parker
+ * Date: 10-18-2026
+ * =============================================================================
+ * EMCS_NetRoleFlags.h
+ * Declares the EMCS_NetRoleFlags bitmask, the net roles a combat component runs its gameplay work on,
+ * and helpers to test a component's owner against it.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+
+UENUM(BlueprintType, meta = (Bitflags, UseEnumValuesAsMaskValuesInEditor = "true", DisplayName = "Motion Combat System Net Role Flags"))
+enum class EMCS_NetRoleFlags : uint8
+{
+    None            = 0         UMETA(Hidden),
+    Authority       = 1 << 0    UMETA(DisplayName = "Authority"),
+    AutonomousProxy = 1 << 1    UMETA(DisplayName = "Autonomous Proxy"),
+    SimulatedProxy  = 1 << 2    UMETA(DisplayName = "Simulated Proxy")
+};
+ENUM_CLASS_FLAGS(EMCS_NetRoleFlags);
+
+namespace MCS_NetRole
+{
+    /** Server and locally controlled combatants: the roles that decide and detect */
+    constexpr int32 Gameplay = static_cast<int32>(EMCS_NetRoleFlags::Authority | EMCS_NetRoleFlags::AutonomousProxy);
+
+    /** Every role, for cosmetic work */
+    constexpr int32 All = Gameplay | static_cast<int32>(EMCS_NetRoleFlags::SimulatedProxy);
+
+    /** Role of the component's owner on this machine (standalone games and servers are Authority) */
+    inline EMCS_NetRoleFlags GetFlag(const UActorComponent* Component)
+    {
+        switch (Component ? Component->GetOwnerRole() : ROLE_None)
+        {
+            case ROLE_Authority:        return EMCS_NetRoleFlags::Authority;
+            case ROLE_AutonomousProxy:  return EMCS_NetRoleFlags::AutonomousProxy;
+            case ROLE_SimulatedProxy:   return EMCS_NetRoleFlags::SimulatedProxy;
+            default:                    return EMCS_NetRoleFlags::None;
+        }
+    }
+
+    /** True if Mask (EMCS_NetRoleFlags bits) includes the role of the component's owner */
+    inline bool ShouldExecute(const UActorComponent* Component, int32 Mask)
+    {
+        return (Mask & static_cast<int32>(GetFlag(Component))) != 0;
+    }
+}
@@ -0,0 +1,53 @@
+/*
+ * ========================================================================
+ * Copyright © 2025 God's Studio
+ * All Rights Reserved.
+ *
+ * Free for all to use, copy, and distribute. I hope you learn from this as I learned creating it.
+ * =============================================================================
+ *
+ * Project: Motion Combat System
+ * This is a combat system inspired by Unreal Engine’s Motion Matching plugin.
+ * Author: Christopher D. Parker
+ * Date: 10-18-2026
+ * =============================================================================
+ * MCS_MemoryReport.h
+ *
+ * Description:
+ *  Memory breakdown of the Motion Combat System for one world, printed by the "mcs.memreport"
+ *  console command: per attack/defense set, per DataTable, per component/chooser type, per
+ *  subsystem, and the montages the combat tables keep resident.
+ *
+ *  Usage: mcs.memreport [Budget=<KB>] [AssetBudget=<KB>]
+ *  When a budget is given and exceeded the report logs an error, so an automated soak run
+ *  that executes the command fails on memory regressions.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UWorld;
+class FOutputDevice;
+
+
+/**
+ * Totals produced by one report.
+ */
+struct FMCS_MemoryTotals
+{
+    /** Heap and object memory owned by MCS (components, choosers, subsystems, compiled sets) */
+    SIZE_T OwnedBytes = 0;
+
+    /** Assets referenced by MCS tables (DataTables and resident montages) */
+    SIZE_T AssetBytes = 0;
+};
+
+/**
+ * Builds and prints the memory report.
+ */
+struct MOTIONCOMBATSYSTEM_API FMCS_MemoryReport
+{
+    /** Writes the report for World to Ar and returns the totals */
+    static FMCS_MemoryTotals Write(UWorld* World, FOutputDevice& Ar);
+};
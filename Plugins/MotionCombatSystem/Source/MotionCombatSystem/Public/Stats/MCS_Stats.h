@@ -0,0 +1,38 @@
+/*
+ * ========================================================================
+ * Copyright © 2025 God's Studio
+ * All Rights Reserved.
+ *
+ * Free for all to use, copy, and distribute. I hope you learn from this as I learned creating it.
+ * =============================================================================
+ *
+ * Project: Motion Combat System
+ * This is a combat system inspired by Unreal Engine’s Motion Matching plugin.
+ * Author: Christopher D. Parker
+ * Date: 10-18-2026
+ * =============================================================================
+ * MCS_Stats.h
+ * Stat group, CSV category and LLM tags shared by Motion Combat System runtime code.
+ * Use "stat MotionCombat" in the console to display the group, "mcs.memreport" for a memory breakdown
+ * and -llm to see the MotionCombat tags in "stat LLMFULL".
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+#include "HAL/LowLevelMemTracker.h"
+
+DECLARE_STATS_GROUP(TEXT("MotionCombat"), STATGROUP_MotionCombat, STATCAT_Advanced);
+
+CSV_DECLARE_CATEGORY_MODULE_EXTERN(MOTIONCOMBATSYSTEM_API, MotionCombat);
+
+/* LLM tags (underscores become the tag hierarchy: MotionCombat/Choosers, ...) */
+LLM_DECLARE_TAG_API(MotionCombat, MOTIONCOMBATSYSTEM_API);
+LLM_DECLARE_TAG_API(MotionCombat_Databases, MOTIONCOMBATSYSTEM_API);      // compiled attack/defense sets, montage timelines
+LLM_DECLARE_TAG_API(MotionCombat_Choosers, MOTIONCOMBATSYSTEM_API);       // per-character chooser instances and their memory
+LLM_DECLARE_TAG_API(MotionCombat_HitBuffers, MOTIONCOMBATSYSTEM_API);     // hitbox/area buffers, projectiles, combat grid
+LLM_DECLARE_TAG_API(MotionCombat_Targeting, MOTIONCOMBATSYSTEM_API);      // target registry
+LLM_DECLARE_TAG_API(MotionCombat_Events, MOTIONCOMBATSYSTEM_API);         // combat event bus
+LLM_DECLARE_TAG_API(MotionCombat_Traces, MOTIONCOMBATSYSTEM_API);         // recorded latency samples
@@ -0,0 +1,103 @@
+/*
+ * ========================================================================
+ * Copyright © 2025 God's Studio
+ * All Rights Reserved.
+ *
+ * Free for all to use, copy, and distribute. I hope you learn from this as I learned creating it.
+ * =============================================================================
+ *
+ * Project: Motion Combat System
+ * This is a combat system inspired by Unreal Engine’s Motion Matching plugin.
+ * Author: Christopher D. Parker
+ * Date: 10-18-2026
+ * =============================================================================
+ * MCS_AttackArea.h
+ * Area-of-effect hit shapes (ground slams, spins, shockwaves) resolved through the combat grid.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MCS_AttackArea.generated.h"
+
+
+/*
+ * Enum defining the shape of an area-of-effect hit.
+ */
+UENUM(BlueprintType, meta = (DisplayName = "Motion Combat System Area Shape"))
+enum class EMCS_AreaShape : uint8
+{
+    Sphere          UMETA(DisplayName = "Sphere (Cylinder)"),
+    Cone            UMETA(DisplayName = "Cone"),
+    Ring            UMETA(DisplayName = "Ring"),
+    ExpandingShell  UMETA(DisplayName = "Expanding Shell (Shockwave)")
+};
+
+
+/**
+ * Area-of-effect hit definition stored on an attack entry.
+ * Shapes are tested in the horizontal plane with a vertical half height, against combatant cylinders.
+ */
+USTRUCT(BlueprintType, meta = (DisplayName = "Motion Combat System Attack Area", Description = "Area-of-effect hit shape in the MCS Combat System"))
+struct MOTIONCOMBATSYSTEM_API FMCS_AttackArea
+{
+    GENERATED_BODY()
+
+public:
+
+    /** Only Area Of Effect notifies with this Unique ID start this area. None = any Area Of Effect notify. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Area", meta = (DisplayName = "Notify Id"))
+    FName NotifyId = NAME_None;
+
+    /** Shape of the area. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Area", meta = (DisplayName = "Shape"))
+    EMCS_AreaShape Shape = EMCS_AreaShape::Sphere;
+
+    /** Optional socket used as the center. Falls back to the actor location. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Area", meta = (DisplayName = "Center Socket"))
+    FName CenterSocket = NAME_None;
+
+    /** Offset from the center in the owner's local space (e.g. X=100 for a slam in front). */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Area", meta = (DisplayName = "Offset"))
+    FVector Offset = FVector::ZeroVector;
+
+    /** Outer radius (final radius for an expanding shell). */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Area", meta = (ClampMin = "0.0", DisplayName = "Radius"))
+    float Radius = 300.f;
+
+    /** Inner radius of a ring. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Area", meta = (ClampMin = "0.0", DisplayName = "Inner Radius", EditCondition = "Shape == EMCS_AreaShape::Ring", EditConditionHides))
+    float InnerRadius = 150.f;
+
+    /** Half angle of a cone in degrees, around the owner's forward. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Area", meta = (ClampMin = "0.0", ClampMax = "180.0", DisplayName = "Cone Half Angle", EditCondition = "Shape == EMCS_AreaShape::Cone", EditConditionHides))
+    float ConeHalfAngle = 45.f;
+
+    /** Width of the wave front of an expanding shell. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Area", meta = (ClampMin = "0.0", DisplayName = "Shell Thickness", EditCondition = "Shape == EMCS_AreaShape::ExpandingShell", EditConditionHides))
+    float ShellThickness = 50.f;
+
+    /** Vertical reach above and below the center. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Area", meta = (ClampMin = "0.0", DisplayName = "Half Height"))
+    float HalfHeight = 100.f;
+
+    /** Seconds the area stays active (an expanding shell grows to Radius over this time). 0 = single frame. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Area", meta = (ClampMin = "0.0", DisplayName = "Duration"))
+    float Duration = 0.f;
+
+    /** Re-evaluate the center from the owner every frame (spins). Off = fixed where it started (shockwaves). */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Area", meta = (DisplayName = "Follow Owner"))
+    bool bFollowOwner = true;
+
+    /** Allow hits on actors of the owner's team. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Area", meta = (DisplayName = "Friendly Fire"))
+    bool bFriendlyFire = false;
+
+    /** Require an unobstructed line from the center to the target (batched async traces, resolved next frame). */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Area", meta = (DisplayName = "Require Line Of Sight"))
+    bool bRequireLineOfSight = false;
+
+    /** Debug draw toggle for this area. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Area", meta = (DisplayName = "Debug Draw"))
+    bool bDebugDraw = false;
+};
@@ -27,6 +27,8 @@
 #include <Enums/EMCS_AttackDirections.h>
 #include <Enums/EMCS_AttackSituations.h>
 #include <Structs/MCS_AttackHitbox.h>
+#include <Structs/MCS_AttackProjectile.h>
+#include <Structs/MCS_AttackArea.h>
 #include <Structs/MCS_AttackCondition.h>
 #include <Structs/MCS_HitReaction.h>
 #include "MCS_AttackEntry.generated.h"
@@ -124,6 +126,26 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MCS|Attack", meta = (ClampMin = "0.0", DisplayName = "Range End"))
 	float RangeEnd = 150.f;
 
+	// Stamina spent when this attack starts; the chooser skips it while the attacker has less
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MCS|Attack", meta = (ClampMin = "0.0", DisplayName = "Stamina Cost"))
+	float StaminaCost = 0.f;
+
+	// Poise damage dealt on hit; the victim's accumulated poise decides between no reaction, a flinch or a full reaction
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MCS|Attack", meta = (ClampMin = "0.0", DisplayName = "Poise Damage"))
+	float PoiseDamage = 10.f;
+
+	/* ---------------------------
+	 * Cooldown
+	 * --------------------------- */
+
+	// Seconds after this attack starts before the chooser may pick it (or any attack in its cooldown group) again
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MCS|Attack|Cooldown", meta = (ClampMin = "0.0", DisplayName = "Cooldown"))
+	float Cooldown = 0.f;
+
+	// Attacks sharing a group share the cooldown (e.g. the left and right variants of a slam). None = this attack only.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MCS|Attack|Cooldown", meta = (DisplayName = "Cooldown Group"))
+	FName CooldownGroup = NAME_None;
+
 	/* ---------------------------
 	 * Utility / Editor-only
 	 * --------------------------- */
@@ -148,6 +170,22 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MCS|Attack|Combo", meta = (DisplayName = "Allowed Next Attacks"))
 	TArray<FName> AllowedNextAttacks;
 
+	/* ---------------------------
+	 * Ranged
+	 * --------------------------- */
+
+	/** Projectile fired by this attack (pistol / rifle / thrown). Fired on the Projectile Fire notify. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MCS|Attack|Projectile", meta = (DisplayName = "Projectile"))
+	FMCS_AttackProjectile Projectile;
+
+	/* ---------------------------
+	 * Area of effect
+	 * --------------------------- */
+
+	/** Area shapes started by this attack's Area Of Effect notifies (slams, spins, shockwaves). */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MCS|Attack|Area", meta = (DisplayName = "Areas"))
+	TArray<FMCS_AttackArea> Areas;
+
 	/* ---------------------------
 	 * Hit Reaction Support
 	 * --------------------------- */
@@ -0,0 +1,78 @@
+/*
+ * ========================================================================
+ * Copyright © 2025 God's Studio
+ * All Rights Reserved.
+ *
+ * Free for all to use, copy, and distribute. I hope you learn from this as I learned creating it.
+ * =============================================================================
+ *
+ * Project: Motion Combat System
+ * This is a combat system inspired by Unreal Engine’s Motion Matching plugin.
+ * Author: Christopher D. Parker
+ * Date: 10-18-2026
+ * =============================================================================
+ * MCS_AttackProjectile.h
+ * Describes the projectile an attack entry fires (pistol, rifle, thrown weapons, ...).
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "MCS_AttackProjectile.generated.h"
+
+USTRUCT(BlueprintType, meta = (DisplayName = "Motion Combat System Attack Projectile", Description = "Projectile fired by an attack in the MCS Combat System"))
+struct MOTIONCOMBATSYSTEM_API FMCS_AttackProjectile
+{
+    GENERATED_BODY()
+
+public:
+
+    /** Fire a projectile when the attack's Projectile Fire notify begins. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile", meta = (DisplayName = "Enabled"))
+    bool bEnabled = false;
+
+    /** Socket the projectile spawns from (e.g., "muzzle"). Falls back to the actor location. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile", meta = (DisplayName = "Muzzle Socket", EditCondition = "bEnabled"))
+    FName MuzzleSocket = NAME_None;
+
+    /** Initial speed (cm/s). */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile", meta = (ClampMin = "1.0", DisplayName = "Speed", EditCondition = "bEnabled"))
+    float Speed = 6000.f;
+
+    /** Multiplier on world gravity. 0 = straight line. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile", meta = (DisplayName = "Gravity Scale", EditCondition = "bEnabled"))
+    float GravityScale = 0.f;
+
+    /** Collision radius of the projectile. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile", meta = (ClampMin = "0.0", DisplayName = "Radius", EditCondition = "bEnabled"))
+    float Radius = 5.f;
+
+    /** Distance after which the projectile expires. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile", meta = (ClampMin = "0.0", DisplayName = "Max Range", EditCondition = "bEnabled"))
+    float MaxRange = 10000.f;
+
+    /** Seconds after which the projectile expires. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile", meta = (ClampMin = "0.0", DisplayName = "Max Lifetime", EditCondition = "bEnabled"))
+    float MaxLifetime = 3.f;
+
+    /** Number of combatants the projectile can hit before it stops (1 = no piercing). */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile", meta = (ClampMin = "1", ClampMax = "8", DisplayName = "Max Hits", EditCondition = "bEnabled"))
+    int32 MaxHits = 1;
+
+    /** Stop on world geometry (WorldStatic / WorldDynamic). */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile", meta = (DisplayName = "Collide With World", EditCondition = "bEnabled"))
+    bool bCollideWithWorld = true;
+
+    /** Allow hits on actors of the instigator's team. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile", meta = (DisplayName = "Friendly Fire", EditCondition = "bEnabled"))
+    bool bFriendlyFire = false;
+
+    /** Cosmetic actor moved along with the projectile. Pooled; it should not simulate or collide. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile", meta = (DisplayName = "Visual Class", EditCondition = "bEnabled"))
+    TSubclassOf<AActor> VisualClass;
+
+    /** Debug draw toggle for this projectile. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile", meta = (DisplayName = "Debug Draw", EditCondition = "bEnabled"))
+    bool bDebugDraw = false;
+};
@@ -59,7 +59,8 @@ public:
      * - Heavy_AttackSet_DataTable
      * - DualBlades_ComboAttackTable
      *
-     * @details The DataTable must use the FMCS_AttackEntry row structure.
+     * @details The DataTable must use the FMCS_AttackEntry row structure. Soft reference: tables
+     * covered by a cooked combat database are never loaded, their rows come from the database.
      *
      * @see FMCS_AttackEntry
      */
@@ -67,7 +68,7 @@ public:
         meta = (DisplayName = "Attack Data Table",
             ToolTip = "DataTable containing FMCS_AttackEntry rows defining available attacks for this set.",
             RowType = "/Script/MotionCombatSystem/Structs/FMCS_AttackEntry"))
-    TObjectPtr<UDataTable> AttackDataTable = nullptr;
+    TSoftObjectPtr<UDataTable> AttackDataTable;
 
     /**
      * @brief The Attack Chooser instance used for this Attack Set.
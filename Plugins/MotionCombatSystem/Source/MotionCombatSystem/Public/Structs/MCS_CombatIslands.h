@@ -0,0 +1,65 @@
+/*
+ * ========================================================================
+ * Copyright © 2025 God's Studio
+ * All Rights Reserved.
+ *
+ * Free for all to use, copy, and distribute. I hope you learn from this as I learned creating it.
+ * =============================================================================
+ *
+ * Project: Motion Combat System
+ * This is a combat system inspired by Unreal Engine’s Motion Matching plugin.
+ * Author: Christopher D. Parker
+ * Date: 10-18-2026
+ * =============================================================================
+ * MCS_CombatIslands.h
+ * Connected components (islands) of combatants linked by attack, reach or engagement relations.
+ * Nothing in one island can touch a combatant of another, so islands resolve independently.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Union-find over node indices, grouped into islands once every link is in.
+ * Islands are numbered in the order of their lowest node, so the numbering only depends on the links.
+ */
+struct MOTIONCOMBATSYSTEM_API FMCS_CombatIslands
+{
+    /** Starts over with NumNodes singleton nodes */
+    void Reset(int32 NumNodes);
+
+    /** Puts A and B in the same island */
+    void Link(int32 A, int32 B);
+
+    /** Groups the nodes into islands; call after the last Link */
+    void Finalize();
+
+    /** Number of islands (valid after Finalize) */
+    int32 Num() const { return Starts.Num() > 0 ? Starts.Num() - 1 : 0; }
+
+    /** Island of a node (valid after Finalize) */
+    int32 GetIsland(int32 Node) const { return IslandOf[Node]; }
+
+    /** Nodes of an island, ascending */
+    TConstArrayView<int32> GetMembers(int32 Island) const
+    {
+        return TConstArrayView<int32>(Members.GetData() + Starts[Island], Starts[Island + 1] - Starts[Island]);
+    }
+
+    SIZE_T GetAllocatedSize() const
+    {
+        return Parent.GetAllocatedSize() + IslandOf.GetAllocatedSize() + Starts.GetAllocatedSize() + Members.GetAllocatedSize();
+    }
+
+private:
+    /** Root of a node's set (path halving) */
+    int32 FindRoot(int32 Node);
+
+    TArray<int32> Parent;
+
+    /* Islands: node -> island, and members of island i at Members[Starts[i] .. Starts[i + 1]) */
+    TArray<int32> IslandOf;
+    TArray<int32> Starts;
+    TArray<int32> Members;
+};
@@ -0,0 +1,71 @@
+/*
+ * ========================================================================
+ * Copyright © 2025 God's Studio
+ * All Rights Reserved.
+ *
+ * Free for all to use, copy, and distribute. I hope you learn from this as I learned creating it.
+ * =============================================================================
+ *
+ * Project: Motion Combat System
+ * This is a combat system inspired by Unreal Engine’s Motion Matching plugin.
+ * Author: Christopher D. Parker
+ * Date: 10-18-2026
+ * =============================================================================
+ * MCS_CommandAutomaton.h
+ * Aho-Corasick automaton compiled from command sequences.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include <Enums/EMCS_CommandInput.h>
+#include <Structs/MCS_CommandDefinition.h>
+
+/**
+ * FMCS_CommandAutomaton
+ * All command sequences compiled into one deterministic automaton. Failure links are folded
+ * into a dense transition table at build time, so advancing on an input is a single table
+ * lookup no matter how many commands exist. Each state lists every command whose sequence
+ * ends there (including shorter suffix matches).
+ */
+struct MOTIONCOMBATSYSTEM_API FMCS_CommandAutomaton
+{
+    static constexpr int32 NumSymbols = static_cast<int32>(EMCS_CommandInput::MAX);
+
+    /** Rebuilds the automaton from authored commands (empty sequences are ignored) */
+    void Build(const TArray<FMCS_CommandDefinition>& Commands);
+
+    /** Advances from State on Input and returns the next state */
+    FORCEINLINE int32 Advance(int32 State, EMCS_CommandInput Input) const
+    {
+        const int32 Symbol = static_cast<int32>(Input);
+        return (Symbol < NumSymbols && Transitions.Num() > 0) ? Transitions[State * NumSymbols + Symbol] : 0;
+    }
+
+    /** Returns the indices of commands completed in State */
+    FORCEINLINE TConstArrayView<int32> GetMatches(int32 State) const
+    {
+        return MatchOffsets.IsValidIndex(State + 1)
+            ? TConstArrayView<int32>(MatchList.GetData() + MatchOffsets[State], MatchOffsets[State + 1] - MatchOffsets[State])
+            : TConstArrayView<int32>();
+    }
+
+    /** True when State is partway through at least one command, i.e. more input can still complete one */
+    FORCEINLINE bool HasPendingCommands(int32 State) const
+    {
+        return State != 0 && PendingStates.IsValidIndex(State) && PendingStates[State];
+    }
+
+    int32 NumStates() const { return MatchOffsets.Num() > 0 ? MatchOffsets.Num() - 1 : 0; }
+
+private:
+    /** Dense [State * NumSymbols + Symbol] -> next state table */
+    TArray<int32> Transitions;
+
+    /** Flattened per-state match lists: MatchList[MatchOffsets[S] .. MatchOffsets[S+1]) */
+    TArray<int32> MatchOffsets;
+    TArray<int32> MatchList;
+
+    /** Per state: a command sequence continues past it (the trie node has children) */
+    TBitArray<> PendingStates;
+};
@@ -0,0 +1,66 @@
+/*
+ * ========================================================================
+ * Copyright © 2025 God's Studio
+ * All Rights Reserved.
+ *
+ * Free for all to use, copy, and distribute. I hope you learn from this as I learned creating it.
+ * =============================================================================
+ *
+ * Project: Motion Combat System
+ * This is a combat system inspired by Unreal Engine’s Motion Matching plugin.
+ * Author: Christopher D. Parker
+ * Date: 10-18-2026
+ * =============================================================================
+ * MCS_CommandDefinition.h
+ * Declares FMCS_CommandDefinition, an authored command input sequence mapped to an attack.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include <Enums/EMCS_CommandInput.h>
+#include <Enums/EMCS_AttackTypes.h>
+#include <Enums/EMCS_AttackDirections.h>
+#include "MCS_CommandDefinition.generated.h"
+
+/**
+ * FMCS_CommandDefinition
+ * A fighting-game style command (e.g. Back, Forward, Heavy) and the attack it triggers.
+ */
+USTRUCT(BlueprintType, meta = (DisplayName = "Motion Combat System Command Definition"))
+struct MOTIONCOMBATSYSTEM_API FMCS_CommandDefinition
+{
+    GENERATED_BODY()
+
+    /** Name for debugging and events. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MCS|Command", meta = (DisplayName = "Command Name"))
+    FName CommandName = NAME_None;
+
+    /** Ordered inputs that make up the command (e.g. Forward, Forward for a double tap). */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MCS|Command", meta = (DisplayName = "Sequence"))
+    TArray<EMCS_CommandInput> Sequence;
+
+    /** Maximum time in seconds between the first and last input of the sequence. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MCS|Command", meta = (DisplayName = "Max Duration", ClampMin = "0.0"))
+    float MaxDuration = 0.5f;
+
+    /** Minimum hold time of the final input (only meaningful when the sequence ends with a release, i.e. charge attacks). */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MCS|Command", meta = (DisplayName = "Min Charge Time", ClampMin = "0.0"))
+    float MinChargeTime = 0.f;
+
+    /** Higher priority wins when several commands complete on the same input. Ties go to the longer sequence. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MCS|Command", meta = (DisplayName = "Priority"))
+    int32 Priority = 0;
+
+    /** Attack type passed to PerformAttack. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MCS|Command|Attack", meta = (DisplayName = "Attack Type"))
+    EMCS_AttackType AttackType = EMCS_AttackType::Light;
+
+    /** Attack direction passed to PerformAttack. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MCS|Command|Attack", meta = (DisplayName = "Attack Direction"))
+    EMCS_AttackDirection AttackDirection = EMCS_AttackDirection::Omni;
+
+    /** Optional: a specific row (AttackName) of the active attack set to play instead of letting the chooser decide. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MCS|Command|Attack", meta = (DisplayName = "Attack Name"))
+    FName AttackName = NAME_None;
+};
@@ -0,0 +1,183 @@
+/*
+ * ========================================================================
+ * Copyright © 2025 God's Studio
+ * All Rights Reserved.
+ *
+ * Free for all to use, copy, and distribute. I hope you learn from this as I learned creating it.
+ * =============================================================================
+ *
+ * Project: Motion Combat System
+ * This is a combat system inspired by Unreal Engine’s Motion Matching plugin.
+ * Author: Christopher D. Parker
+ * Date: 10-18-2026
+ * =============================================================================
+ * MCS_CompiledAttackSet.h
+ * Attack rows compiled once per DataTable, and the per-combatant memory aligned with them.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include <Structs/MCS_AttackEntry.h>
+
+class UDataTable;
+
+/**
+ * FMCS_CompiledAttackSet
+ * The rows of one attack DataTable, copied once and shared (read-only) by every combatant
+ * using that table. Choosers select by index into Entries instead of copying rows per query,
+ * so per-combatant state can live in arrays aligned with those indices.
+ *
+ * Entry indices are also partitioned into buckets by (AttackType, AttackDirection, AttackSituation)
+ * so a query only scores the rows that match what was asked for. Omni and Any rows are listed in
+ * every bucket they are compatible with.
+ *
+ * Each bucket is ordered by descending reach (RangeEnd * RangeSlack, the distance past which native
+ * scoring disqualifies a row), so the rows still in range of a target are a prefix found by binary search.
+ */
+struct MOTIONCOMBATSYSTEM_API FMCS_CompiledAttackSet
+{
+    /* Bucket dimensions: every attack type, and the concrete directions / situations (Omni and Any are spread) */
+    static constexpr int32 NumTypes = static_cast<int32>(EMCS_AttackType::Unknown) + 1;
+    static constexpr int32 NumDirections = static_cast<int32>(EMCS_AttackDirection::Omni);
+    static constexpr int32 NumSituations = static_cast<int32>(EMCS_AttackSituations::Any);
+
+    /** Slack past RangeEnd before distance scoring disqualifies an entry (see UMCS_AttackChooser::ComputeDistanceScore) */
+    static constexpr float RangeSlack = 1.25f;
+
+    /** Rows in DataTable order */
+    TArray<FMCS_AttackEntry> Entries;
+
+    /** Path of the table the set was compiled from (None for loose rows); generated scorers are looked up by it */
+    FName SetId;
+
+    /** Rebuilds from a DataTable of FMCS_AttackEntry rows */
+    void Build(const UDataTable& Table);
+
+    /** Rebuilds from a list of entries */
+    void Build(TConstArrayView<FMCS_AttackEntry> InEntries);
+
+    /** Rebuilds from a list of entries, taking ownership of them. Plain data only: safe off the game thread. */
+    void Build(TArray<FMCS_AttackEntry>&& InEntries);
+
+    /**
+     * Writes or reads everything Build derives from Entries (name lookup, buckets, reach), so a cooked
+     * set loads without recomputing it. Entries must already be set when loading.
+     */
+    void SerializeDerived(FArchive& Ar);
+
+    /** Index of the first entry with this AttackName, or INDEX_NONE */
+    int32 FindIndex(FName AttackName) const
+    {
+        const int32* Index = NameToIndex.Find(AttackName);
+        return Index ? *Index : INDEX_NONE;
+    }
+
+    int32 Num() const { return Entries.Num(); }
+
+    /** Hash of every field native scoring reads, in row order; stable across runs (generated scorers embed it) */
+    uint32 ComputeScoringHash() const;
+
+    /**
+     * Indices of the entries of Type usable for Direction in Situation (including Omni / Any rows), farthest reach first.
+     * Direction and Situation must be concrete (not Omni / Any).
+     */
+    TConstArrayView<int32> GetBucket(EMCS_AttackType Type, EMCS_AttackDirection Direction, EMCS_AttackSituations Situation) const;
+
+    /** Indices of every entry of Type, farthest reach first */
+    TConstArrayView<int32> GetTypeBucket(EMCS_AttackType Type) const;
+
+    /** Indices of every entry, farthest reach first */
+    TConstArrayView<int32> GetReachOrder() const { return ReachOrder; }
+
+    /**
+     * The leading part of Candidates (a bucket or GetReachOrder) whose range window, extended by RangeSlack,
+     * still covers Distance: O(log n). A negative Distance (no target) keeps every candidate.
+     */
+    TConstArrayView<int32> ClipToReach(TConstArrayView<int32> Candidates, float Distance) const;
+
+    /** Heap memory owned by the set (row arrays are counted, nested containers inside rows are not) */
+    SIZE_T GetAllocatedSize() const
+    {
+        return Entries.GetAllocatedSize() + NameToIndex.GetAllocatedSize()
+            + BucketStarts.GetAllocatedSize() + BucketIndices.GetAllocatedSize()
+            + TypeStarts.GetAllocatedSize() + TypeIndices.GetAllocatedSize()
+            + Reach.GetAllocatedSize() + ReachOrder.GetAllocatedSize();
+    }
+
+private:
+    /** AttackName -> first entry index */
+    TMap<FName, int32> NameToIndex;
+
+    /* (type, direction, situation) buckets, stored back to back: bucket B is BucketIndices[BucketStarts[B], BucketStarts[B + 1]) */
+    TArray<int32> BucketStarts;
+    TArray<int32> BucketIndices;
+
+    /* Per-type buckets in the same layout */
+    TArray<int32> TypeStarts;
+    TArray<int32> TypeIndices;
+
+    /** RangeEnd * RangeSlack per entry */
+    TArray<float> Reach;
+
+    /** Every entry index, farthest reach first */
+    TArray<int32> ReachOrder;
+
+    /** Rebuilds the buckets and the reach order from Entries */
+    void BuildPartitions();
+};
+
+/**
+ * FMCS_AttackMemory
+ * Per-combatant cooldown and recency timestamps, one per attack entry, padded to a multiple
+ * of 4 so the chooser evaluates them in a single vectorized pass per query.
+ */
+struct MOTIONCOMBATSYSTEM_API FMCS_AttackMemory
+{
+    /** Clears all timestamps and sizes the arrays for NumEntries entries */
+    void Reset(int32 NumEntries);
+
+    /**
+     * Sizes the arrays for Entries, keeping the timestamps of rows that survive (matched by AttackName).
+     * Used when a set is recompiled or its rows are edited, so cooldowns aren't lost.
+     */
+    void Rebuild(TConstArrayView<FMCS_AttackEntry> Entries);
+
+    /** Takes the later cooldown and recency of every row Other has under the same AttackName */
+    void InheritFrom(const FMCS_AttackMemory& Other);
+
+    /** Number of entries the arrays were sized for */
+    int32 Num() const { return NumEntries; }
+
+    SIZE_T GetAllocatedSize() const { return ReadyTime.GetAllocatedSize() + LastUsedTime.GetAllocatedSize() + EntryNames.GetAllocatedSize(); }
+
+    /** Starts the cooldown of Entries[Index] and every entry in its cooldown group, and records recency */
+    void MarkUsed(TConstArrayView<FMCS_AttackEntry> Entries, int32 Index, float WorldTime);
+
+    /** Holds every entry of a cooldown group until at least ReadyAt (groups can span several sets) */
+    void ApplyGroupCooldown(TConstArrayView<FMCS_AttackEntry> Entries, FName CooldownGroup, float ReadyAt);
+
+    /** True when Entries[Index] is off cooldown */
+    bool IsReady(int32 Index, float WorldTime) const
+    {
+        return !ReadyTime.IsValidIndex(Index) || ReadyTime[Index] <= WorldTime;
+    }
+
+    /**
+     * Writes one score penalty per entry: MAX_flt while on cooldown, otherwise RecencyPenalty
+     * fading linearly to 0 over RecencyWindow seconds after the entry was last used.
+     */
+    void ComputePenalties(float WorldTime, float RecencyPenalty, float RecencyWindow, TArray<float>& OutPenalties) const;
+
+private:
+    /** World time each entry becomes available again */
+    TArray<float> ReadyTime;
+
+    /** World time each entry last started */
+    TArray<float> LastUsedTime;
+
+    /** AttackName of each entry, to carry timestamps over when the entries change (unpadded) */
+    TArray<FName> EntryNames;
+
+    int32 NumEntries = 0;
+};
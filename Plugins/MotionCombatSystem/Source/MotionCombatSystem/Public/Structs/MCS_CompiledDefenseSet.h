@@ -0,0 +1,114 @@
+/*
+ * ========================================================================
+ * Copyright © 2025 God's Studio
+ * All Rights Reserved.
+ *
+ * Free for all to use, copy, and distribute. I hope you learn from this as I learned creating it.
+ * =============================================================================
+ *
+ * Project: Motion Combat System
+ * This is a combat system inspired by Unreal Engine’s Motion Matching plugin.
+ * Author: Christopher D. Parker
+ * Date: 10-18-2026
+ * =============================================================================
+ * MCS_CompiledDefenseSet.h
+ * Defense rows compiled once per DataTable into flat columns, and the per-attacker threat they are scored against.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+#include <Structs/MCS_DefenseEntry.h>
+
+class AActor;
+class UDataTable;
+
+/**
+ * FMCS_DefenseThreat
+ * Geometry of one (defender, attacker) pair, computed once per query and shared by every entry.
+ */
+struct MOTIONCOMBATSYSTEM_API FMCS_DefenseThreat
+{
+    /** Distance between the actors */
+    float Distance = 0.f;
+
+    /** Defender forward · direction to the attacker */
+    float FacingDot = 0.f;
+
+    /** Bit (1 << EMCS_AttackDirection) of the side the attack comes from */
+    uint8 DirectionBit = 0;
+
+    bool bValid = false;
+
+    static FMCS_DefenseThreat Make(const AActor* Defender, const AActor* Attacker);
+};
+
+/**
+ * FMCS_CompiledDefenseSet
+ * The rows of one defense DataTable, shared read-only by every defender using it. Scoring inputs
+ * are stored as columns (padded to a multiple of 4) so distance scoring runs 4 entries at a time;
+ * intent and direction are bit masks and required/excluded tags are bitsets over a set-local tag list.
+ */
+struct MOTIONCOMBATSYSTEM_API FMCS_CompiledDefenseSet
+{
+    /** Most distinct tags a set can filter on with bitsets; larger sets fall back to container checks */
+    static constexpr int32 MaxTagBits = 64;
+
+    /** Rows in DataTable order */
+    TArray<FMCS_DefenseEntry> Entries;
+
+    /* Distance window columns: score = clamp(1 - |Dist - RangeMid| * RangeInvExtent, 0, 1) * 50 - 25, or 0 when RangeInvExtent is 0 */
+    TArray<float> RangeMid;
+    TArray<float> RangeInvExtent;
+
+    /** Per entry: 1 << EMCS_DefenseIntent */
+    TArray<uint8> IntentBits;
+
+    /** Per entry: directions the entry is effective against (1 << EMCS_AttackDirection); 0 for Omni */
+    TArray<uint8> DirectionBits;
+
+    /** Per entry required/excluded tag bits over TagList */
+    TArray<uint64> RequiredTagBits;
+    TArray<uint64> ExcludedTagBits;
+
+    /** Every tag referenced by the set's required/excluded containers */
+    TArray<FGameplayTag> TagList;
+
+    /** True when the set references more than MaxTagBits tags */
+    bool bTagOverflow = false;
+
+    /** Rebuilds from a DataTable of FMCS_DefenseEntry rows */
+    void Build(const UDataTable& Table);
+
+    /** Rebuilds from a list of entries */
+    void Build(TConstArrayView<FMCS_DefenseEntry> InEntries);
+
+    /** Rebuilds from a list of entries, taking ownership of them. Plain data only: safe off the game thread. */
+    void Build(TArray<FMCS_DefenseEntry>&& InEntries);
+
+    /** Writes or reads the columns and tag bitsets Build derives from Entries. Entries must already be set when loading. */
+    void SerializeDerived(FArchive& Ar);
+
+    /**
+     * Gathers the tags an actor owns (via IGameplayTagAssetInterface) as TagList bits.
+     * Returns false if the actor exposes no tags, in which case tag filters are skipped.
+     */
+    bool GatherOwnedTags(const AActor* Actor, uint64& OutOwnedBits, FGameplayTagContainer& OutOwnedTags) const;
+
+    /** True when an actor owning OwnedBits / OwnedTags may use Entries[Index] */
+    bool PassesTags(int32 Index, uint64 OwnedBits, const FGameplayTagContainer& OwnedTags) const;
+
+    /** Writes the distance score of every entry for Distance (4 entries per step) */
+    void ComputeDistanceScores(float Distance, TArray<float>& OutScores) const;
+
+    int32 Num() const { return Entries.Num(); }
+
+    /** Heap memory owned by the set (row arrays are counted, nested containers inside rows are not) */
+    SIZE_T GetAllocatedSize() const
+    {
+        return Entries.GetAllocatedSize() + RangeMid.GetAllocatedSize() + RangeInvExtent.GetAllocatedSize()
+            + IntentBits.GetAllocatedSize() + DirectionBits.GetAllocatedSize()
+            + RequiredTagBits.GetAllocatedSize() + ExcludedTagBits.GetAllocatedSize() + TagList.GetAllocatedSize();
+    }
+};
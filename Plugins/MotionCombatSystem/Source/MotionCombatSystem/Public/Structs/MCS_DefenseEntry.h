@@ -147,6 +147,15 @@ USTRUCT(BlueprintType, meta = (DisplayName = "Motion Combat System Defense Entry
             ToolTip = "The valid distance range (in cm) where this defense can be used effectively."))
     FVector2D Range = FVector2D(0.f, 1000.f);
 
+    /**
+     * @brief Stamina required to perform this defense.
+     * The chooser skips this entry while the defender has less; the caller spends it when the montage plays.
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MCS|Defense",
+        meta = (DisplayName = "Stamina Cost", ClampMin = "0.0",
+            ToolTip = "Stamina required to perform this defense. Entries costing more than the defender's current stamina are skipped."))
+    float StaminaCost = 0.f;
+
     /* =====================================================================
      * Tag Filtering
      * ===================================================================== */
@@ -49,12 +49,13 @@ public:
      *
      * Each row defines a defensive action such as block, dodge, duck, roll, or parry.
      * The Defense Chooser will score and select entries from this table during gameplay.
+     * Soft reference: tables covered by a cooked combat database are never loaded.
      */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MCS|Defense",
         meta = (DisplayName = "Defense Data Table",
             ToolTip = "DataTable containing FMCS_DefenseEntry rows that define available defense actions.",
             RowType = "/Script/MotionCombatSystem/Structs/FMCS_DefenseEntry"))
-    TObjectPtr<UDataTable> DefenseDataTable = nullptr;
+    TSoftObjectPtr<UDataTable> DefenseDataTable;
 
     /**
      * @brief The Defense Chooser instance responsible for selecting the optimal defense action.
@@ -0,0 +1,122 @@
+/*
+ * ========================================================================
+ * Copyright © 2025 God's Studio
+ * All Rights Reserved.
+ *
+ * Free for all to use, copy, and distribute. I hope you learn from this as I learned creating it.
+ * =============================================================================
+ *
+ * Project: Motion Combat System
+ * This is a combat system inspired by Unreal Engine’s Motion Matching plugin.
+ * Author: Christopher D. Parker
+ * Date: 10-18-2026
+ * =============================================================================
+ * MCS_HitConfirm.h
+ * Declares FMCS_ConfirmedHit, a hit the server reacted to, and FMCS_HitConfirmBatch, the compact
+ * packet that carries every confirmed hit of a frame to one client.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include <Structs/MCS_HitReaction.h>
+#include <Enums/EMCS_HitReactionLevel.h>
+#include "MCS_HitConfirm.generated.h"
+
+class AActor;
+class UPackageMap;
+
+/**
+ * A hit confirmed by the server, as seen by the client that received it.
+ */
+USTRUCT(BlueprintType, meta = (DisplayName = "Motion Combat System Confirmed Hit"))
+struct MOTIONCOMBATSYSTEM_API FMCS_ConfirmedHit
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "MCS|Hit Confirm")
+    TObjectPtr<AActor> Attacker = nullptr;
+
+    UPROPERTY(BlueprintReadOnly, Category = "MCS|Hit Confirm")
+    TObjectPtr<AActor> Victim = nullptr;
+
+    /** Name of the attack that landed (look it up in the attacker's attack set for effects) */
+    UPROPERTY(BlueprintReadOnly, Category = "MCS|Hit Confirm")
+    FName AttackName = NAME_None;
+
+    /** Impact point, rebuilt from the victim's replicated location (accurate to a centimeter relative to it) */
+    UPROPERTY(BlueprintReadOnly, Category = "MCS|Hit Confirm")
+    FVector ImpactPoint = FVector::ZeroVector;
+
+    /** Bone struck on the victim's mesh, or None */
+    UPROPERTY(BlueprintReadOnly, Category = "MCS|Hit Confirm")
+    FName BoneName = NAME_None;
+
+    UPROPERTY(BlueprintReadOnly, Category = "MCS|Hit Confirm")
+    EPGAS_HitSeverity Severity = EPGAS_HitSeverity::Light;
+
+    /** Reaction the server played after poise */
+    UPROPERTY(BlueprintReadOnly, Category = "MCS|Hit Confirm")
+    EMCS_HitReactionLevel Level = EMCS_HitReactionLevel::None;
+};
+
+/**
+ * Every confirmed hit of a frame for one connection, sent as a single RPC parameter.
+ * Actors and attack names are written once per batch and hits refer to them by index, so an area
+ * attack landing on a dozen combatants costs one attacker reference and one attack name, plus a few
+ * bytes per victim: packed indices, the impact as a centimeter offset from the victim, the victim's
+ * bone index, and severity and reaction level in 5 bits.
+ */
+USTRUCT()
+struct MOTIONCOMBATSYSTEM_API FMCS_HitConfirmBatch
+{
+    GENERATED_BODY()
+
+    /** Starts an empty batch (keeps the allocations) */
+    void Reset();
+
+    /** Number of hits in the batch */
+    int32 Num() const { return Hits.Num(); }
+
+    /** Packs a hit; the bone name is stored as its index on the victim's mesh */
+    void Add(AActor* Attacker, AActor* Victim, FName AttackName, const FVector& ImpactPoint, FName BoneName,
+        EPGAS_HitSeverity Severity, EMCS_HitReactionLevel Level);
+
+    /** Unpacks hit Index; false if its victim isn't replicated to this client (yet) */
+    bool Unpack(int32 Index, FMCS_ConfirmedHit& OutHit) const;
+
+    bool NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess);
+
+    /** Upper bound on the hits, actors and attack names a received batch may claim */
+    static constexpr int32 MaxEntries = 256;
+
+private:
+    /** One hit, referring to the tables below */
+    struct FEntry
+    {
+        int32 Attacker = INDEX_NONE;
+        int32 Victim = INDEX_NONE;
+        int32 Attack = INDEX_NONE;
+        int32 BoneIndex = INDEX_NONE;
+        FVector ImpactOffset = FVector::ZeroVector;
+        EPGAS_HitSeverity Severity = EPGAS_HitSeverity::Light;
+        EMCS_HitReactionLevel Level = EMCS_HitReactionLevel::None;
+    };
+
+    UPROPERTY()
+    TArray<TObjectPtr<AActor>> Actors;
+
+    UPROPERTY()
+    TArray<FName> AttackNames;
+
+    TArray<FEntry> Hits;
+};
+
+template<>
+struct TStructOpsTypeTraits<FMCS_HitConfirmBatch> : public TStructOpsTypeTraitsBase2<FMCS_HitConfirmBatch>
+{
+    enum
+    {
+        WithNetSerializer = true
+    };
+};
@@ -0,0 +1,74 @@
+/*
+ * ========================================================================
+ * Copyright © 2025 God's Studio
+ * All Rights Reserved.
+ *
+ * Free for all to use, copy, and distribute. I hope you learn from this as I learned creating it.
+ * =============================================================================
+ *
+ * Project: Motion Combat System
+ * This is a combat system inspired by Unreal Engine’s Motion Matching plugin.
+ * Author: Christopher D. Parker
+ * Date: 10-18-2026
+ * =============================================================================
+ * MCS_InputHistory.h
+ * Fixed-size, timestamped ring buffer of command inputs.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include <Enums/EMCS_CommandInput.h>
+
+/**
+ * A single timestamped input event.
+ */
+struct FMCS_InputEvent
+{
+    EMCS_CommandInput Input = EMCS_CommandInput::MAX;
+
+    /** Platform time (seconds) the input was received at */
+    double Timestamp = 0.0;
+
+    /** For releases: how long the button was held */
+    float HoldTime = 0.f;
+};
+
+/**
+ * Ring buffer of the most recent input events. Oldest events are overwritten.
+ */
+struct FMCS_InputHistory
+{
+    static constexpr int32 Capacity = 32;
+
+    /** Appends an event, overwriting the oldest when full */
+    void Push(const FMCS_InputEvent& Event)
+    {
+        Events[Head] = Event;
+        Head = (Head + 1) % Capacity;
+        Count = FMath::Min(Count + 1, Capacity);
+    }
+
+    /**
+     * Returns an event counting back from the newest one.
+     * @param Age - 0 for the newest event, 1 for the one before, ...
+     */
+    const FMCS_InputEvent& GetFromNewest(int32 Age) const
+    {
+        check(Age >= 0 && Age < Count);
+        return Events[(Head - 1 - Age + Capacity) % Capacity];
+    }
+
+    int32 Num() const { return Count; }
+
+    void Reset()
+    {
+        Head = 0;
+        Count = 0;
+    }
+
+private:
+    FMCS_InputEvent Events[Capacity];
+    int32 Head = 0;
+    int32 Count = 0;
+};
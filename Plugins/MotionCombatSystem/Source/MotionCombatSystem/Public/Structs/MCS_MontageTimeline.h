@@ -0,0 +1,72 @@
+/*
+ * ========================================================================
+ * Copyright © 2025 God's Studio
+ * All Rights Reserved.
+ *
+ * Free for all to use, copy, and distribute. I hope you learn from this as I learned creating it.
+ * =============================================================================
+ *
+ * Project: Motion Combat System
+ * This is a combat system inspired by Unreal Engine’s Motion Matching plugin.
+ * Author: Christopher D. Parker
+ * Date: 10-18-2026
+ * =============================================================================
+ * MCS_MontageTimeline.h
+ * The MCS notify windows of a montage, extracted once so gameplay can predict when they open,
+ * and the reach of its hitbox windows, baked once so sweeps can be skipped when nobody is near.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include <AnimNotifyStates/AnimNotifyState_MCSWindow.h>
+
+class UAnimMontage;
+
+/**
+ * One UAnimNotifyState_MCSWindow placed on a montage, in montage time (seconds at play rate 1).
+ */
+struct FMCS_MontageWindow
+{
+    EMCS_AnimEventType EventType = EMCS_AnimEventType::None;
+    FName Id = NAME_None;
+    float StartTime = 0.f;
+    float EndTime = 0.f;
+
+    /**
+     * Hitbox windows: mesh component space box covering both hitbox sockets over the whole window
+     * plus the sweep radius. Invalid when it could not be baked (e.g. a socket only the mesh defines).
+     */
+    FBox Reach = FBox(ForceInit);
+};
+
+/**
+ * FMCS_MontageTimeline
+ * Every MCS window of one montage, sorted by start time. Built once per montage and shared.
+ */
+struct MOTIONCOMBATSYSTEM_API FMCS_MontageTimeline
+{
+    TArray<FMCS_MontageWindow> Windows;
+
+    /** Rebuilds from the montage's notify track */
+    void Build(const UAnimMontage& Montage);
+
+    /** First window of a type that has not ended at Position, or null */
+    const FMCS_MontageWindow* FindNextWindow(EMCS_AnimEventType EventType, float Position) const;
+
+    /** First window that deals damage (hitbox or area of effect) and has not ended at Position, or null */
+    const FMCS_MontageWindow* FindNextImpact(float Position) const;
+
+    /**
+     * Union of the reach of every hitbox window open at Position (mesh component space).
+     * Invalid if none is open or one of them has no baked reach; callers then sweep unconditionally.
+     */
+    FBox FindReach(float Position) const;
+
+    bool IsEmpty() const { return Windows.IsEmpty(); }
+
+    /** Writes or reads the windows (cooked combat databases) */
+    void Serialize(FArchive& Ar);
+
+    SIZE_T GetAllocatedSize() const { return Windows.GetAllocatedSize(); }
+};
@@ -0,0 +1,183 @@
+/*
+ * ========================================================================
+ * Copyright © 2025 God's Studio
+ * All Rights Reserved.
+ *
+ * Free for all to use, copy, and distribute. I hope you learn from this as I learned creating it.
+ * =============================================================================
+ *
+ * Project: Motion Combat System
+ * This is a combat system inspired by Unreal Engine’s Motion Matching plugin.
+ * Author: Christopher D. Parker
+ * Date: 10-18-2026
+ * =============================================================================
+ * MCS_AttackDatabaseSubsystem.h
+ *
+ * Description:
+ *  World subsystem that compiles attack and defense DataTables (FMCS_CompiledAttackSet,
+ *  FMCS_CompiledDefenseSet) once and shares the result between every combatant that uses
+ *  the table, and caches the MCS notify timeline of attack montages. Compiled sets live as
+ *  long as the world, so DataTable edits made between PIE sessions are always picked up;
+ *  in the editor an attack table edited during PIE is recompiled on the spot.
+ *  Tables (and montages) covered by a cooked UMCS_CombatDatabase are served from it instead
+ *  of being compiled at runtime. Once the map's actors are initialized (still during the load,
+ *  before BeginPlay), every table used by the combat components of placed actors (and of the
+ *  configured spawned classes) is compiled up front: rows are copied on the game thread and the
+ *  copies compiled on worker threads, so components find their data ready in BeginPlay.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include <Structs/MCS_CompiledAttackSet.h>
+#include <Structs/MCS_CompiledDefenseSet.h>
+#include <Structs/MCS_MontageTimeline.h>
+#include <Structs/MCS_HitReaction.h>
+#include "MCS_AttackDatabaseSubsystem.generated.h"
+
+class UDataTable;
+class UAnimMontage;
+class UMCS_CombatDatabase;
+class AActor;
+struct FActorsInitializedParams;
+
+/** Broadcast after an attack DataTable was recompiled; users should fetch the new set from GetCompiledSet */
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnMCSAttackTableRecompiled, const UDataTable*);
+
+/** Broadcast after a defense DataTable was recompiled; users should fetch the new set from GetCompiledDefenseSet */
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnMCSDefenseTableRecompiled, const UDataTable*);
+
+/**
+ * World subsystem caching compiled attack and defense sets per DataTable.
+ */
+UCLASS(Config = Game, meta = (DisplayName = "Motion Combat Attack Database Subsystem"))
+class MOTIONCOMBATSYSTEM_API UMCS_AttackDatabaseSubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    /*
+     * Properties
+     */
+
+    /** Cooked databases loaded with the world ([/Script/MotionCombatSystem.MCS_AttackDatabaseSubsystem] in DefaultGame.ini) */
+    UPROPERTY(Config)
+    TArray<TSoftObjectPtr<UMCS_CombatDatabase>> CookedDatabases;
+
+    /** Serve cooked data in editor worlds too (off by default so DataTable edits show up in PIE) */
+    UPROPERTY(Config)
+    bool bUseCookedDatabasesInEditor = false;
+
+    /** Compile every table used by the level's combatants while the map loads, before any actor's BeginPlay */
+    UPROPERTY(Config)
+    bool bPrewarmOnLoad = true;
+
+    /** Combatant classes spawned at runtime whose tables are prewarmed too (the game mode's default pawn always is) */
+    UPROPERTY(Config)
+    TArray<TSoftClassPtr<AActor>> PrewarmActorClasses;
+
+    /*
+     * Functions
+     */
+
+    /** Registers a cooked database; tables it contains are served from it from now on */
+    UFUNCTION(BlueprintCallable, Category = "MCS|Database")
+    void AddCookedDatabase(UMCS_CombatDatabase* Database);
+
+    /**
+     * Returns the compiled set for a DataTable, compiling it on first use. Null for a null table.
+     * A table covered by a cooked database is served by path and never loaded.
+     */
+    TSharedPtr<const FMCS_CompiledAttackSet> GetCompiledSet(const TSoftObjectPtr<UDataTable>& Table);
+
+    /** Returns the compiled defense set for a DataTable of FMCS_DefenseEntry rows, compiling it on first use */
+    TSharedPtr<const FMCS_CompiledDefenseSet> GetCompiledDefenseSet(const TSoftObjectPtr<UDataTable>& Table);
+
+    /** Returns the MCS window timeline of a montage, extracting it on first use. Null for a null montage. */
+    TSharedPtr<const FMCS_MontageTimeline> GetMontageTimeline(const UAnimMontage* Montage);
+
+    /** Returns the rows of a hit reaction DataTable, read once and shared. Null for a null table. */
+    TSharedPtr<const TArray<FMCS_HitReaction>> GetHitReactions(const TSoftObjectPtr<UDataTable>& Table);
+
+    /**
+     * Compiles the given tables, and the timelines of every montage their rows play. Rows are copied and
+     * timelines baked on the game thread; only the copied rows are compiled in parallel.
+     * Tables already cached or covered by a cooked database are skipped.
+     */
+    void Prewarm(TConstArrayView<TSoftObjectPtr<UDataTable>> AttackTables, TConstArrayView<TSoftObjectPtr<UDataTable>> DefenseTables,
+        TConstArrayView<TSoftObjectPtr<UDataTable>> ReactionTables);
+
+    /** Bytes held by the compiled set of a table (0 if it was never compiled) */
+    SIZE_T GetCompiledSetSize(const TSoftObjectPtr<UDataTable>& Table) const;
+    SIZE_T GetCompiledDefenseSetSize(const TSoftObjectPtr<UDataTable>& Table) const;
+
+    /** Bytes held by every compiled set and montage timeline, including the maps */
+    SIZE_T GetAllocatedSize() const;
+
+    /** Number of cached montage timelines */
+    int32 NumMontageTimelines() const { return MontageTimelines.Num(); }
+
+    /** Convenience accessor from any world context object */
+    static UMCS_AttackDatabaseSubsystem* Get(const UObject* WorldContextObject);
+
+    /** Fired when a cached attack table is edited and recompiled (editor only) */
+    FOnMCSAttackTableRecompiled OnAttackTableRecompiled;
+
+    /** Fired when a cached defense table is edited and recompiled (editor only) */
+    FOnMCSDefenseTableRecompiled OnDefenseTableRecompiled;
+
+    // =========================
+    // Subsystem lifecycle overrides
+    // =========================
+
+    virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+
+private:
+    /*
+     * Properties
+     */
+
+    /** DataTable path -> compiled rows (by path, so cooked sets are found without loading their table) */
+    TMap<FSoftObjectPath, TSharedPtr<const FMCS_CompiledAttackSet>> CompiledSets;
+
+    /** DataTable path -> compiled defense rows */
+    TMap<FSoftObjectPath, TSharedPtr<const FMCS_CompiledDefenseSet>> CompiledDefenseSets;
+
+    /** Montage -> notify windows */
+    TMap<TObjectKey<UAnimMontage>, TSharedPtr<const FMCS_MontageTimeline>> MontageTimelines;
+
+    /** DataTable path -> hit reaction rows */
+    TMap<FSoftObjectPath, TSharedPtr<const TArray<FMCS_HitReaction>>> ReactionSets;
+
+    /** Registered cooked databases, searched before compiling anything */
+    UPROPERTY()
+    TArray<TObjectPtr<UMCS_CombatDatabase>> Databases;
+
+    /** FWorldDelegates::OnWorldInitializedActors binding that starts the prewarm */
+    FDelegateHandle ActorsInitializedHandle;
+
+    /*
+     * Functions
+     */
+
+    /** Prewarms the tables of this world's combatants once its actors are initialized, before BeginPlay */
+    void HandleWorldActorsInitialized(const FActorsInitializedParams& Params);
+
+    /** Caches a freshly compiled attack set (and watches its table for edits in the editor) */
+    void AddCompiledSet(const UDataTable* Table, const TSharedRef<FMCS_CompiledAttackSet>& Compiled);
+
+    /** Caches a freshly compiled defense set (and watches its table for edits in the editor) */
+    void AddCompiledDefenseSet(const UDataTable* Table, const TSharedRef<FMCS_CompiledDefenseSet>& Compiled);
+
+#if WITH_EDITOR
+    /** Rebuilds the compiled set (and its partitions) of an attack table edited while the world runs */
+    void HandleAttackTableChanged(const UDataTable* Table);
+
+    /** Rebuilds the compiled set of a defense table edited while the world runs */
+    void HandleDefenseTableChanged(const UDataTable* Table);
+#endif
+};
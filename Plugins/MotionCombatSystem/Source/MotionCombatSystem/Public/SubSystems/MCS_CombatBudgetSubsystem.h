@@ -0,0 +1,215 @@
+/*
+ * ========================================================================
+ * Copyright © 2025 God's Studio
+ * All Rights Reserved.
+ *
+ * Free for all to use, copy, and distribute. I hope you learn from this as I learned creating it.
+ * =============================================================================
+ *
+ * Project: Motion Combat System
+ * This is a combat system inspired by Unreal Engine’s Motion Matching plugin.
+ * Author: Christopher D. Parker
+ * Date: 10-18-2026
+ * =============================================================================
+ * MCS_CombatBudgetSubsystem.h
+ *
+ * Description:
+ *  Tickable world subsystem that keeps Motion Combat work inside a per-frame budget.
+ *  Choosers, hitbox sweeps, target scans, hit reactions and combat events time themselves
+ *  with FMCS_BudgetScope. When the smoothed cost stays over budget the governor steps
+ *  quality down one level at a time, in this order:
+ *    1. Hitbox substeps      (sweeps use Degraded Substep Count)
+ *    2. Scan frequency       (target scan interval scaled up)
+ *    3. Reaction admission   (at most N hit reaction montages start per frame)
+ *    4. AI decision rate     (far, AI-controlled combatants decide every Nth frame)
+ *    5. Debug draws          (MCS debug drawing suppressed)
+ *  It recovers one level at a time once cost stays under a lower threshold (hysteresis).
+ *  The level is published to "stat MotionCombat" and the CSV profiler.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "MCS_CombatBudgetSubsystem.generated.h"
+
+class AActor;
+
+
+/**
+ * Work categories measured against the combat frame budget.
+ */
+UENUM(BlueprintType)
+enum class EMCS_BudgetCategory : uint8
+{
+    Chooser     UMETA(DisplayName = "Choosers"),
+    Sweeps      UMETA(DisplayName = "Hitbox Sweeps"),
+    Scans       UMETA(DisplayName = "Target Scans"),
+    Reactions   UMETA(DisplayName = "Hit Reactions"),
+    Events      UMETA(DisplayName = "Combat Events"),
+    MAX         UMETA(Hidden)
+};
+
+
+/**
+ * Quality levels, each one including every level below it.
+ */
+UENUM(BlueprintType)
+enum class EMCS_DegradationLevel : uint8
+{
+    None                UMETA(DisplayName = "None"),
+    HitboxSubsteps      UMETA(DisplayName = "Reduced Hitbox Substeps"),
+    ScanFrequency       UMETA(DisplayName = "Reduced Scan Frequency"),
+    ReactionAdmission   UMETA(DisplayName = "Limited Reaction Montages"),
+    AIDecisionRate      UMETA(DisplayName = "Reduced AI Decision Rate"),
+    DebugDraws          UMETA(DisplayName = "Debug Draws Off")
+};
+
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnMCSDegradationChanged, EMCS_DegradationLevel);
+
+
+/**
+ * Tickable world subsystem that governs combat cost per frame.
+ */
+UCLASS(meta = (DisplayName = "Motion Combat Budget Subsystem"))
+class MOTIONCOMBATSYSTEM_API UMCS_CombatBudgetSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    /*
+     * Properties
+     */
+
+    /** Disable to always run at full quality (cost is still measured) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MCS|Budget")
+    bool bEnabled = true;
+
+    /** Milliseconds of combat work allowed per frame */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MCS|Budget", meta = (ClampMin = "0.1"))
+    float FrameBudgetMs = 2.0f;
+
+    /** Weight of the newest frame in the smoothed cost (0..1) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MCS|Budget", meta = (ClampMin = "0.01", ClampMax = "1.0"))
+    float CostSmoothing = 0.1f;
+
+    /** Consecutive over-budget frames before stepping down a level */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MCS|Budget", meta = (ClampMin = "1"))
+    int32 StepDownFrames = 10;
+
+    /** Fraction of the budget the cost must stay under to recover a level */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MCS|Budget", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+    float RecoverFraction = 0.7f;
+
+    /** Consecutive frames under the recovery threshold before stepping up a level */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MCS|Budget", meta = (ClampMin = "1"))
+    int32 StepUpFrames = 60;
+
+    /** Hitbox substeps used from the Hitbox Substeps level */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MCS|Budget|Knobs", meta = (ClampMin = "1"))
+    int32 DegradedSubstepCount = 1;
+
+    /** Target scan interval multiplier from the Scan Frequency level */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MCS|Budget|Knobs", meta = (ClampMin = "1.0"))
+    float ScanIntervalScale = 2.f;
+
+    /** Hit reaction montages that may start per frame from the Reaction Admission level */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MCS|Budget|Knobs", meta = (ClampMin = "0"))
+    int32 MaxReactionMontagesPerFrame = 2;
+
+    /** AI combatants farther than this from every local player are low significance */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MCS|Budget|Knobs", meta = (ClampMin = "0.0"))
+    float LowSignificanceDistance = 2500.f;
+
+    /** Low-significance AI decide once every this many frames from the AI Decision Rate level */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MCS|Budget|Knobs", meta = (ClampMin = "1"))
+    int32 LowSignificanceDecisionInterval = 4;
+
+    /** Broadcast when the degradation level changes */
+    FOnMCSDegradationChanged OnDegradationChanged;
+
+    /*
+     * Functions
+     */
+
+    UFUNCTION(BlueprintPure, Category = "MCS|Budget")
+    EMCS_DegradationLevel GetDegradationLevel() const { return Level; }
+
+    /** Smoothed combat cost per frame in milliseconds */
+    UFUNCTION(BlueprintPure, Category = "MCS|Budget")
+    float GetSmoothedCostMs() const { return SmoothedCostMs; }
+
+    /** Adds measured work to the current frame (used by FMCS_BudgetScope) */
+    void AddCost(EMCS_BudgetCategory Category, uint64 Cycles) { FrameCycles[static_cast<int32>(Category)] += Cycles; }
+
+    /* Knob queries, in degradation order */
+
+    /** Hitbox substeps to use instead of Requested */
+    int32 GetSubstepCount(int32 Requested) const;
+
+    /** Multiplier for the target scan interval */
+    float GetScanIntervalScale() const;
+
+    /** Reserves a reaction montage start this frame; false when the per-frame allowance is used up */
+    bool AdmitReactionMontage();
+
+    /** False when an AI combatant should skip this frame's decision */
+    bool ShouldRunAIDecision(const AActor* Actor) const;
+
+    /** False while debug draws are suppressed */
+    bool AllowDebugDraw() const { return !IsAtLeast(EMCS_DegradationLevel::DebugDraws); }
+
+    /** Convenience accessor from any world context object */
+    static UMCS_CombatBudgetSubsystem* Get(const UObject* WorldContextObject);
+
+    // =========================
+    // Subsystem lifecycle overrides
+    // =========================
+
+    virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+private:
+    /*
+     * Properties
+     */
+
+    EMCS_DegradationLevel Level = EMCS_DegradationLevel::None;
+
+    /** Work recorded since the last tick, per category */
+    uint64 FrameCycles[static_cast<int32>(EMCS_BudgetCategory::MAX)] = {};
+
+    float SmoothedCostMs = 0.f;
+
+    /** Consecutive frames over budget / under the recovery threshold */
+    int32 OverBudgetFrames = 0;
+    int32 UnderBudgetFrames = 0;
+
+    /** Reaction montages started this frame */
+    int32 ReactionMontagesThisFrame = 0;
+
+    /*
+     * Functions
+     */
+
+    bool IsAtLeast(EMCS_DegradationLevel Threshold) const { return Level >= Threshold; }
+
+    void SetLevel(EMCS_DegradationLevel NewLevel);
+};
+
+
+/**
+ * Times a block of combat work and charges it to the world's budget governor.
+ * Costs nothing beyond two cycle reads when the governor exists; does nothing without one.
+ */
+struct MOTIONCOMBATSYSTEM_API FMCS_BudgetScope
+{
+    FMCS_BudgetScope(const UObject* WorldContextObject, EMCS_BudgetCategory InCategory);
+    ~FMCS_BudgetScope();
+
+private:
+    UMCS_CombatBudgetSubsystem* Governor = nullptr;
+    EMCS_BudgetCategory Category;
+    uint64 StartCycles = 0;
+};
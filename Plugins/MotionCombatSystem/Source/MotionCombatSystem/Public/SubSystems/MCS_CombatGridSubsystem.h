@@ -0,0 +1,173 @@
+/*
+ * ========================================================================
+ * Copyright © 2025 God's Studio
+ * All Rights Reserved.
+ *
+ * Free for all to use, copy, and distribute. I hope you learn from this as I learned creating it.
+ * =============================================================================
+ *
+ * Project: Motion Combat System
+ * This is a combat system inspired by Unreal Engine’s Motion Matching plugin.
+ * Author: Christopher D. Parker
+ * Date: 10-18-2026
+ * =============================================================================
+ * MCS_CombatGridSubsystem.h
+ *
+ * Description:
+ *  World subsystem holding a uniform 2D hash grid of registered combatants.
+ *  Combatant positions, collision cylinders and teams are snapshotted into flat arrays
+ *  (structure of arrays) the first time the grid is queried in a frame, so projectile and
+ *  area-of-effect resolution can run broad-phase and distance tests without physics overlaps.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "MCS_CombatGridSubsystem.generated.h"
+
+class AActor;
+
+
+/**
+ * World subsystem that spatially hashes combatants for combat queries.
+ */
+UCLASS(meta = (DisplayName = "Motion Combat Grid Subsystem"))
+class MOTIONCOMBATSYSTEM_API UMCS_CombatGridSubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    /*
+     * Constants
+     */
+
+    /** Team value used for actors that don't implement IGenericTeamAgentInterface */
+    static constexpr uint8 NoTeam = 255;
+
+    /*
+     * Functions
+     */
+
+    /** Adds an actor to the grid. Safe to call more than once. */
+    UFUNCTION(BlueprintCallable, Category = "MCS|Grid")
+    void RegisterCombatant(AActor* Combatant);
+
+    /** Removes an actor from the grid */
+    UFUNCTION(BlueprintCallable, Category = "MCS|Grid")
+    void UnregisterCombatant(AActor* Combatant);
+
+    /** Rebuilds the snapshot and cell table if it hasn't been built this frame */
+    void RebuildIfStale();
+
+    /**
+     * Broad phase: appends the snapshot index of every combatant whose cell overlaps the box.
+     * Callers must run their own narrow-phase test using the accessors below.
+     */
+    void GatherCandidates(const FBox& Bounds, TArray<int32>& OutIndices);
+
+    /** Number of combatants in the current snapshot */
+    int32 Num() const { return Actors.Num(); }
+
+    /** Largest collision radius in the current snapshot (used to pad broad-phase bounds) */
+    float GetMaxRadius() const { return MaxRadius; }
+
+    /** Largest collision half height in the current snapshot */
+    float GetMaxHalfHeight() const { return MaxHalfHeight; }
+
+    /* Snapshot accessors (valid until the next rebuild) */
+    const TArray<float>& GetPositionsX() const { return PosX; }
+    const TArray<float>& GetPositionsY() const { return PosY; }
+    const TArray<float>& GetPositionsZ() const { return PosZ; }
+    const TArray<float>& GetRadii() const { return Radii; }
+    const TArray<float>& GetHalfHeights() const { return HalfHeights; }
+    const TArray<uint8>& GetTeams() const { return Teams; }
+
+    FVector GetLocation(int32 Index) const { return FVector(PosX[Index], PosY[Index], PosZ[Index]); }
+    AActor* GetActor(int32 Index) const { return Actors[Index].Get(); }
+
+    /** Snapshot index of an actor, or INDEX_NONE if it isn't in the current snapshot */
+    int32 FindIndex(const AActor* Actor) const
+    {
+        const int32* Index = ActorIndices.Find(Actor);
+        return Index ? *Index : INDEX_NONE;
+    }
+
+    /** Team id of an actor via IGenericTeamAgentInterface, or NoTeam */
+    static uint8 GetTeamOf(const AActor* Actor);
+
+    /** Returns true if an attack from InstigatorTeam may affect VictimTeam */
+    static bool CanAffectTeam(uint8 InstigatorTeam, uint8 VictimTeam, bool bFriendlyFire)
+    {
+        return bFriendlyFire || InstigatorTeam == NoTeam || VictimTeam == NoTeam || InstigatorTeam != VictimTeam;
+    }
+
+    /** Bytes held by the grid columns and cell table */
+    SIZE_T GetAllocatedSize() const;
+
+    // =========================
+    // Subsystem lifecycle overrides
+    // =========================
+
+    virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+    virtual void Deinitialize() override;
+
+    /*
+     * Properties
+     */
+
+    /** Edge length of a grid cell (cm). Roughly the largest common query radius works well. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MCS|Grid", meta = (ClampMin = "100.0"))
+    float CellSize = 500.f;
+
+private:
+    /*
+     * Properties
+     */
+
+    /** Registered combatants */
+    TArray<TWeakObjectPtr<AActor>> Registered;
+
+    /** Snapshot (structure of arrays, same index in every array) */
+    TArray<TWeakObjectPtr<AActor>> Actors;
+    TArray<float> PosX;
+    TArray<float> PosY;
+    TArray<float> PosZ;
+    TArray<float> Radii;
+    TArray<float> HalfHeights;
+    TArray<uint8> Teams;
+
+    /** Actor -> snapshot index */
+    TMap<const AActor*, int32> ActorIndices;
+
+    /** Snapshot indices sorted by cell */
+    TArray<int32> SortedIndices;
+
+    /** Cell key -> (first position in SortedIndices, count) */
+    TMap<uint64, FIntPoint> CellRanges;
+
+    /** Scratch buffer used while sorting */
+    TArray<TPair<uint64, int32>> KeyScratch;
+
+    float MaxRadius = 0.f;
+    float MaxHalfHeight = 0.f;
+
+    /** Frame the snapshot was built on */
+    uint64 BuiltFrame = MAX_uint64;
+
+    /*
+     * Functions
+     */
+
+    FIntPoint GetCell(float X, float Y) const
+    {
+        return FIntPoint(FMath::FloorToInt(X / CellSize), FMath::FloorToInt(Y / CellSize));
+    }
+
+    static uint64 MakeCellKey(const FIntPoint& Cell)
+    {
+        return (static_cast<uint64>(static_cast<uint32>(Cell.X)) << 32) | static_cast<uint32>(Cell.Y);
+    }
+
+    void Rebuild();
+};
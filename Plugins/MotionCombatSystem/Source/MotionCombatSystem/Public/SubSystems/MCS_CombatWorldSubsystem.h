@@ -0,0 +1,185 @@
+/*
+ * ========================================================================
+ * Copyright © 2025 God's Studio
+ * All Rights Reserved.
+ *
+ * Free for all to use, copy, and distribute. I hope you learn from this as I learned creating it.
+ * =============================================================================
+ *
+ * Project: Motion Combat System
+ * This is a combat system inspired by Unreal Engine’s Motion Matching plugin.
+ * Author: Christopher D. Parker
+ * Date: 10-18-2026
+ * =============================================================================
+ * MCS_CombatWorldSubsystem.h
+ *
+ * Description:
+ *  One ordered tick for the combat work of a world. Instead of every hitbox ticking on its own,
+ *  active hitboxes register here and the subsystem runs them through fixed phases:
+ *    1. Snapshot       combat grid rebuilt, hitbox sockets sampled and reach-culled (parallel)
+ *    2. Decide         work deferred by input, AI or StateTree
+ *    3. Sweep          physics sweeps of every hitbox (parallel)
+ *    4. ResolveHits    last frame's sight traces, then sweep hits and area shapes per island (parallel)
+ *    5. ApplyDamage    OnHitboxHit broadcast for every resolved hit, in island order
+ *    6. Reactions      work deferred into the phase (QueueReactToHit)
+ *    7. PublishEvents  OnHitLanded on the combat event bus for the frame's hits
+ *  Tickable objects run after the tick groups, so sweeps see the final pose of the frame.
+ *  Each phase has its own cycle stat; game code joins a phase with OnPhase or Defer.
+ *
+ *  Snapshot also splits the combatants into islands: connected components of "can touch this frame"
+ *  (a hitbox's substeps, areas and sight checks against the combat grid) and "engages" (engagement
+ *  slots). Islands never interact, so Resolve Hits runs one island per worker, and hits are merged
+ *  and dispatched in island order, which doesn't depend on how the workers were scheduled.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include <Enums/EMCS_CombatPhase.h>
+#include <Structs/MCS_AttackEntry.h>
+#include <Structs/MCS_CombatIslands.h>
+#include "MCS_CombatWorldSubsystem.generated.h"
+
+class AActor;
+class UMCS_CombatHitboxComponent;
+class UMCS_CombatGridSubsystem;
+
+DECLARE_MULTICAST_DELEGATE_TwoParams(FOnMCSCombatPhase, EMCS_CombatPhase /*Phase*/, float /*DeltaTime*/);
+
+
+/**
+ * Tickable world subsystem that runs the combat phases in order.
+ */
+UCLASS(meta = (DisplayName = "Motion Combat World Subsystem"))
+class MOTIONCOMBATSYSTEM_API UMCS_CombatWorldSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    /*
+     * Properties
+     */
+
+    /** Disable to let hitboxes tick themselves again (deferred work and phase callbacks still run) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MCS|Pipeline")
+    bool bEnabled = true;
+
+    /** Sample sockets and run sweeps on worker threads */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MCS|Pipeline")
+    bool bParallel = true;
+
+    /** Fewer active hitboxes than this are processed on the game thread (task overhead outweighs the gain) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MCS|Pipeline", meta = (ClampMin = "1"))
+    int32 MinParallelHitboxes = 4;
+
+    /** Fewer islands with hitboxes than this are resolved on the game thread */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MCS|Pipeline", meta = (ClampMin = "1"))
+    int32 MinParallelIslands = 2;
+
+    /**
+     * Broadcast OnHitLanded on the combat event bus for every hit dispatched this frame.
+     * Turn off if game code already broadcasts it from OnHitboxHit.
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MCS|Pipeline")
+    bool bPublishHitLanded = true;
+
+    /** Broadcast at the end of each phase, after the subsystem's own work and before deferred work */
+    FOnMCSCombatPhase OnPhase;
+
+    /*
+     * Functions
+     */
+
+    /** Runs Work during Phase: this frame if the phase is still ahead, otherwise next frame */
+    void Defer(EMCS_CombatPhase Phase, TUniqueFunction<void()>&& Work);
+
+    /** Phase being run, or MAX between ticks */
+    UFUNCTION(BlueprintPure, Category = "MCS|Pipeline")
+    EMCS_CombatPhase GetCurrentPhase() const { return CurrentPhase; }
+
+    /** Adds a hitbox with active detection; it leaves on its own once it has nothing left to do */
+    void RegisterHitbox(UMCS_CombatHitboxComponent* Hitbox);
+
+    /** Number of combat islands this frame (built in Snapshot on frames with active hitboxes) */
+    UFUNCTION(BlueprintPure, Category = "MCS|Pipeline")
+    int32 GetNumIslands() const { return Islands.Num(); }
+
+    /** Island of a combatant this frame, or INDEX_NONE */
+    UFUNCTION(BlueprintPure, Category = "MCS|Pipeline")
+    int32 GetIslandOf(const AActor* Actor) const;
+
+    /** Records a dispatched hit for the Publish Events phase */
+    void RecordHitLanded(AActor* Attacker, AActor* Defender, const FMCS_AttackEntry& Attack);
+
+    /** Convenience accessor from any world context object */
+    static UMCS_CombatWorldSubsystem* Get(const UObject* WorldContextObject);
+
+    // =========================
+    // Subsystem lifecycle overrides
+    // =========================
+
+    virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+    virtual void Deinitialize() override;
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+private:
+    /*
+     * Properties
+     */
+
+    /** A hit waiting for the Publish Events phase */
+    struct FHitLanded
+    {
+        TWeakObjectPtr<AActor> Attacker;
+        TWeakObjectPtr<AActor> Defender;
+        FMCS_AttackEntry Attack;
+    };
+
+    EMCS_CombatPhase CurrentPhase = EMCS_CombatPhase::MAX;
+
+    /** Registered hitboxes; compacted at the start of every tick */
+    TArray<TWeakObjectPtr<UMCS_CombatHitboxComponent>> Hitboxes;
+
+    /** Hitboxes processed this tick (scratch) */
+    TArray<UMCS_CombatHitboxComponent*> ActiveHitboxes;
+
+    /** Work deferred into each phase */
+    TArray<TUniqueFunction<void()>> Deferred[static_cast<int32>(EMCS_CombatPhase::MAX)];
+
+    TArray<FHitLanded> HitsLanded;
+
+    /* Islands: nodes are the grid snapshot, then hitbox owners outside the grid */
+    FMCS_CombatIslands Islands;
+    TArray<AActor*> NodeActors;
+    int32 NumGridNodes = 0;
+
+    /** Per active hitbox: its owner's node and the grid combatants its frame bounds overlap */
+    TArray<int32> HitboxNodes;
+    TArray<TArray<int32>> HitboxContacts;
+
+    /** Active hitbox indices grouped by island; run r is HitboxOrder[RunStarts[r] .. RunStarts[r + 1]) */
+    TArray<int32> HitboxOrder;
+    TArray<int32> RunStarts;
+
+    /*
+     * Functions
+     */
+
+    /** Snapshot, Sweep, ResolveHits, ApplyDamage and PublishEvents work */
+    void Snapshot();
+    void Sweep();
+    void ResolveHits(float DeltaTime);
+    void ApplyDamage();
+    void PublishEvents();
+
+    /** Links hitbox owners to their contacts and engaged pairs, then groups the hitboxes by island */
+    void BuildIslands(UMCS_CombatGridSubsystem* Grid);
+
+    /** Broadcasts OnPhase and runs the work deferred into Phase */
+    void FinishPhase(EMCS_CombatPhase Phase, float DeltaTime);
+
+    /** Runs Body for every active hitbox, on workers when enabled and worthwhile */
+    void ParallelForEachHitbox(TFunctionRef<void(int32 Index, UMCS_CombatHitboxComponent&)> Body) const;
+};
@@ -0,0 +1,204 @@
+/*
+ * ========================================================================
+ * Copyright © 2025 God's Studio
+ * All Rights Reserved.
+ *
+ * Free for all to use, copy, and distribute. I hope you learn from this as I learned creating it.
+ * =============================================================================
+ *
+ * Project: Motion Combat System
+ * This is a combat system inspired by Unreal Engine’s Motion Matching plugin.
+ * Author: Christopher D. Parker
+ * Date: 10-18-2026
+ * =============================================================================
+ * MCS_EngagementSubsystem.h
+ *
+ * Description:
+ *  UWorldSubsystem that maintains shared engagement rings around combat targets.
+ *  Each target owns a set of concentric rings of slots that are projected onto the
+ *  navmesh once and cached until the target moves past a threshold (or the navmesh
+ *  is rebuilt). Attackers request a slot using the range window of their active
+ *  attack set, so one navigation query set per target replaces one per attacker,
+ *  and the position an enemy walks to lines up with what its chooser wants.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "MCS_EngagementSubsystem.generated.h"
+
+class AActor;
+class ANavigationData;
+
+
+/**
+ * A single engagement slot around a target.
+ */
+USTRUCT(BlueprintType)
+struct MOTIONCOMBATSYSTEM_API FMCS_EngagementSlot
+{
+    GENERATED_BODY()
+
+    /** Navmesh-projected world location of this slot */
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "MCS|Engagement")
+    FVector Location = FVector::ZeroVector;
+
+    /** Index of the ring this slot belongs to (see UMCS_EngagementSubsystem::RingRadii) */
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "MCS|Engagement")
+    int32 RingIndex = INDEX_NONE;
+
+    /** Whether the slot projected onto the navmesh successfully */
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "MCS|Engagement")
+    bool bIsReachable = false;
+
+    /** Attacker currently holding this slot (if any) */
+    TWeakObjectPtr<AActor> Occupant;
+};
+
+/**
+ * Cached ring of slots for one target.
+ */
+struct FMCS_EngagementRing
+{
+    /** Target location the slots were generated around */
+    FVector Origin = FVector::ZeroVector;
+
+    /** All slots, ring after ring (SlotsPerRing entries each) */
+    TArray<FMCS_EngagementSlot> Slots;
+
+    /** Set when the navmesh changed and slots must be re-projected */
+    bool bDirty = true;
+};
+
+
+/**
+ * UWorldSubsystem that hands out navmesh-projected engagement slots around targets.
+ */
+UCLASS(BlueprintType, meta = (DisplayName = "Motion Combat Engagement Subsystem"))
+class MOTIONCOMBATSYSTEM_API UMCS_EngagementSubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    /*
+     * Functions
+     */
+
+    /**
+     * Requests (or refreshes) an engagement slot around a target for the given attacker.
+     * The slot whose ring radius best fits [PreferredRangeStart, PreferredRangeEnd] and is closest
+     * to the attacker is reserved. Calling again for the same attacker/target keeps the same slot
+     * and simply returns its (possibly re-projected) location.
+     * @param Attacker - actor that wants to engage
+     * @param Target - actor being engaged
+     * @param PreferredRangeStart - minimum preferred distance from the target
+     * @param PreferredRangeEnd - maximum preferred distance from the target
+     * @param OutLocation - navmesh location of the reserved slot
+     * @return True if a reachable slot was reserved
+     */
+    UFUNCTION(BlueprintCallable, Category = "MCS|Engagement")
+    bool RequestSlot(AActor* Attacker, AActor* Target, float PreferredRangeStart, float PreferredRangeEnd, FVector& OutLocation);
+
+    /**
+     * Requests a slot using the range window of the attacker's active attack set.
+     * Falls back to the first ring when the attacker has no combat core component.
+     */
+    UFUNCTION(BlueprintCallable, Category = "MCS|Engagement")
+    bool RequestSlotForActiveAttackSet(AActor* Attacker, AActor* Target, FVector& OutLocation);
+
+    /** Releases any slot held by the attacker */
+    UFUNCTION(BlueprintCallable, Category = "MCS|Engagement")
+    void ReleaseSlot(AActor* Attacker);
+
+    /** Drops the cached rings for a target (e.g. target died) and frees its slots */
+    UFUNCTION(BlueprintCallable, Category = "MCS|Engagement")
+    void RemoveTarget(AActor* Target);
+
+    /** Marks every cached ring dirty so it is re-projected on its next request (and picks up edited Ring Radii) */
+    UFUNCTION(BlueprintCallable, Category = "MCS|Engagement")
+    void InvalidateAllRings();
+
+    /** Visits every attacker holding a slot and the target it engages */
+    void ForEachEngagement(TFunctionRef<void(AActor* Attacker, AActor* Target)> Visit) const;
+
+    // =========================
+    // WorldSubsystem lifecycle overrides
+    // =========================
+
+    // Only create this subsystem for real game worlds (PIE & Game), not the Editor preview world.
+    virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+    virtual void Deinitialize() override;
+
+#if WITH_EDITOR
+    virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
+    /*
+     * Properties
+     */
+
+    /** Radii of the rings generated around each target (any order; call Invalidate All Rings after changing them at runtime) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MCS|Engagement")
+    TArray<float> RingRadii = { 150.f, 300.f, 500.f, 800.f };
+
+    /** Number of evenly spaced slots on each ring */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MCS|Engagement", meta = (ClampMin = "1"))
+    int32 SlotsPerRing = 8;
+
+    /** Distance the target must move before its rings are regenerated */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MCS|Engagement|Performance")
+    float RebuildDistanceThreshold = 150.f;
+
+    /** Extent used when projecting slot points onto the navmesh */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MCS|Engagement|Performance")
+    FVector ProjectionExtent = FVector(100.f, 100.f, 250.f);
+
+    /** Seconds between sweeps dropping rings and assignments of destroyed actors (slots of dead occupants count as free meanwhile) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MCS|Engagement|Performance", meta = (ClampMin = "0.1"))
+    float StalePruneInterval = 1.f;
+
+    /** Whether to draw debug visuals for generated rings */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MCS|Engagement|Debug")
+    bool bDebug = false;
+
+private:
+    /*
+     * Properties
+     */
+
+    /** Cached rings per target */
+    TMap<TWeakObjectPtr<AActor>, FMCS_EngagementRing> Rings;
+
+    /** Ring Radii sorted ascending; slot ring indices refer to this */
+    TArray<float> SortedRingRadii;
+
+    /** Which target/slot each attacker currently holds */
+    TMap<TWeakObjectPtr<AActor>, TPair<TWeakObjectPtr<AActor>, int32>> Assignments;
+
+    /** Repeating timer running PruneStaleEntries */
+    FTimerHandle PruneTimerHandle;
+
+    /*
+     * Functions
+     */
+
+    /** Regenerates (or re-projects) the ring for a target if it moved or was invalidated */
+    FMCS_EngagementRing* GetOrBuildRing(AActor* Target);
+
+    /** Picks the best free slot for an attacker in the given ring */
+    int32 PickSlot(const FMCS_EngagementRing& Ring, const FVector& AttackerLocation, float RangeStart, float RangeEnd) const;
+
+    /** Copies and sorts Ring Radii */
+    void RefreshRingRadii();
+
+    /** Removes rings whose target is gone and assignments whose attacker is gone */
+    void PruneStaleEntries();
+
+    /** Called by the navigation system whenever navmesh generation finishes */
+    UFUNCTION()
+    void HandleNavigationGenerationFinished(ANavigationData* NavData);
+};
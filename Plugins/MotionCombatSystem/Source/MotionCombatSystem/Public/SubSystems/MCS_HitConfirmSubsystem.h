@@ -0,0 +1,129 @@
+/*
+ * ========================================================================
+ * Copyright © 2025 God's Studio
+ * All Rights Reserved.
+ *
+ * Free for all to use, copy, and distribute. I hope you learn from this as I learned creating it.
+ * =============================================================================
+ *
+ * Project: Motion Combat System
+ * This is a combat system inspired by Unreal Engine’s Motion Matching plugin.
+ * Author: Christopher D. Parker
+ * Date: 10-18-2026
+ * =============================================================================
+ * MCS_HitConfirmSubsystem.h
+ *
+ * Description:
+ *  Server side of hit confirmation. Every hit the server reacts to (ReactToHit on the authority)
+ *  is queued here, and once per frame each client with a UMCS_HitConfirmComponent receives one
+ *  FMCS_HitConfirmBatch holding the queued hits whose victim is net relevant to it, instead of
+ *  one message per hit. The queue is flushed in the Publish Events phase of the combat world
+ *  pipeline, or in this subsystem's own tick for hits confirmed after it.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include <Enums/EMCS_CombatPhase.h>
+#include <Structs/MCS_AttackEntry.h>
+#include <Structs/MCS_HitConfirm.h>
+#include "MCS_HitConfirmSubsystem.generated.h"
+
+class AActor;
+class UNetConnection;
+class UMCS_HitConfirmComponent;
+
+
+/**
+ * Tickable world subsystem batching confirmed hits per frame and connection.
+ */
+UCLASS(meta = (DisplayName = "Motion Combat Hit Confirm Subsystem"))
+class MOTIONCOMBATSYSTEM_API UMCS_HitConfirmSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    /*
+     * Properties
+     */
+
+    /** Disable to stop sending confirmed hits (hits confirmed meanwhile are dropped) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MCS|Hit Confirm")
+    bool bEnabled = true;
+
+    /** Hits per batch; a frame with more hits for one connection sends several */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MCS|Hit Confirm", meta = (ClampMin = "1", ClampMax = "128"))
+    int32 MaxHitsPerBatch = 64;
+
+    /**
+     * Don't send a hit back to the attacker's client when its hitbox runs on the autonomous proxy:
+     * that client detected the hit itself and already reacted to it.
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MCS|Hit Confirm")
+    bool bSkipPredictingClient = true;
+
+    /*
+     * Functions
+     */
+
+    /** Queues a hit the server reacted to for this frame's batches */
+    void ConfirmHit(const FHitResult& Hit, AActor* Attacker, AActor* Victim, const FMCS_AttackEntry& Attack, EMCS_HitReactionLevel Level);
+
+    /** Sends the queued hits to every registered connection now */
+    void Flush();
+
+    /** Adds / removes the receiver of a remote connection (called by the component on the server) */
+    void RegisterReceiver(UMCS_HitConfirmComponent* Receiver);
+    void UnregisterReceiver(UMCS_HitConfirmComponent* Receiver);
+
+    /** Convenience accessor from any world context object */
+    static UMCS_HitConfirmSubsystem* Get(const UObject* WorldContextObject);
+
+    // =========================
+    // Subsystem lifecycle overrides
+    // =========================
+
+    virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+private:
+    /*
+     * Properties
+     */
+
+    /** A hit waiting for the next flush */
+    struct FPendingConfirm
+    {
+        TWeakObjectPtr<AActor> Attacker;
+        TWeakObjectPtr<AActor> Victim;
+        FName AttackName;
+        FVector ImpactPoint = FVector::ZeroVector;
+        FName BoneName;
+        EPGAS_HitSeverity Severity = EPGAS_HitSeverity::Light;
+        EMCS_HitReactionLevel Level = EMCS_HitReactionLevel::None;
+
+        /** Connection of the attacker's client when it predicted the hit */
+        TWeakObjectPtr<UNetConnection> PredictingConnection;
+    };
+
+    TArray<FPendingConfirm> Pending;
+
+    /** Receivers of remote connections */
+    TArray<TWeakObjectPtr<UMCS_HitConfirmComponent>> Receivers;
+
+    /** Batch being filled for one connection (scratch) */
+    FMCS_HitConfirmBatch Batch;
+
+    FDelegateHandle PhaseHandle;
+
+    /*
+     * Functions
+     */
+
+    /** Flushes in the Publish Events phase, after the frame's reactions */
+    void HandlePhase(EMCS_CombatPhase Phase, float DeltaTime);
+};
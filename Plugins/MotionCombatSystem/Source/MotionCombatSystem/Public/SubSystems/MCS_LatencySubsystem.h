@@ -0,0 +1,176 @@
+/*
+ * ========================================================================
+ * Copyright © 2025 God's Studio
+ * All Rights Reserved.
+ *
+ * Free for all to use, copy, and distribute. I hope you learn from this as I learned creating it.
+ * =============================================================================
+ *
+ * Project: Motion Combat System
+ * This is a combat system inspired by Unreal Engine’s Motion Matching plugin.
+ * Author: Christopher D. Parker
+ * Date: 10-18-2026
+ * =============================================================================
+ * MCS_LatencySubsystem.h
+ *
+ * Description:
+ *  Tickable world subsystem that measures input-to-action latency for combat inputs.
+ *  A sample starts when an input is received (Enhanced Input callback / command component)
+ *  and is stamped as it passes each pipeline stage:
+ *    Input -> Dispatch (PerformAttack / TryContinueCombo / TryParry)
+ *          -> Pose (first frame the montage has weight in the pose)
+ *          -> Hitbox (first frame a hitbox window is active)
+ *  Rolling percentiles (p50/p95/p99, in ms and frames) per stage are published to
+ *  "stat MotionCombat", to the CSV profiler (one column per stage, percentile and unit),
+ *  and can be dumped with the mcs.LatencyReport console command.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "MCS_LatencySubsystem.generated.h"
+
+class UAnimMontage;
+class UAnimInstance;
+
+
+/**
+ * Pipeline stages measured relative to the input timestamp.
+ */
+UENUM(BlueprintType)
+enum class EMCS_LatencyStage : uint8
+{
+    Dispatch    UMETA(DisplayName = "Input -> Dispatch"),
+    Pose        UMETA(DisplayName = "Input -> First Pose"),
+    Hitbox      UMETA(DisplayName = "Input -> First Hitbox"),
+    MAX         UMETA(Hidden)
+};
+
+
+/**
+ * Tickable world subsystem that tracks combat input latency per pipeline stage.
+ */
+UCLASS(meta = (DisplayName = "Motion Combat Latency Subsystem"))
+class MOTIONCOMBATSYSTEM_API UMCS_LatencySubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    /*
+     * Functions
+     */
+
+    /**
+     * Starts a latency sample for a combatant. Call from the Enhanced Input callback.
+     * A newer input replaces an unfinished sample.
+     */
+    UFUNCTION(BlueprintCallable, Category = "MCS|Latency")
+    void MarkInput(AActor* Combatant);
+
+    /** Stamps the dispatch stage (attack/parry request reached the combat components) */
+    void MarkDispatch(const AActor* Combatant);
+
+    /** Registers the montage whose first contributing pose frame should be stamped */
+    void MarkMontageStarted(const AActor* Combatant, UAnimInstance* AnimInstance, UAnimMontage* Montage);
+
+    /** Stamps the first active hitbox frame and completes the sample */
+    void MarkHitboxActive(const AActor* Combatant);
+
+    /**
+     * Returns a percentile for a stage from the rolling window.
+     * @param Stage - pipeline stage
+     * @param Percentile - 0..1 (e.g. 0.95)
+     * @param OutMs - latency in milliseconds
+     * @param OutFrames - latency in frames
+     * @return False if no samples exist yet
+     */
+    UFUNCTION(BlueprintCallable, Category = "MCS|Latency")
+    bool GetPercentile(EMCS_LatencyStage Stage, float Percentile, float& OutMs, float& OutFrames) const;
+
+    /** Logs the percentile table and writes the raw samples to Saved/Profiling/MotionCombat as CSV */
+    UFUNCTION(BlueprintCallable, Category = "MCS|Latency")
+    void WriteReport() const;
+
+    /** Clears every collected sample */
+    UFUNCTION(BlueprintCallable, Category = "MCS|Latency")
+    void ResetSamples();
+
+    /** Convenience accessor used by the combat components */
+    static UMCS_LatencySubsystem* Get(const UObject* WorldContext);
+
+    /** Bytes held by pending and recorded samples */
+    SIZE_T GetAllocatedSize() const;
+
+    // =========================
+    // Subsystem lifecycle overrides
+    // =========================
+
+    virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    /*
+     * Properties
+     */
+
+    /** Number of samples kept per stage for the rolling percentiles */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MCS|Latency", meta = (ClampMin = "16"))
+    int32 WindowSize = 256;
+
+    /** Samples that don't complete within this time are closed with the stages they reached */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MCS|Latency")
+    float SampleTimeout = 2.0f;
+
+private:
+    /*
+     * Types
+     */
+
+    struct FPendingSample
+    {
+        double InputTime = 0.0;
+        uint64 InputFrame = 0;
+        bool bHasStage[(int32)EMCS_LatencyStage::MAX] = { false, false, false };
+        TWeakObjectPtr<UAnimInstance> AnimInstance;
+        TWeakObjectPtr<UAnimMontage> Montage;
+    };
+
+    struct FStageWindow
+    {
+        TArray<float> Ms;
+        TArray<float> Frames;
+        int32 Next = 0;
+    };
+
+    struct FPublishedPercentile
+    {
+        float Ms = 0.f;
+        float Frames = 0.f;
+        bool bValid = false;
+    };
+
+    /*
+     * Properties
+     */
+
+    /** Unfinished samples per combatant */
+    TMap<TWeakObjectPtr<const AActor>, FPendingSample> Pending;
+
+    /** Rolling windows per stage */
+    FStageWindow Windows[(int32)EMCS_LatencyStage::MAX];
+
+    /** Frames since stats were last published */
+    int32 FramesSincePublish = 0;
+
+    /** Last published p50/p95/p99 per stage, re-emitted to the CSV profiler every frame */
+    FPublishedPercentile PublishedPercentiles[(int32)EMCS_LatencyStage::MAX][3];
+
+    /*
+     * Functions
+     */
+
+    void RecordStage(FPendingSample& Sample, EMCS_LatencyStage Stage);
+    void PublishStats();
+    void WriteCsvStats() const;
+};
@@ -0,0 +1,204 @@
+/*
+ * ========================================================================
+ * Copyright © 2025 God's Studio
+ * All Rights Reserved.
+ *
+ * Free for all to use, copy, and distribute. I hope you learn from this as I learned creating it.
+ * =============================================================================
+ *
+ * Project: Motion Combat System
+ * This is a combat system inspired by Unreal Engine’s Motion Matching plugin.
+ * Author: Christopher D. Parker
+ * Date: 10-18-2026
+ * =============================================================================
+ * MCS_NavQuerySubsystem.h
+ *
+ * Description:
+ *  Tickable world subsystem that serves "random reachable location" requests without
+ *  blocking the game thread. Reachable points are precomputed per world region (a coarse
+ *  grid cell) a few at a time per frame and cached for reuse. Each request picks a cached
+ *  candidate inside its radius from every cell the radius overlaps, or, when the cache has
+ *  none, samples the navmesh around its own origin; the candidate is then validated with an
+ *  async path query, which the navigation system batches and runs off the game thread.
+ *  Submissions are capped per frame so a whole squad asking on the same frame never causes a spike.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "AI/Navigation/NavigationTypes.h"
+#include "MCS_NavQuerySubsystem.generated.h"
+
+class ANavigationData;
+class UNavigationSystemV1;
+
+
+/**
+ * Status of a queued navigation query.
+ */
+UENUM(BlueprintType)
+enum class EMCS_NavQueryStatus : uint8
+{
+    Invalid     UMETA(DisplayName = "Invalid"),
+    Pending     UMETA(DisplayName = "Pending"),
+    Succeeded   UMETA(DisplayName = "Succeeded"),
+    Failed      UMETA(DisplayName = "Failed")
+};
+
+
+/**
+ * Tickable world subsystem that batches random-location navigation queries across agents.
+ */
+UCLASS(meta = (DisplayName = "Motion Combat Nav Query Subsystem"))
+class MOTIONCOMBATSYSTEM_API UMCS_NavQuerySubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    /*
+     * Functions
+     */
+
+    /**
+     * Queues a random reachable location query.
+     * @param Querier - agent asking (used for agent properties and as path owner)
+     * @param Origin - search center
+     * @param Radius - search radius
+     * @return Handle used to poll or cancel the query (0 if rejected)
+     */
+    UFUNCTION(BlueprintCallable, Category = "MCS|Navigation")
+    int32 SubmitRandomLocationQuery(AActor* Querier, const FVector& Origin, float Radius);
+
+    /**
+     * Polls a query. Finished queries are released once their result has been read.
+     * @param Handle - handle returned by SubmitRandomLocationQuery
+     * @param OutLocation - reachable location when the query succeeded
+     */
+    UFUNCTION(BlueprintCallable, Category = "MCS|Navigation")
+    EMCS_NavQueryStatus ConsumeQueryResult(int32 Handle, FVector& OutLocation);
+
+    /** Cancels a query that is no longer needed */
+    UFUNCTION(BlueprintCallable, Category = "MCS|Navigation")
+    void CancelQuery(int32 Handle);
+
+    /** Drops every cached region point set */
+    UFUNCTION(BlueprintCallable, Category = "MCS|Navigation")
+    void InvalidateRegionCache();
+
+    // =========================
+    // Subsystem lifecycle overrides
+    // =========================
+
+    virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+    virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+    virtual void Deinitialize() override;
+
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    /*
+     * Properties
+     */
+
+    /** Size of a cached region (grid cell) in world units */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MCS|Navigation")
+    float RegionSize = 2000.f;
+
+    /** Number of reachable points cached per region */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MCS|Navigation", meta = (ClampMin = "1"))
+    int32 PointsPerRegion = 32;
+
+    /** Maximum navmesh samples per frame (region points and direct samples of queries the cache can't answer) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MCS|Navigation|Performance", meta = (ClampMin = "1"))
+    int32 MaxRegionSamplesPerFrame = 16;
+
+    /** Maximum async path validations submitted per frame */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MCS|Navigation|Performance", meta = (ClampMin = "1"))
+    int32 MaxQueriesPerFrame = 8;
+
+    /** Candidates tried per query before it fails */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MCS|Navigation", meta = (ClampMin = "1"))
+    int32 MaxAttemptsPerQuery = 3;
+
+    /** Consecutive missed samples before a region without any point is considered to have no navmesh */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MCS|Navigation", meta = (ClampMin = "1"))
+    int32 MaxRegionMisses = 8;
+
+    /** Queries whose radius overlaps more regions than this sample around their origin instead of using the cache */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MCS|Navigation|Performance", meta = (ClampMin = "1"))
+    int32 MaxRegionsPerQuery = 9;
+
+private:
+    /*
+     * Types
+     */
+
+    struct FRegionPoints
+    {
+        TArray<FVector> Points;
+
+        /** Samples that missed the navmesh (consecutive while Points is empty) */
+        int32 Misses = 0;
+        bool bComplete = false;
+    };
+
+    struct FPendingQuery
+    {
+        TWeakObjectPtr<AActor> Querier;
+        FVector Origin = FVector::ZeroVector;
+        float Radius = 0.f;
+        /** Regions overlapped by the query's radius (empty when it overlaps too many) */
+        TArray<FIntVector, TInlineAllocator<4>> Regions;
+        FVector Candidate = FVector::ZeroVector;
+        uint32 PathQueryId = 0;
+        int32 Attempts = 0;
+        bool bAwaitingPath = false;
+
+        /** Set once a cached candidate proved unreachable: later attempts sample around the origin */
+        bool bSampleOrigin = false;
+        EMCS_NavQueryStatus Status = EMCS_NavQueryStatus::Pending;
+    };
+
+    /*
+     * Properties
+     */
+
+    /** Cached reachable points keyed by region cell */
+    TMap<FIntVector, FRegionPoints> Regions;
+
+    /** Regions waiting for points, processed in FIFO order under MaxRegionSamplesPerFrame */
+    TArray<FIntVector> RegionFillQueue;
+
+    /** Live queries keyed by handle */
+    TMap<int32, FPendingQuery> Queries;
+
+    /** Handles waiting for submission, in FIFO order */
+    TArray<int32> SubmitQueue;
+
+    int32 NextHandle = 1;
+
+    /*
+     * Functions
+     */
+
+    FIntVector GetRegionKey(const FVector& Location) const;
+
+    /** Fills Query.Regions with the cells its radius overlaps and queues the uncached ones */
+    void AddQueryRegions(FPendingQuery& Query);
+
+    /** Generates up to Budget points for queued regions; returns the budget left */
+    int32 FillRegions(UNavigationSystemV1* NavSys, int32 Budget);
+
+    /** True once every region of the query is cached */
+    bool AreRegionsComplete(const FPendingQuery& Query) const;
+
+    /** Picks a cached point of the query's regions that lies inside its radius */
+    bool PickCachedCandidate(FPendingQuery& Query) const;
+
+    /** Called by the navigation system when an async path query completes */
+    void HandlePathQueryFinished(uint32 PathId, ENavigationQueryResult::Type Result, FNavPathSharedPtr Path, int32 Handle);
+
+    UFUNCTION()
+    void HandleNavigationGenerationFinished(ANavigationData* NavData);
+};
@@ -0,0 +1,148 @@
+/*
+ * ========================================================================
+ * Copyright © 2025 God's Studio
+ * All Rights Reserved.
+ *
+ * Free for all to use, copy, and distribute. I hope you learn from this as I learned creating it.
+ * =============================================================================
+ *
+ * Project: Motion Combat System
+ * This is a combat system inspired by Unreal Engine’s Motion Matching plugin.
+ * Author: Christopher D. Parker
+ * Date: 10-18-2026
+ * =============================================================================
+ * MCS_ProjectileSubsystem.h
+ *
+ * Description:
+ *  Tickable world subsystem that simulates every in-flight projectile in one batched update.
+ *  Projectiles are plain entries in parallel arrays (no actor per projectile):
+ *    1. Resolve last step: read the async world trace issued for the segment, test the segment
+ *       against the combat grid, and dispatch hits that happen before the world impact.
+ *    2. Integrate: gravity, position, lifetime and range; issue the async world trace for the new segment.
+ *    3. Compact dead projectiles and move pooled visual actors.
+ *  Hits go through the instigator's UMCS_CombatHitboxComponent::DispatchHit, the same path as melee.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "WorldCollision.h"
+#include <Structs/MCS_AttackEntry.h>
+#include "MCS_ProjectileSubsystem.generated.h"
+
+class UMCS_CombatGridSubsystem;
+
+
+/**
+ * Tickable world subsystem that owns and simulates all MCS projectiles.
+ */
+UCLASS(meta = (DisplayName = "Motion Combat Projectile Subsystem"))
+class MOTIONCOMBATSYSTEM_API UMCS_ProjectileSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    /*
+     * Functions
+     */
+
+    /**
+     * Fires the projectile described by Attack.Projectile.
+     * @param Instigator - actor that owns the hit (its hitbox component dispatches the hits)
+     * @param Attack - attack entry passed along with every hit
+     * @param Origin - spawn location
+     * @param Direction - launch direction (normalized internally)
+     * @return False if the attack has no projectile or the projectile cap is reached
+     */
+    UFUNCTION(BlueprintCallable, Category = "MCS|Projectile")
+    bool FireProjectile(AActor* Instigator, const FMCS_AttackEntry& Attack, const FVector& Origin, const FVector& Direction);
+
+    /** Removes every projectile fired by the instigator */
+    UFUNCTION(BlueprintCallable, Category = "MCS|Projectile")
+    void CancelProjectiles(AActor* Instigator);
+
+    /** Number of projectiles in flight */
+    UFUNCTION(BlueprintPure, Category = "MCS|Projectile")
+    int32 GetNumProjectiles() const { return Positions.Num(); }
+
+    /** Bytes held by the projectile columns, attack table and scratch buffers */
+    SIZE_T GetAllocatedSize() const;
+
+    // =========================
+    // Subsystem lifecycle overrides
+    // =========================
+
+    virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+    virtual void Deinitialize() override;
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    /*
+     * Properties
+     */
+
+    /** Maximum projectiles in flight; further shots are refused */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MCS|Projectile", meta = (ClampMin = "1"))
+    int32 MaxProjectiles = 1024;
+
+    /** Free visual actors kept per class */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MCS|Projectile", meta = (ClampMin = "0"))
+    int32 MaxPooledVisualsPerClass = 64;
+
+private:
+    /*
+     * Types
+     */
+
+    /** Actors already hit by one projectile (MaxHits is clamped to 8) */
+    typedef TArray<TWeakObjectPtr<AActor>, TInlineAllocator<4>> FHitList;
+
+    /*
+     * Properties
+     */
+
+    /* Projectile state (structure of arrays, same index in every array) */
+    TArray<FVector> Positions;
+    TArray<FVector> PrevPositions;
+    TArray<FVector> Velocities;
+    TArray<float> Gravity;
+    TArray<float> Radii;
+    TArray<float> TimeLeft;
+    TArray<float> RangeLeft;
+    TArray<int32> HitsLeft;
+    TArray<int32> AttackIndices;
+    TArray<uint8> Teams;
+    TArray<bool> bFriendlyFire;
+    TArray<bool> bAlive;
+    TArray<FTraceHandle> TraceHandles;
+    TArray<TWeakObjectPtr<AActor>> Instigators;
+    TArray<TWeakObjectPtr<AActor>> Visuals;
+    TArray<FHitList> AlreadyHit;
+
+    /** Attack entries referenced by AttackIndices; cleared when no projectile is in flight */
+    TArray<FMCS_AttackEntry> Attacks;
+
+    /** Free visual actors per class */
+    TMap<TWeakObjectPtr<UClass>, TArray<TWeakObjectPtr<AActor>>> VisualPool;
+
+    /** Scratch buffers reused every tick */
+    TArray<int32> CandidateScratch;
+    TArray<TPair<float, int32>> HitScratch;
+
+    /*
+     * Functions
+     */
+
+    void ResolveStep(int32 Index, UMCS_CombatGridSubsystem* Grid);
+    void Integrate(int32 Index, float DeltaTime);
+    void RemoveDeadProjectiles();
+    void UpdateVisuals();
+
+    void DispatchHit(int32 Index, AActor* HitActor, const FVector& ImpactPoint, float Time);
+
+    int32 FindOrAddAttack(const FMCS_AttackEntry& Attack);
+
+    AActor* AcquireVisual(UClass* VisualClass, const FVector& Location, const FRotator& Rotation);
+    void ReleaseVisual(AActor* Visual);
+};
@@ -0,0 +1,132 @@
+/*
+ * ========================================================================
+ * Copyright © 2025 God's Studio
+ * All Rights Reserved.
+ *
+ * Free for all to use, copy, and distribute. I hope you learn from this as I learned creating it.
+ * =============================================================================
+ *
+ * Project: Motion Combat System
+ * This is a combat system inspired by Unreal Engine’s Motion Matching plugin.
+ * Author: Christopher D. Parker
+ * Date: 10-18-2026
+ * =============================================================================
+ * MCS_ResourceSubsystem.h
+ *
+ * Description:
+ *  Tickable world subsystem that stores combat resources (stamina, poise) for every combatant
+ *  in parallel float arrays. Each UMCS_CombatResourceComponent owns one slot.
+ *  Stamina regeneration and poise decay run in a single 4-wide pass per frame instead of
+ *  per-component ticks. Choosers read stamina straight from the store while filtering.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "MCS_ResourceSubsystem.generated.h"
+
+class AActor;
+
+
+/**
+ * Tickable world subsystem holding the combat resource store.
+ */
+UCLASS(meta = (DisplayName = "Motion Combat Resource Subsystem"))
+class MOTIONCOMBATSYSTEM_API UMCS_ResourceSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    /*
+     * Functions
+     */
+
+    /** Allocates a slot for an actor (returns the existing slot if it already has one) */
+    int32 AllocateSlot(AActor* Owner);
+
+    /** Frees a slot; its values stop updating and it may be reused */
+    void ReleaseSlot(int32 Slot);
+
+    /** Slot owned by an actor, or INDEX_NONE */
+    int32 FindSlot(const AActor* Owner) const;
+
+    /** Sets the stamina parameters of a slot and fills it */
+    void ConfigureStamina(int32 Slot, float Max, float RegenRate, float RegenDelay);
+
+    /** Sets the poise parameters of a slot and clears it */
+    void ConfigurePoise(int32 Slot, float Max, float DecayRate, float DecayDelay);
+
+    /* Stamina */
+    float GetStamina(int32 Slot) const { return IsValidSlot(Slot) ? Stamina[Slot] : 0.f; }
+    float GetMaxStamina(int32 Slot) const { return IsValidSlot(Slot) ? MaxStamina[Slot] : 0.f; }
+
+    /** Spends stamina and pauses regeneration. Fails without spending if there isn't enough. */
+    bool ConsumeStamina(int32 Slot, float Cost);
+
+    /** Adds stamina (clamped to max) */
+    void RestoreStamina(int32 Slot, float Amount);
+
+    /* Poise (accumulated stagger damage, decays back to 0) */
+    float GetPoise(int32 Slot) const { return IsValidSlot(Slot) ? Poise[Slot] : 0.f; }
+    float GetMaxPoise(int32 Slot) const { return IsValidSlot(Slot) ? MaxPoise[Slot] : 0.f; }
+
+    /** Adds poise damage (clamped to max) and pauses decay. Returns the new value. */
+    float AddPoise(int32 Slot, float Amount);
+
+    /** Clears accumulated poise */
+    void ResetPoise(int32 Slot);
+
+    /**
+     * Stamina available to an actor for chooser filtering.
+     * Actors without a resource slot are unlimited (returns MAX_flt).
+     */
+    static float GetAvailableStamina(const AActor* Actor);
+
+    // =========================
+    // Subsystem lifecycle overrides
+    // =========================
+
+    virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+    virtual void Deinitialize() override;
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+private:
+    /*
+     * Properties
+     */
+
+    /* Resource store (structure of arrays, padded to a multiple of 4; free slots have zero rates) */
+    TArray<float> Stamina;
+    TArray<float> MaxStamina;
+    TArray<float> StaminaRegen;
+    TArray<float> StaminaDelay;
+    TArray<float> StaminaCooldown;
+    TArray<float> Poise;
+    TArray<float> MaxPoise;
+    TArray<float> PoiseDecay;
+    TArray<float> PoiseDelay;
+    TArray<float> PoiseCooldown;
+
+    /** Owner of each slot (null when free) */
+    TArray<TWeakObjectPtr<AActor>> Owners;
+
+    /** Owner -> slot */
+    TMap<TWeakObjectPtr<const AActor>, int32> OwnerSlots;
+
+    /** Released slots available for reuse */
+    TArray<int32> FreeSlots;
+
+    /*
+     * Functions
+     */
+
+    bool IsValidSlot(int32 Slot) const { return Owners.IsValidIndex(Slot) && Owners[Slot].IsValid(); }
+
+    /** Grows every array by four zeroed slots */
+    void GrowStore();
+
+    /** Zeroes a slot so the batched pass leaves it alone */
+    void ClearSlot(int32 Slot);
+};
@@ -28,6 +28,7 @@
 #include "Subsystems/WorldSubsystem.h"
 #include <Interfaces/MCS_CombatTargetInterface.h>
 #include <Structs/MCS_TargetInfo.h>
+#include <SubSystems/MCS_CombatBudgetSubsystem.h>
 #include "MCS_TargetingSubsystem.generated.h"
 
 class AActor;
@@ -143,6 +144,9 @@ private:
 	/** Timer handle for recurring scans */
 	FTimerHandle ScanTimerHandle;
 
+	/** Binding to the frame-budget governor, which stretches the scan interval under load */
+	FDelegateHandle DegradationChangedHandle;
+
 	// Handy label we’ll use in logs so we can see which world is speaking.
 	FString MakeWorldTag() const;
 
@@ -159,4 +163,13 @@ private:
 	/** Removes any targets that are valid but have moved beyond the current ScanRadius */
 	void RemoveOutOfRangeTargets(const FVector& FromLocation);
 
+	/** TargetScanInterval scaled by the frame-budget governor */
+	float GetScanInterval() const;
+
+	/** (Re)arms the recurring scan timer with the current interval */
+	void StartScanTimer();
+
+	/** Re-arms the scan timer when the governor crosses the scan frequency stage */
+	void HandleDegradationChanged(EMCS_DegradationLevel NewLevel);
+
 };
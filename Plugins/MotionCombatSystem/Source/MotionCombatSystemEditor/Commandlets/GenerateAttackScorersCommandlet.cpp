@@ -0,0 +1,304 @@
+/*
+ * ========================================================================
+ * Copyright © 2025 God's Studio
+ * All Rights Reserved.
+ *
+ * Free for all to use, copy, and distribute. I hope you learn from this as I learned creating it.
+ * =============================================================================
+ *
+ * Project: Motion Combat System
+ * This is a combat system inspired by Unreal Engine’s Motion Matching plugin.
+ * Author: Christopher D. Parker
+ * Date: 10-18-2026
+ * =============================================================================
+ * GenerateAttackScorersCommandlet.cpp
+ * Emits constexpr row tables and per-row specialized scorers for attack DataTables.
+ */
+
+#include "Commandlets/GenerateAttackScorersCommandlet.h"
+#include "Engine/DataTable.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include <Structs/MCS_AttackEntry.h>
+#include <Structs/MCS_CompiledAttackSet.h>
+
+namespace MCS_ScorerGen
+{
+    /** Float as a C++ literal that reads back to the same value */
+    static FString FloatLiteral(float Value)
+    {
+        FString Text = FString::Printf(TEXT("%.9g"), Value);
+        if (!Text.Contains(TEXT(".")) && !Text.Contains(TEXT("e")))
+        {
+            Text += TEXT(".0");
+        }
+        return Text + TEXT("f");
+    }
+
+    template <typename EnumType>
+    static FString EnumLiteral(EnumType Value)
+    {
+        const UEnum* Enum = StaticEnum<EnumType>();
+        return FString::Printf(TEXT("%s::%s"), *Enum->CppType, *Enum->GetNameStringByValue(static_cast<int64>(Value)));
+    }
+
+    /** C++ expression UMCS_AttackChooser::QueryAttributeValue evaluates for an attribute (keep in sync) */
+    static FString AttributeExpression(FName Attribute)
+    {
+        if (Attribute == TEXT("Speed"))     return TEXT("Query.Situation->Speed");
+        if (Attribute == TEXT("Altitude"))  return TEXT("Query.Situation->Altitude");
+        if (Attribute == TEXT("Stamina"))   return TEXT("Query.Stamina");
+        if (Attribute == TEXT("Health"))    return TEXT("Query.Situation->HealthPercent");
+        return TEXT("0.0f");
+    }
+
+    static FString Identifier(const FString& Name)
+    {
+        FString Result;
+        for (const TCHAR Char : Name)
+        {
+            Result.AppendChar(FChar::IsAlnum(Char) ? Char : TEXT('_'));
+        }
+        if (Result.IsEmpty() || FChar::IsDigit(Result[0]))
+        {
+            Result.InsertAt(0, TEXT('_'));
+        }
+        return Result;
+    }
+
+    /** Text safe inside a // comment */
+    static FString CommentText(const FString& Text)
+    {
+        return Text.Replace(TEXT("\r"), TEXT(" ")).Replace(TEXT("\n"), TEXT(" "));
+    }
+
+    static bool IsFinite(const FMCS_AttackEntry& Entry)
+    {
+        bool bFinite = FMath::IsFinite(Entry.SelectionWeight) && FMath::IsFinite(Entry.RangeStart) && FMath::IsFinite(Entry.RangeEnd);
+        for (const FMCS_AttackCondition& Condition : Entry.ConditionalChecks)
+        {
+            bFinite &= FMath::IsFinite(Condition.Threshold) && FMath::IsFinite(Condition.Weight);
+        }
+        return bFinite;
+    }
+
+    /**
+     * Source of one set's scorer. Each row's branch does exactly what ScoreAttack_Implementation does
+     * without a tag score, in the same order, so the result is bit-identical.
+     */
+    static FString GenerateSet(const FMCS_CompiledAttackSet& Set, const FString& Name)
+    {
+        FString Out;
+        Out += FString::Printf(TEXT("// Generated by the GenerateAttackScorers commandlet from %s. Do not edit.\n\n"), *Set.SetId.ToString());
+        Out += TEXT("#include <Choosers/MCS_NativeScorer.h>\n\n");
+        Out += TEXT("namespace MCSGeneratedScorers\n{\n");
+        Out += FString::Printf(TEXT("    namespace %s\n    {\n"), *Name);
+
+        // Hot fields
+        Out += TEXT("        static constexpr FMCS_NativeAttackRow Rows[] =\n        {\n");
+        for (const FMCS_AttackEntry& Entry : Set.Entries)
+        {
+            Out += FString::Printf(TEXT("            { %s, %s, %s, %s, %s }, // %s\n"),
+                *FloatLiteral(Entry.SelectionWeight), *FloatLiteral(Entry.RangeStart), *FloatLiteral(Entry.RangeEnd),
+                *EnumLiteral(Entry.AttackDirection), *EnumLiteral(Entry.AttackSituation), *CommentText(Entry.AttackName.ToString()));
+        }
+        Out += TEXT("        };\n\n");
+
+        // One branch per row, conditions unrolled with their constants
+        Out += TEXT("        static float Score(int32 EntryIndex, const FMCS_NativeScoreQuery& Query)\n        {\n");
+        Out += TEXT("            using namespace MCS_NativeScoring;\n\n");
+        Out += TEXT("            switch (EntryIndex)\n            {\n");
+
+        for (int32 Index = 0; Index < Set.Num(); ++Index)
+        {
+            const FMCS_AttackEntry& Entry = Set.Entries[Index];
+            const FString Row = FString::Printf(TEXT("Rows[%d]"), Index);
+
+            Out += FString::Printf(TEXT("                case %d: // %s\n                {\n"), Index, *CommentText(Entry.AttackName.ToString()));
+            Out += FString::Printf(TEXT("                    const float Distance = DistanceScore(Query.Distance, %s.RangeStart, %s.RangeEnd);\n"), *Row, *Row);
+            Out += TEXT("                    if (Distance <= Disqualified * 0.5f) return Disqualified;\n\n");
+            Out += FString::Printf(TEXT("                    float Situation = SituationScore(%s.Situation, *Query.Situation);\n"), *Row);
+
+            for (const FMCS_AttackCondition& Condition : Entry.ConditionalChecks)
+            {
+                const FString Passes = FString::Printf(TEXT("ConditionPasses(%s, %s, %s)"),
+                    *EnumLiteral(Condition.Comparison), *AttributeExpression(Condition.AttributeName), *FloatLiteral(Condition.Threshold));
+
+                if (Condition.bMustPass)
+                {
+                    Out += FString::Printf(TEXT("                    if (!%s) return Disqualified; // %s (must pass)\n"), *Passes, *CommentText(Condition.AttributeName.ToString()));
+                    Out += FString::Printf(TEXT("                    Situation += %s;\n"), *FloatLiteral(Condition.Weight));
+                }
+                else
+                {
+                    Out += FString::Printf(TEXT("                    Situation += %s ? %s : %s; // %s\n"), *Passes,
+                        *FloatLiteral(Condition.Weight), *FloatLiteral(-Condition.Weight), *CommentText(Condition.AttributeName.ToString()));
+                }
+            }
+
+            if (!Entry.ConditionalChecks.IsEmpty())
+            {
+                Out += TEXT("                    if (Situation <= Disqualified * 0.5f) return Disqualified;\n");
+            }
+
+            Out += FString::Printf(TEXT("\n                    return %s.Weight + Distance + DirectionScore(%s.Direction, Query.Direction) + Situation;\n                }\n"), *Row, *Row);
+        }
+
+        Out += TEXT("                default:\n                    return Disqualified;\n            }\n        }\n    }\n\n");
+
+        Out += FString::Printf(TEXT("    FMCS_NativeScorer GetScorer_%s()\n    {\n"), *Name);
+        Out += TEXT("        FMCS_NativeScorer Scorer;\n");
+        Out += FString::Printf(TEXT("        Scorer.Score = &%s::Score;\n"), *Name);
+        Out += FString::Printf(TEXT("        Scorer.NumEntries = %d;\n"), Set.Num());
+        Out += FString::Printf(TEXT("        Scorer.ScoringHash = 0x%08Xu;\n"), Set.ComputeScoringHash());
+        Out += TEXT("        return Scorer;\n    }\n}\n");
+
+        return Out;
+    }
+
+    static FString GenerateModule(const FString& ModuleName, const TArray<TPair<FName, FString>>& Sets)
+    {
+        FString Out;
+        Out += TEXT("// Generated by the GenerateAttackScorers commandlet. Do not edit.\n\n");
+        Out += TEXT("#include \"Modules/ModuleManager.h\"\n");
+        Out += TEXT("#include <Choosers/MCS_NativeScorer.h>\n\n");
+
+        Out += TEXT("namespace MCSGeneratedScorers\n{\n");
+        for (const TPair<FName, FString>& Set : Sets)
+        {
+            Out += FString::Printf(TEXT("    FMCS_NativeScorer GetScorer_%s();\n"), *Set.Value);
+        }
+        Out += TEXT("}\n\n");
+
+        Out += FString::Printf(TEXT("class F%sModule : public IModuleInterface\n{\npublic:\n"), *ModuleName);
+        Out += TEXT("    virtual void StartupModule() override\n    {\n");
+        for (const TPair<FName, FString>& Set : Sets)
+        {
+            Out += FString::Printf(TEXT("        FMCS_NativeScorerRegistry::Register(TEXT(\"%s\"), MCSGeneratedScorers::GetScorer_%s());\n"),
+                *Set.Key.ToString(), *Set.Value);
+        }
+        Out += TEXT("    }\n\n");
+        Out += TEXT("    virtual void ShutdownModule() override\n    {\n");
+        for (const TPair<FName, FString>& Set : Sets)
+        {
+            Out += FString::Printf(TEXT("        FMCS_NativeScorerRegistry::Unregister(TEXT(\"%s\"));\n"), *Set.Key.ToString());
+        }
+        Out += TEXT("    }\n};\n\n");
+        Out += FString::Printf(TEXT("IMPLEMENT_MODULE(F%sModule, %s)\n"), *ModuleName, *ModuleName);
+
+        return Out;
+    }
+
+    static FString GenerateBuildRules(const FString& ModuleName)
+    {
+        FString Out;
+        Out += TEXT("// Generated by the GenerateAttackScorers commandlet. Do not edit.\n\n");
+        Out += TEXT("using UnrealBuildTool;\n\n");
+        Out += FString::Printf(TEXT("public class %s : ModuleRules\n{\n"), *ModuleName);
+        Out += FString::Printf(TEXT("    public %s(ReadOnlyTargetRules Target) : base(Target)\n    {\n"), *ModuleName);
+        Out += TEXT("        PCHUsage = PCHUsageMode.UseExplicitOrSharedPCHs;\n");
+        Out += TEXT("        OptimizeCode = CodeOptimization.Always;\n\n");
+        Out += TEXT("        PrivateDependencyModuleNames.AddRange(new string[]\n        {\n");
+        Out += TEXT("            \"Core\",\n            \"CoreUObject\",\n            \"Engine\",\n            \"GameplayTags\",\n            \"MotionCombatSystem\"\n");
+        Out += TEXT("        });\n    }\n}\n");
+        return Out;
+    }
+
+    /** Writes a file only when its content changed, so an unchanged table does not trigger a rebuild */
+    static bool WriteIfChanged(const FString& Path, const FString& Content)
+    {
+        FString Existing;
+        if (FFileHelper::LoadFileToString(Existing, *Path) && Existing == Content)
+        {
+            return true;
+        }
+
+        if (!FFileHelper::SaveStringToFile(Content, *Path, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
+        {
+            UE_LOG(LogTemp, Error, TEXT("[GenerateAttackScorers] Could not write %s."), *Path);
+            return false;
+        }
+
+        UE_LOG(LogTemp, Display, TEXT("[GenerateAttackScorers] Wrote %s."), *Path);
+        return true;
+    }
+}
+
+UGenerateAttackScorersCommandlet::UGenerateAttackScorersCommandlet()
+{
+    IsClient = false;
+    IsEditor = true;
+    IsServer = false;
+    LogToConsole = true;
+}
+
+int32 UGenerateAttackScorersCommandlet::Main(const FString& Params)
+{
+    FString TablesParam;
+    if (!FParse::Value(*Params, TEXT("Tables="), TablesParam, false))
+    {
+        UE_LOG(LogTemp, Error, TEXT("[GenerateAttackScorers] Usage: -run=GenerateAttackScorers -Tables=<table path>+<table path> [-Module=<name>] [-Output=<directory>]"));
+        return 1;
+    }
+
+    FString ModuleName = TEXT("MCSGeneratedScorers");
+    FParse::Value(*Params, TEXT("Module="), ModuleName);
+
+    FString OutputDir = FPaths::Combine(FPaths::ProjectDir(), TEXT("Source"));
+    FParse::Value(*Params, TEXT("Output="), OutputDir);
+
+    const FString ModuleDir = FPaths::Combine(OutputDir, ModuleName);
+
+    TArray<FString> TablePaths;
+    TablesParam.ParseIntoArray(TablePaths, TEXT("+"));
+
+    TArray<TPair<FName, FString>> Generated;
+    TSet<FString> UsedNames;
+    bool bSucceeded = true;
+
+    for (const FString& TablePath : TablePaths)
+    {
+        const UDataTable* Table = LoadObject<UDataTable>(nullptr, *TablePath);
+        if (!Table || !Table->GetRowStruct() || !Table->GetRowStruct()->IsChildOf(FMCS_AttackEntry::StaticStruct()))
+        {
+            UE_LOG(LogTemp, Error, TEXT("[GenerateAttackScorers] %s is not a DataTable of FMCS_AttackEntry rows."), *TablePath);
+            bSucceeded = false;
+            continue;
+        }
+
+        FMCS_CompiledAttackSet Set;
+        Set.Build(*Table);
+
+        if (!Set.Entries.ContainsByPredicate([] (const FMCS_AttackEntry& Entry) { return !MCS_ScorerGen::IsFinite(Entry); }))
+        {
+            // Unique identifier per set (tables in different folders may share a name)
+            FString Name = MCS_ScorerGen::Identifier(Table->GetName());
+            for (int32 Suffix = 2; UsedNames.Contains(Name); ++Suffix)
+            {
+                Name = FString::Printf(TEXT("%s_%d"), *MCS_ScorerGen::Identifier(Table->GetName()), Suffix);
+            }
+            UsedNames.Add(Name);
+
+            const FString SetFile = FPaths::Combine(ModuleDir, TEXT("Private"), Name + TEXT(".cpp"));
+            bSucceeded &= MCS_ScorerGen::WriteIfChanged(SetFile, MCS_ScorerGen::GenerateSet(Set, Name));
+
+            Generated.Emplace(Set.SetId, Name);
+            UE_LOG(LogTemp, Display, TEXT("[GenerateAttackScorers] %s: %d rows."), *TablePath, Set.Num());
+        }
+        else
+        {
+            UE_LOG(LogTemp, Error, TEXT("[GenerateAttackScorers] %s has non-finite weights or ranges; skipped."), *TablePath);
+            bSucceeded = false;
+        }
+    }
+
+    bSucceeded &= MCS_ScorerGen::WriteIfChanged(FPaths::Combine(ModuleDir, TEXT("Private"), ModuleName + TEXT("Module.cpp")),
+        MCS_ScorerGen::GenerateModule(ModuleName, Generated));
+    bSucceeded &= MCS_ScorerGen::WriteIfChanged(FPaths::Combine(ModuleDir, ModuleName + TEXT(".Build.cs")),
+        MCS_ScorerGen::GenerateBuildRules(ModuleName));
+
+    UE_LOG(LogTemp, Display, TEXT("[GenerateAttackScorers] %d scorers in %s. List %s as a Runtime module of the project (first run only)."),
+        Generated.Num(), *ModuleDir, *ModuleName);
+
+    return bSucceeded ? 0 : 1;
+}
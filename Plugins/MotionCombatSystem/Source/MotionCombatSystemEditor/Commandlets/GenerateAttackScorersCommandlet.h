@@ -0,0 +1,43 @@
+/*
+ * ========================================================================
+ * Copyright © 2025 God's Studio
+ * All Rights Reserved.
+ *
+ * Free for all to use, copy, and distribute. I hope you learn from this as I learned creating it.
+ * =============================================================================
+ *
+ * Project: Motion Combat System
+ * This is a combat system inspired by Unreal Engine’s Motion Matching plugin.
+ * Author: Christopher D. Parker
+ * Date: 10-18-2026
+ * =============================================================================
+ * GenerateAttackScorersCommandlet.h
+ * Commandlet that writes a C++ module of native scorers generated from attack DataTables.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "GenerateAttackScorersCommandlet.generated.h"
+
+/**
+ * Generates one native scorer per attack DataTable (see MCS_NativeScorer.h) and the module registering them.
+ *
+ * UnrealEditor-Cmd <Project>.uproject -run=GenerateAttackScorers -Tables=/Game/Combat/DT_Sword.DT_Sword+/Game/Combat/DT_Fists.DT_Fists
+ *     [-Module=MCSGeneratedScorers] [-Output=<directory the module folder is written into, default <Project>/Source>]
+ *
+ * Add the module to the project (Modules in the .uproject and the game target) once; rerun whenever the
+ * tables change. Scorers whose table changed since are ignored at runtime (data-driven scoring is used).
+ */
+UCLASS()
+class MOTIONCOMBATSYSTEMEDITOR_API UGenerateAttackScorersCommandlet : public UCommandlet
+{
+    GENERATED_BODY()
+
+public:
+    // Constructor
+    UGenerateAttackScorersCommandlet();
+
+    virtual int32 Main(const FString& Params) override;
+};
@@ -0,0 +1,94 @@
+/*
+ * ========================================================================
+ * Copyright © 2025 God's Studio
+ * All Rights Reserved.
+ *
+ * Free for all to use, copy, and distribute. I hope you learn from this as I learned creating it.
+ * =============================================================================
+ *
+ * Project: Motion Combat System
+ * This is a combat system inspired by Unreal Engine’s Motion Matching plugin.
+ * Author: Christopher D. Parker
+ * Date: 10-18-2026
+ * =============================================================================
+ * CombatDatabaseFactory.h
+ * Factory that creates an empty UMCS_CombatDatabase (cooked attack/defense/hit reaction tables).
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Factories/Factory.h"
+#include "AssetToolsModule.h"
+#include "AssetTypeCategories.h"
+#include <Data/MCS_CombatDatabase.h>
+#include "CombatDatabaseFactory.generated.h"
+
+extern EAssetTypeCategories::Type MotionCombatSystemCategory;
+
+UCLASS()
+class MOTIONCOMBATSYSTEMEDITOR_API UCombatDatabaseFactory : public UFactory
+{
+    GENERATED_BODY()
+
+public:
+    // Constructor
+    UCombatDatabaseFactory()
+    {
+        bCreateNew = true;
+        bEditAfterNew = true;
+        SupportedClass = UMCS_CombatDatabase::StaticClass();
+    }
+
+    /**
+     * Factory method to create a new instance of the supported class.
+     * @param Class The class of the object to create.
+     * @param InParent The parent object for the new object.
+     * @param Name The name of the new object.
+     * @param Flags The flags to apply to the new object.
+     * @param Context The context in which the object is being created.
+     * @param Warn The feedback context for warnings.
+     * @return A new instance of the supported class.
+     */
+    virtual UObject* FactoryCreateNew(UClass* Class, UObject* InParent, FName Name, EObjectFlags Flags, UObject* Context, FFeedbackContext* Warn) override
+    {
+        // Source tables are added in the details panel; the database compiles them when saved
+        return NewObject<UMCS_CombatDatabase>(InParent, Class ? Class : UMCS_CombatDatabase::StaticClass(), Name, Flags);
+    }
+
+    /*
+     * Get the menu categories for this factory.
+     * @return The menu categories for this factory.
+     */
+    virtual uint32 GetMenuCategories() const override
+    {
+        return MotionCombatSystemCategory;
+    }
+
+    /**
+     * Determine whether this factory should be shown in the "New" menu.
+     * @return True if the factory should be shown, false otherwise.
+     */
+    virtual bool ShouldShowInNewMenu() const override
+    {
+        return true;
+    }
+
+    /*
+     * Get the display name for this factory.
+     * @return The display name for this factory.
+     */
+    virtual FText GetDisplayName() const override
+    {
+        return NSLOCTEXT("CombatDatabaseFactory", "DisplayName", "Combat Database");
+    }
+
+    /*
+     * Get the tooltip for this factory.
+     * @return The tooltip for this factory.
+     */
+    virtual FText GetToolTip() const override
+    {
+        return NSLOCTEXT("CombatDatabaseFactory", "ToolTip", "Create a new Motion Combat System Combat Database (attack, defense and hit reaction tables compiled for cooked builds).");
+    }
+};
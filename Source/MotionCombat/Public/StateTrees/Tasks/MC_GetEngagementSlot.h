@@ -0,0 +1,147 @@
+/*
+ * ========================================================================
+ * Copyright © 2025 God's Studio
+ * All Rights Reserved.
+ *
+ * Free for all to use, copy, and distribute. I hope you learn from this as I learned creating it.
+ * =============================================================================
+ *
+ * Project: Motion Combat System
+ * This is a combat system inspired by Unreal Engine’s Motion Matching plugin.
+ * Author: Christopher D. Parker
+ * Date: 10-18-2026
+ * =============================================================================
+ * MC_GetEngagementSlot.h
+ * Implements a StateTree Task that reserves a shared engagement slot around the current target.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "StateTreeTaskBase.h"
+#include "StateTreeExecutionContext.h"
+#include "GameFramework/Actor.h"
+#include <Characters/MC_CharacterBase.h>
+#include <Controllers/MC_EnemyAIController.h>
+#include <SubSystems/MCS_EngagementSubsystem.h>
+#include "MC_GetEngagementSlot.generated.h"
+
+
+/**
+ * Instance data for the Get Engagement Slot task.
+ */
+USTRUCT(BlueprintType, Category = "Motion Combat|State Tree|Tasks",
+    meta = (DisplayName = "Get Engagement Slot Task Instance Data",
+        Description = "Instance data for the Get Engagement Slot StateTree task.",
+        ToolTip = "Instance data for the Get Engagement Slot StateTree task."))
+struct FGetEngagementSlotTaskInstanceData
+{
+    GENERATED_BODY()
+
+    /** The enemy character this task is associated with. */
+    UPROPERTY(BlueprintReadOnly, Category = "Context", meta = (Input))
+    TObjectPtr<AMC_CharacterBase> Actor;
+
+    /** The AI controller managing the enemy character. */
+    UPROPERTY(BlueprintReadOnly, Category = "Context", meta = (Input))
+    TObjectPtr<AMC_EnemyAIController> AIController;
+
+    /** Optional target to engage. Falls back to the controller's acquired target when not bound. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Input", meta = (Optional))
+    TObjectPtr<AActor> Target;
+
+    /** Release the reserved slot when the state exits. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite)
+    bool bReleaseOnExit = false;
+
+    /** Output: the reserved, navmesh-projected slot location. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (Output))
+    FVector SlotLocation = FVector::ZeroVector;
+};
+
+/**
+ * StateTree Task:
+ * Reserves an engagement slot around the target that fits the range window of the
+ * actor's active attack set. Slots are shared and cached per target by the
+ * UMCS_EngagementSubsystem, so a whole squad costs one set of navmesh projections.
+ */
+USTRUCT(Category = "Motion Combat|State Tree|Tasks",
+    meta = (DisplayName = "Get Engagement Slot",
+        Description = "StateTree task to reserve a shared engagement slot around the current target.",
+        ToolTip = "StateTree task to reserve a shared engagement slot around the current target.",
+        Keywords = "Engagement, Slot, Surround, AI, Navigation, StateTree")
+)
+struct MOTIONCOMBAT_API FMC_GetEngagementSlot : public FStateTreeTaskCommonBase
+{
+    GENERATED_BODY()
+
+    using FInstanceDataType = FGetEngagementSlotTaskInstanceData;
+
+    virtual const UStruct* GetInstanceDataType() const override { return FGetEngagementSlotTaskInstanceData::StaticStruct(); }
+
+    /**
+     * Called when the task is entered.
+     * @param Context The execution context.
+     * @param Transition The transition result.
+     */
+    virtual EStateTreeRunStatus EnterState(FStateTreeExecutionContext& Context, const FStateTreeTransitionResult& Transition) const override
+    {
+        FGetEngagementSlotTaskInstanceData& Data = Context.GetInstanceData(*this);
+
+        if (!Data.Actor)
+        {
+            UE_LOG(LogTemp, Warning, TEXT("MC_GetEngagementSlot: Actor is null."));
+            return EStateTreeRunStatus::Failed;
+        }
+
+        AActor* Target = Data.Target ? Data.Target.Get() : (Data.AIController ? Data.AIController->AcquiredTarget.Get() : nullptr);
+        if (!Target)
+        {
+            return EStateTreeRunStatus::Failed;
+        }
+
+        UWorld* World = Data.Actor->GetWorld();
+        UMCS_EngagementSubsystem* Engagement = World ? World->GetSubsystem<UMCS_EngagementSubsystem>() : nullptr;
+        if (!Engagement)
+        {
+            UE_LOG(LogTemp, Warning, TEXT("MC_GetEngagementSlot: Engagement subsystem is null."));
+            return EStateTreeRunStatus::Failed;
+        }
+
+        return Engagement->RequestSlotForActiveAttackSet(Data.Actor, Target, Data.SlotLocation)
+            ? EStateTreeRunStatus::Succeeded
+            : EStateTreeRunStatus::Failed;
+    }
+
+    /**
+     * Called when the task exits.
+     * @param Context The execution context.
+     * @param Transition The transition result.
+     */
+    virtual void ExitState(FStateTreeExecutionContext& Context, const FStateTreeTransitionResult& Transition) const override
+    {
+        FGetEngagementSlotTaskInstanceData& Data = Context.GetInstanceData(*this);
+        if (!Data.bReleaseOnExit || !Data.Actor)
+        {
+            return;
+        }
+
+        if (UMCS_EngagementSubsystem* Engagement = Data.Actor->GetWorld() ? Data.Actor->GetWorld()->GetSubsystem<UMCS_EngagementSubsystem>() : nullptr)
+        {
+            Engagement->ReleaseSlot(Data.Actor);
+        }
+    }
+
+#if WITH_EDITOR
+    virtual FName GetIconName() const override { return FName("GenericPlay"); }
+    virtual FColor GetIconColor() const override { return FColor(128, 200, 255); }
+
+    virtual FText GetDescription(const FGuid& ID,
+        FStateTreeDataView InstanceDataView,
+        const IStateTreeBindingLookup& BindingLookup,
+        EStateTreeNodeFormatting Formatting) const override
+    {
+        return NSLOCTEXT("MotionCombat", "GetEngagementSlotDescription", "Reserve engagement slot around target");
+    }
+#endif // WITH_EDITOR
+};
@@ -0,0 +1,176 @@
+/*
+ * ========================================================================
+ * Copyright © 2025 God's Studio
+ * All Rights Reserved.
+ *
+ * Free for all to use, copy, and distribute. I hope you learn from this as I learned creating it.
+ * =============================================================================
+ *
+ * Project: Motion Combat System
+ * This is a combat system inspired by Unreal Engine’s Motion Matching plugin.
+ * Author: Christopher D. Parker
+ * Date: 10-18-2026
+ * =============================================================================
+ * MC_GetRandomLocationAsync.h
+ * Implements a latent StateTree Task that returns a random reachable location without blocking the game thread.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "StateTreeTaskBase.h"
+#include "StateTreeExecutionContext.h"
+#include "GameFramework/Actor.h"
+#include <Characters/MC_CharacterBase.h>
+#include <Controllers/MC_EnemyAIController.h>
+#include <SubSystems/MCS_NavQuerySubsystem.h>
+#include "MC_GetRandomLocationAsync.generated.h"
+
+
+/**
+ * Instance data for the Get Random Location (Async) task.
+ */
+USTRUCT(BlueprintType, Category = "Motion Combat|State Tree|Tasks",
+    meta = (DisplayName = "Get Random Location Async Task Instance Data",
+        Description = "Instance data for the Get Random Location (Async) StateTree task.",
+        ToolTip = "Instance data for the Get Random Location (Async) StateTree task."))
+struct FGetRandomLocationAsyncTaskInstanceData
+{
+    GENERATED_BODY()
+
+    /** The enemy character this task is associated with. */
+    UPROPERTY(BlueprintReadOnly, Category = "Context", meta = (Input))
+    TObjectPtr<AMC_CharacterBase> Actor;
+
+    /** The AI controller managing the enemy character. */
+    UPROPERTY(BlueprintReadOnly, Category = "Context", meta = (Input))
+    TObjectPtr<AMC_EnemyAIController> AIController;
+
+    /** Search radius in world units. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite)
+    float SearchRadius = 1000.0f;
+
+    /** Output: a random reachable location. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (Output))
+    FVector RandomLocation = FVector::ZeroVector;
+
+    /** Handle of the in-flight query (0 when idle). */
+    int32 QueryHandle = 0;
+};
+
+/**
+ * StateTree Task:
+ * Latent version of Get Random Location. The query is queued on the UMCS_NavQuerySubsystem,
+ * which serves it from cached per-region point sets and validates it with an async path query.
+ * The task stays Running until the result is ready.
+ */
+USTRUCT(Category = "Motion Combat|State Tree|Tasks",
+    meta = (DisplayName = "Get Random Location (Async)",
+        Description = "Latent StateTree task to get a random reachable location within a radius around an actor.",
+        ToolTip = "Latent StateTree task to get a random reachable location within a radius around an actor.",
+        Keywords = "Get Random Location, Async, AI, Navigation, StateTree")
+)
+struct MOTIONCOMBAT_API FMC_GetRandomLocationAsync : public FStateTreeTaskCommonBase
+{
+    GENERATED_BODY()
+
+    using FInstanceDataType = FGetRandomLocationAsyncTaskInstanceData;
+
+    virtual const UStruct* GetInstanceDataType() const override { return FGetRandomLocationAsyncTaskInstanceData::StaticStruct(); }
+
+    /**
+     * Called when the task is entered. Queues the query and returns Running.
+     * @param Context The execution context.
+     * @param Transition The transition result.
+     */
+    virtual EStateTreeRunStatus EnterState(FStateTreeExecutionContext& Context, const FStateTreeTransitionResult& Transition) const override
+    {
+        FGetRandomLocationAsyncTaskInstanceData& Data = Context.GetInstanceData(*this);
+
+        UMCS_NavQuerySubsystem* NavQueries = GetNavQuerySubsystem(Data);
+        if (!NavQueries)
+        {
+            UE_LOG(LogTemp, Warning, TEXT("MC_GetRandomLocationAsync: Actor or Nav Query Subsystem is null."));
+            return EStateTreeRunStatus::Failed;
+        }
+
+        Data.QueryHandle = NavQueries->SubmitRandomLocationQuery(Data.Actor, Data.Actor->GetActorLocation(), Data.SearchRadius);
+        return Data.QueryHandle != 0 ? EStateTreeRunStatus::Running : EStateTreeRunStatus::Failed;
+    }
+
+    /**
+     * Called every tick while running. Polls the query result (a map lookup).
+     * @param Context The execution context.
+     * @param DeltaTime Time since last tick.
+     */
+    virtual EStateTreeRunStatus Tick(FStateTreeExecutionContext& Context, const float DeltaTime) const override
+    {
+        FGetRandomLocationAsyncTaskInstanceData& Data = Context.GetInstanceData(*this);
+
+        UMCS_NavQuerySubsystem* NavQueries = GetNavQuerySubsystem(Data);
+        if (!NavQueries || Data.QueryHandle == 0)
+        {
+            return EStateTreeRunStatus::Failed;
+        }
+
+        switch (NavQueries->ConsumeQueryResult(Data.QueryHandle, Data.RandomLocation))
+        {
+            case EMCS_NavQueryStatus::Pending:
+                return EStateTreeRunStatus::Running;
+
+            case EMCS_NavQueryStatus::Succeeded:
+                Data.QueryHandle = 0;
+                return EStateTreeRunStatus::Succeeded;
+
+            default:
+                Data.QueryHandle = 0;
+                return EStateTreeRunStatus::Failed;
+        }
+    }
+
+    /**
+     * Called when the task exits. Cancels the query if it is still in flight.
+     * @param Context The execution context.
+     * @param Transition The transition result.
+     */
+    virtual void ExitState(FStateTreeExecutionContext& Context, const FStateTreeTransitionResult& Transition) const override
+    {
+        FGetRandomLocationAsyncTaskInstanceData& Data = Context.GetInstanceData(*this);
+
+        if (Data.QueryHandle != 0)
+        {
+            if (UMCS_NavQuerySubsystem* NavQueries = GetNavQuerySubsystem(Data))
+            {
+                NavQueries->CancelQuery(Data.QueryHandle);
+            }
+            Data.QueryHandle = 0;
+        }
+    }
+
+#if WITH_EDITOR
+    virtual FName GetIconName() const override { return FName("GenericPlay"); }
+    virtual FColor GetIconColor() const override { return FColor(128, 200, 255); }
+
+    virtual FText GetDescription(const FGuid& ID,
+        FStateTreeDataView InstanceDataView,
+        const IStateTreeBindingLookup& BindingLookup,
+        EStateTreeNodeFormatting Formatting) const override
+    {
+        if (const FGetRandomLocationAsyncTaskInstanceData* Data = InstanceDataView.GetPtr<FGetRandomLocationAsyncTaskInstanceData>())
+        {
+            return FText::Format(
+                NSLOCTEXT("MotionCombat", "GetRandomLocationAsyncDescription", "Get random location (async), radius: {0} units"),
+                FText::AsNumber(Data->SearchRadius));
+        }
+
+        return NSLOCTEXT("MotionCombat", "DescRandomLocationAsync_NoData", "Find random reachable location (async)");
+    }
+#endif // WITH_EDITOR
+
+private:
+    static UMCS_NavQuerySubsystem* GetNavQuerySubsystem(const FGetRandomLocationAsyncTaskInstanceData& Data)
+    {
+        UWorld* World = Data.Actor ? Data.Actor->GetWorld() : nullptr;
+        return World ? World->GetSubsystem<UMCS_NavQuerySubsystem>() : nullptr;
+    }
+};